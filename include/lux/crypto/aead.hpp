@@ -0,0 +1,141 @@
+#pragma once
+
+#include <lux/support/move.hpp>
+#include <lux/support/result.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+
+namespace lux::crypto {
+
+enum class aead_algorithm
+{
+    aes_128_gcm,
+    aes_256_gcm,
+    chacha20_poly1305,
+};
+
+constexpr std::size_t aead_key_size(aead_algorithm algorithm) noexcept
+{
+    switch (algorithm)
+    {
+    case aead_algorithm::aes_128_gcm:
+        return 16;
+    case aead_algorithm::aes_256_gcm:
+    case aead_algorithm::chacha20_poly1305:
+        return 32;
+    }
+    return 0;
+}
+
+inline constexpr std::size_t aead_nonce_size = 12;
+inline constexpr std::size_t aead_tag_size = 16;
+
+using aead_nonce = std::array<std::byte, aead_nonce_size>;
+
+namespace detail {
+
+// Cipher contexts of the OpenSSL library lux is built with
+struct aead_ctx;
+
+struct aead_ctx_deleter
+{
+    void operator()(aead_ctx* ctx) const noexcept;
+};
+
+} // namespace detail
+
+/**
+ * Authenticated encryption with associated data, operating in place on caller buffers.
+ *
+ * The key schedule is computed once when the cipher is created and the cipher contexts are reused for every
+ * message, so sealing and opening neither allocate nor copy. A message written with lux::buffer_writer can be
+ * sealed where it is by skipping aead_tag_size bytes after the payload and sealing the written data.
+ *
+ * Every nonce must be used only once with the same key. An aead_cipher is not thread-safe; use one per thread.
+ */
+class aead_cipher
+{
+public:
+    /**
+     * Encrypts the data in place and computes its tag.
+     *
+     * @param nonce The nonce, aead_nonce_size bytes.
+     * @param aad Associated data authenticated along with the data but not encrypted.
+     * @param data The plaintext, replaced by the ciphertext.
+     * @param tag Receives the authentication tag, aead_tag_size bytes.
+     * @return A status indicating success or failure.
+     */
+    lux::status seal(std::span<const std::byte> nonce,
+                     std::span<const std::byte> aad,
+                     std::span<std::byte> data,
+                     std::span<std::byte> tag);
+
+    /**
+     * Encrypts a message laid out as the payload followed by room for the tag.
+     *
+     * @param nonce The nonce, aead_nonce_size bytes.
+     * @param aad Associated data authenticated along with the payload but not encrypted.
+     * @param message The payload followed by aead_tag_size bytes receiving the tag.
+     * @return A status indicating success or failure.
+     */
+    lux::status seal(std::span<const std::byte> nonce, std::span<const std::byte> aad, std::span<std::byte> message);
+
+    /**
+     * Verifies the tag and decrypts the data in place.
+     * The data is wiped if the verification fails, so unauthenticated plaintext is never exposed.
+     *
+     * @param nonce The nonce the data was sealed with.
+     * @param aad The associated data the data was sealed with.
+     * @param data The ciphertext, replaced by the plaintext.
+     * @param tag The authentication tag, aead_tag_size bytes.
+     * @return A status indicating success, or failure if the data or associated data were tampered with.
+     */
+    lux::status open(std::span<const std::byte> nonce,
+                     std::span<const std::byte> aad,
+                     std::span<std::byte> data,
+                     std::span<const std::byte> tag);
+
+    /**
+     * Verifies and decrypts a message laid out as the payload followed by the tag.
+     *
+     * @param nonce The nonce the message was sealed with.
+     * @param aad The associated data the message was sealed with.
+     * @param message The encrypted payload followed by the tag.
+     * @return A result containing the decrypted payload within the message on success, or an error message on failure.
+     */
+    lux::result<std::span<std::byte>> open(std::span<const std::byte> nonce,
+                                           std::span<const std::byte> aad,
+                                           std::span<std::byte> message);
+
+    aead_algorithm algorithm() const noexcept
+    {
+        return algorithm_;
+    }
+
+private:
+    friend lux::result<aead_cipher> make_aead_cipher(aead_algorithm algorithm, std::span<const std::byte> key);
+
+    using ctx_ptr = std::unique_ptr<detail::aead_ctx, detail::aead_ctx_deleter>;
+
+    aead_cipher(aead_algorithm algorithm, ctx_ptr ctx) : algorithm_{algorithm}, ctx_{lux::move(ctx)}
+    {
+    }
+
+private:
+    aead_algorithm algorithm_;
+    ctx_ptr ctx_;
+};
+
+/**
+ * Creates a cipher with the key.
+ *
+ * @param algorithm The AEAD algorithm.
+ * @param key The secret key, aead_key_size(algorithm) bytes.
+ * @return A result containing the cipher on success, or an error message on failure.
+ */
+lux::result<aead_cipher> make_aead_cipher(aead_algorithm algorithm, std::span<const std::byte> key);
+
+} // namespace lux::crypto
@@ -2,10 +2,15 @@
 
 #include <lux/crypto/key.hpp>
 
+#include <lux/support/move.hpp>
 #include <lux/support/result.hpp>
 #include <lux/support/strong_typedef.hpp>
 
+#include <openssl/ossl_typ.h>
+
+#include <chrono>
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -55,4 +60,125 @@ lux::result<csr_der> generate_csr(const lux::crypto::ed25519_private_key& privat
  */
 lux::result<csr_pem> to_pem(const csr_der& der_csr);
 
-} // namespace lux::crypto
\ No newline at end of file
+/**
+ * DER-encoded X.509 certificate.
+ */
+using cert_der = lux::strong_typedef<std::vector<std::byte>, struct cert_der_tag>;
+
+/**
+ * PEM-encoded X.509 certificate.
+ */
+using cert_pem = lux::strong_typedef<std::string, struct cert_pem_tag>;
+
+/**
+ * Options of an issued certificate.
+ */
+struct cert_options
+{
+    std::chrono::seconds valid_for = std::chrono::days{365};
+    bool is_ca = false;
+};
+
+/**
+ * Generates a self-signed certificate for the ED25519 private key.
+ * Subject alternative names that parse as IP addresses are added as IP addresses, the others as DNS names.
+ *
+ * @param private_key The ED25519 private key of the subject, also used to sign the certificate.
+ * @param subject The subject information to include in the certificate.
+ * @param options The validity period and whether the certificate belongs to a CA.
+ * @return A result containing the DER-encoded certificate on success, or an error message on failure.
+ */
+lux::result<cert_der> generate_self_signed_cert(const lux::crypto::ed25519_private_key& private_key,
+                                                const subject_info& subject,
+                                                const cert_options& options = {});
+
+/**
+ * Issues a certificate for the subject key signed by the issuer.
+ *
+ * @param subject_key The ED25519 public key of the subject.
+ * @param subject The subject information to include in the certificate.
+ * @param issuer_key The ED25519 private key of the issuer.
+ * @param issuer_cert The certificate of the issuer, which must be a CA certificate.
+ * @param options The validity period and whether the certificate belongs to a CA.
+ * @return A result containing the DER-encoded certificate on success, or an error message on failure.
+ */
+lux::result<cert_der> issue_cert(const lux::crypto::ed25519_public_key& subject_key,
+                                 const subject_info& subject,
+                                 const lux::crypto::ed25519_private_key& issuer_key,
+                                 const cert_der& issuer_cert,
+                                 const cert_options& options = {});
+
+/**
+ * Converts a DER-encoded certificate to PEM format.
+ *
+ * @param der_cert The DER-encoded certificate to convert.
+ * @return A result containing the PEM-encoded certificate on success, or an error message on failure.
+ */
+lux::result<cert_pem> to_pem(const cert_der& der_cert);
+
+/**
+ * Certificate issued together with a freshly generated private key.
+ */
+struct issued_cert
+{
+    lux::crypto::ed25519_private_key private_key;
+    cert_der cert;
+};
+
+/**
+ * In-memory certificate authority for tests and development setups.
+ * The CA key and certificate are parsed once, so issuing a certificate only costs generating the leaf key and
+ * signing. Copies share the parsed key and certificate; issuing is thread-safe.
+ */
+class certificate_authority
+{
+public:
+    /**
+     * Generates a private key and issues a certificate for it.
+     *
+     * @param subject The subject information to include in the certificate.
+     * @param options The validity period and whether the certificate belongs to a CA.
+     * @return A result containing the private key and the certificate on success, or an error message on failure.
+     */
+    lux::result<issued_cert> issue(const subject_info& subject, const cert_options& options = {}) const;
+
+    const lux::crypto::ed25519_private_key& private_key() const noexcept
+    {
+        return private_key_;
+    }
+
+    const cert_der& cert() const noexcept
+    {
+        return cert_;
+    }
+
+private:
+    friend lux::result<certificate_authority> make_certificate_authority(const subject_info& subject,
+                                                                         std::chrono::seconds valid_for);
+
+    certificate_authority(lux::crypto::ed25519_private_key private_key,
+                          cert_der cert,
+                          std::shared_ptr<EVP_PKEY> key,
+                          std::shared_ptr<X509> x509)
+        : private_key_{lux::move(private_key)}, cert_{lux::move(cert)}, key_{lux::move(key)}, x509_{lux::move(x509)}
+    {
+    }
+
+private:
+    lux::crypto::ed25519_private_key private_key_;
+    cert_der cert_;
+    std::shared_ptr<EVP_PKEY> key_;
+    std::shared_ptr<X509> x509_;
+};
+
+/**
+ * Creates a certificate authority with a freshly generated key and a self-signed CA certificate.
+ *
+ * @param subject The subject information of the CA.
+ * @param valid_for The validity period of the CA certificate.
+ * @return A result containing the certificate authority on success, or an error message on failure.
+ */
+lux::result<certificate_authority> make_certificate_authority(const subject_info& subject,
+                                                              std::chrono::seconds valid_for = std::chrono::days{365});
+
+} // namespace lux::crypto
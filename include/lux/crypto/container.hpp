@@ -1,16 +1,19 @@
 #pragma once
 
-#include <openssl/crypto.h>
+#include <lux/crypto/secure_memory.hpp>
 
 #include <cstddef>
+#include <limits>
+#include <new>
+#include <string>
 #include <vector>
 
 namespace lux::crypto {
 
 /**
- * Secure allocator using OpenSSL's secure memory functions.
- * Allocates memory using OPENSSL_secure_malloc and cleanses it before freeing.
- * This allocator is intended for use with sensitive data that requires secure handling.
+ * Secure allocator using lux::crypto::secure_allocate.
+ * Small allocations come from the pooled secure arena, larger ones from the OpenSSL secure heap; memory is cleansed
+ * before it's released. This allocator is intended for use with sensitive data that requires secure handling.
  */
 template <typename T>
 struct secure_allocator
@@ -26,16 +29,17 @@ struct secure_allocator
 
     T* allocate(std::size_t n)
     {
-        return static_cast<T*>(OPENSSL_secure_malloc(n * sizeof(T)));
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length{};
+        }
+
+        return static_cast<T*>(lux::crypto::secure_allocate(n * sizeof(T)));
     }
 
     void deallocate(T* p, std::size_t n) noexcept
     {
-        if (p)
-        {
-            OPENSSL_cleanse(p, n * sizeof(T));
-            OPENSSL_free(p);
-        }
+        lux::crypto::secure_deallocate(p, n * sizeof(T));
     }
 
     template <typename U>
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <lux/support/move.hpp>
+#include <lux/support/result.hpp>
+
+#include <openssl/ossl_typ.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+
+namespace lux::crypto {
+
+/**
+ * Hash algorithms. Not every library lux can be built with implements all the BLAKE2 variants: BoringSSL only
+ * has BLAKE2b-256, OpenSSL only BLAKE2s-256 and BLAKE2b-512. Using a missing one fails at runtime.
+ */
+enum class hash_algorithm
+{
+    sha256,
+    sha512,
+    blake2s256,
+    blake2b256,
+    blake2b512,
+};
+
+inline constexpr std::size_t max_digest_size = 64;
+
+constexpr std::size_t digest_size(hash_algorithm algorithm) noexcept
+{
+    switch (algorithm)
+    {
+    case hash_algorithm::sha256:
+    case hash_algorithm::blake2s256:
+    case hash_algorithm::blake2b256:
+        return 32;
+    case hash_algorithm::sha512:
+    case hash_algorithm::blake2b512:
+        return 64;
+    }
+    return 0;
+}
+
+/**
+ * Digest or MAC of any of the supported algorithms, stored inline.
+ */
+struct digest
+{
+    std::array<std::byte, max_digest_size> data{};
+    std::size_t size{0};
+
+    std::span<const std::byte> bytes() const noexcept
+    {
+        return std::span{data}.first(size);
+    }
+
+    bool operator==(const digest&) const = default;
+};
+
+namespace detail {
+
+// Returns the context to a per-thread pool instead of freeing it
+struct pooled_md_ctx_deleter
+{
+    void operator()(EVP_MD_CTX* ctx) const noexcept;
+};
+
+// Returns the context to a per-thread pool instead of freeing it
+struct pooled_hmac_ctx_deleter
+{
+    void operator()(HMAC_CTX* ctx) const noexcept;
+};
+
+} // namespace detail
+
+/**
+ * Incremental hash of a message.
+ * The digest context is taken from a per-thread pool and returned to it on destruction, so short-lived hashers
+ * don't allocate once the pool is warm.
+ */
+class hasher
+{
+public:
+    /**
+     * Appends data to the message.
+     *
+     * @param data The data to append.
+     * @return A status indicating success or failure.
+     */
+    lux::status update(std::span<const std::byte> data);
+
+    lux::status update(std::string_view data)
+    {
+        return update(std::as_bytes(std::span{data.data(), data.size()}));
+    }
+
+    /**
+     * Completes the message and starts a new one.
+     *
+     * @return A result containing the digest of the message on success, or an error message on failure.
+     */
+    lux::result<digest> final();
+
+    hash_algorithm algorithm() const noexcept
+    {
+        return algorithm_;
+    }
+
+private:
+    friend lux::result<hasher> make_hasher(hash_algorithm algorithm);
+
+    using ctx_ptr = std::unique_ptr<EVP_MD_CTX, detail::pooled_md_ctx_deleter>;
+
+    hasher(hash_algorithm algorithm, ctx_ptr ctx) : algorithm_{algorithm}, ctx_{lux::move(ctx)}
+    {
+    }
+
+private:
+    hash_algorithm algorithm_;
+    ctx_ptr ctx_;
+};
+
+/**
+ * Incremental HMAC of a message with a fixed key.
+ * The key is processed once, so computing the MAC of many messages with the same key only costs the hashing. Like
+ * the digest context of a hasher, the HMAC context comes from a per-thread pool.
+ */
+class hmac
+{
+public:
+    /**
+     * Appends data to the message.
+     *
+     * @param data The data to append.
+     * @return A status indicating success or failure.
+     */
+    lux::status update(std::span<const std::byte> data);
+
+    lux::status update(std::string_view data)
+    {
+        return update(std::as_bytes(std::span{data.data(), data.size()}));
+    }
+
+    /**
+     * Completes the message and starts a new one with the same key.
+     *
+     * @return A result containing the MAC of the message on success, or an error message on failure.
+     */
+    lux::result<digest> final();
+
+    hash_algorithm algorithm() const noexcept
+    {
+        return algorithm_;
+    }
+
+private:
+    friend lux::result<hmac> make_hmac(hash_algorithm algorithm, std::span<const std::byte> key);
+
+    using ctx_ptr = std::unique_ptr<HMAC_CTX, detail::pooled_hmac_ctx_deleter>;
+
+    hmac(hash_algorithm algorithm, ctx_ptr ctx) : algorithm_{algorithm}, ctx_{lux::move(ctx)}
+    {
+    }
+
+private:
+    hash_algorithm algorithm_;
+    ctx_ptr ctx_;
+};
+
+/**
+ * Creates a hasher for the algorithm.
+ *
+ * @param algorithm The hash algorithm.
+ * @return A result containing the hasher on success, or an error message on failure (e.g. the algorithm is not
+ * implemented by the crypto library).
+ */
+lux::result<hasher> make_hasher(hash_algorithm algorithm);
+
+/**
+ * Creates an HMAC with the key.
+ *
+ * @param algorithm The hash algorithm used by the HMAC.
+ * @param key The secret key.
+ * @return A result containing the HMAC on success, or an error message on failure.
+ */
+lux::result<hmac> make_hmac(hash_algorithm algorithm, std::span<const std::byte> key);
+
+/**
+ * Computes the digest of a single message.
+ *
+ * @param algorithm The hash algorithm.
+ * @param data The message.
+ * @return A result containing the digest on success, or an error message on failure.
+ */
+lux::result<digest> hash(hash_algorithm algorithm, std::span<const std::byte> data);
+
+/**
+ * Computes the digests of many messages reusing a single digest context, which makes hashing many small messages
+ * considerably cheaper than hashing them one by one.
+ *
+ * @param algorithm The hash algorithm.
+ * @param messages The messages to hash.
+ * @param digests Receives the digest of each message; must have the same size as messages.
+ * @return A status indicating success or failure.
+ */
+lux::status hash_many(hash_algorithm algorithm,
+                      std::span<const std::span<const std::byte>> messages,
+                      std::span<digest> digests);
+
+/**
+ * Compares two byte sequences in time independent of their contents, e.g. to check a received MAC.
+ */
+bool constant_time_equal(std::span<const std::byte> lhs, std::span<const std::byte> rhs) noexcept;
+
+} // namespace lux::crypto
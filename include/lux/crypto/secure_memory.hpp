@@ -0,0 +1,79 @@
+#pragma once
+
+#include <lux/support/result.hpp>
+
+#include <cstddef>
+
+namespace lux::crypto {
+
+struct secure_memory_config
+{
+    /**
+     * Size of the OpenSSL secure heap, a power of two. Zero leaves the secure heap uninitialized, OpenSSL then serves
+     * secure allocations from the regular heap. Ignored with BoringSSL, which has no secure heap.
+     */
+    std::size_t heap_size{64 * 1024};
+
+    /**
+     * Smallest allocation from the OpenSSL secure heap, a power of two.
+     */
+    std::size_t heap_min_allocation{32};
+
+    /**
+     * Size of the locked chunks the secure arena carves its slots from.
+     */
+    std::size_t arena_chunk_size{16 * 1024};
+};
+
+/**
+ * Largest allocation served by the secure arena, larger allocations are served by the OpenSSL secure heap.
+ */
+inline constexpr std::size_t secure_arena_max_slot_size = 1024;
+
+struct secure_arena_stats
+{
+    /** Bytes of locked memory reserved by the arena. */
+    std::size_t reserved_bytes{0};
+
+    /** Slots currently allocated from the arena. */
+    std::size_t allocated_slots{0};
+};
+
+/**
+ * Initializes the OpenSSL secure heap and the secure arena.
+ * This happens automatically with the default configuration on the first secure allocation; calling it before that
+ * allows a different configuration. The secure heap is left as is if the application already initialized it.
+ * With BoringSSL, which has no secure heap, only the secure arena is configured.
+ *
+ * @param config The secure memory configuration.
+ * @return A status indicating success, or failure if secure memory is already initialized or the secure heap could
+ * not be created.
+ */
+lux::status init_secure_memory(const secure_memory_config& config = {});
+
+/**
+ * Allocates secure memory.
+ * Allocations up to secure_arena_max_slot_size are served from fixed-size slots of the secure arena, which keeps its
+ * memory locked in RAM and out of core dumps and never returns it to the system. Larger allocations are served by
+ * the OpenSSL secure heap, or the regular heap once the secure heap is exhausted.
+ *
+ * @param size The size of the allocation in bytes.
+ * @return A pointer to zeroed memory aligned for any fundamental type.
+ * @throws std::bad_alloc if the memory can't be allocated.
+ */
+void* secure_allocate(std::size_t size);
+
+/**
+ * Cleanses and releases memory allocated by secure_allocate.
+ *
+ * @param ptr The pointer returned by secure_allocate, may be null.
+ * @param size The size passed to secure_allocate.
+ */
+void secure_deallocate(void* ptr, std::size_t size) noexcept;
+
+/**
+ * Returns the current usage of the secure arena.
+ */
+secure_arena_stats get_secure_arena_stats();
+
+} // namespace lux::crypto
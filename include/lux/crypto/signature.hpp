@@ -0,0 +1,144 @@
+#pragma once
+
+#include <lux/crypto/key.hpp>
+
+#include <lux/support/move.hpp>
+#include <lux/support/result.hpp>
+
+#include <openssl/ossl_typ.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+
+namespace lux::crypto {
+
+struct ed25519_signature
+{
+    static constexpr std::size_t size = 64;
+    std::array<std::byte, size> data;
+};
+
+/**
+ * Ed25519 private key parsed once and kept ready for signing.
+ * Copies share the parsed key; signing is thread-safe.
+ */
+class ed25519_signing_key
+{
+public:
+    /**
+     * Signs the message.
+     *
+     * @param message The message to sign.
+     * @return A result containing the signature on success, or an error message on failure.
+     */
+    lux::result<ed25519_signature> sign(std::span<const std::byte> message) const;
+
+    const ed25519_public_key& public_key() const noexcept
+    {
+        return public_key_;
+    }
+
+private:
+    friend lux::result<ed25519_signing_key> make_signing_key(const ed25519_private_key& private_key);
+
+    ed25519_signing_key(std::shared_ptr<EVP_PKEY> pkey, const ed25519_public_key& public_key)
+        : pkey_{lux::move(pkey)}, public_key_{public_key}
+    {
+    }
+
+private:
+    std::shared_ptr<EVP_PKEY> pkey_;
+    ed25519_public_key public_key_;
+};
+
+/**
+ * Ed25519 public key parsed once and kept ready for verification.
+ * Copies share the parsed key; verification is thread-safe.
+ */
+class ed25519_verifying_key
+{
+public:
+    /**
+     * Verifies the signature of the message.
+     *
+     * @param message The signed message.
+     * @param signature The signature to verify; signatures of the wrong size are rejected.
+     * @return True if the signature is valid, false otherwise.
+     */
+    bool verify(std::span<const std::byte> message, std::span<const std::byte> signature) const noexcept;
+
+    bool verify(std::span<const std::byte> message, const ed25519_signature& signature) const noexcept
+    {
+        return verify(message, std::span<const std::byte>{signature.data});
+    }
+
+private:
+    friend lux::result<ed25519_verifying_key> make_verifying_key(const ed25519_public_key& public_key);
+
+    explicit ed25519_verifying_key(std::shared_ptr<EVP_PKEY> pkey) : pkey_{lux::move(pkey)}
+    {
+    }
+
+private:
+    std::shared_ptr<EVP_PKEY> pkey_;
+};
+
+/**
+ * Parses the private key for repeated signing.
+ *
+ * @param private_key The Ed25519 private key.
+ * @return A result containing the signing key on success, or an error message on failure.
+ */
+lux::result<ed25519_signing_key> make_signing_key(const ed25519_private_key& private_key);
+
+/**
+ * Parses the public key for repeated verification.
+ *
+ * @param public_key The Ed25519 public key.
+ * @return A result containing the verifying key on success, or an error message on failure.
+ */
+lux::result<ed25519_verifying_key> make_verifying_key(const ed25519_public_key& public_key);
+
+/**
+ * Single entry of a batch verification; the referenced data must outlive the call.
+ */
+struct ed25519_verify_item
+{
+    std::span<const std::byte> message;
+    std::span<const std::byte> signature;
+    const ed25519_verifying_key* key = nullptr;
+};
+
+/**
+ * Runs task(0) to task(count - 1), possibly in parallel (e.g. on the threads of an existing pool), and returns
+ * once all of them completed.
+ */
+using parallel_for = std::function<void(std::size_t count, const std::function<void(std::size_t)>& task)>;
+
+/**
+ * Verifies a batch of signatures on the calling thread.
+ *
+ * @param items The signatures to verify; entries without a key are rejected.
+ * @param results Receives the result of each entry (1 if valid, 0 otherwise); must have the same size as items.
+ * @return True if all signatures are valid, false otherwise.
+ */
+bool verify_batch(std::span<const ed25519_verify_item> items, std::span<std::uint8_t> results);
+
+/**
+ * Verifies a batch of signatures, split in chunks run by the given parallel-for. No threads are started here, so
+ * the caller decides which threads share the work.
+ *
+ * @param items The signatures to verify; entries without a key are rejected.
+ * @param results Receives the result of each entry (1 if valid, 0 otherwise); must have the same size as items.
+ * @param run_parallel Runs the verification of the chunks.
+ * @return True if all signatures are valid, false otherwise.
+ */
+bool verify_batch(std::span<const ed25519_verify_item> items,
+                  std::span<std::uint8_t> results,
+                  const parallel_for& run_parallel);
+
+} // namespace lux::crypto
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <lux/crypto/cert.hpp>
+#include <lux/crypto/key.hpp>
+#include <lux/io/net/base/ssl.hpp>
+#include <lux/support/result.hpp>
+
+#include <span>
+
+namespace lux::crypto {
+
+/**
+ * Sets the certificate and private key of the SSL context from in-memory objects, without encoding them to PEM.
+ *
+ * @param ctx The SSL context to configure.
+ * @param private_key The ED25519 private key matching the certificate.
+ * @param cert The DER-encoded certificate.
+ * @param chain DER-encoded intermediate certificates sent along with the certificate.
+ * @return A status indicating success or failure.
+ */
+lux::status use_certificate(lux::net::base::ssl_context& ctx,
+                            const lux::crypto::ed25519_private_key& private_key,
+                            const cert_der& cert,
+                            std::span<const cert_der> chain = {});
+
+/**
+ * Adds a certificate to the trust store of the SSL context, e.g. the certificate of an in-memory CA.
+ *
+ * @param ctx The SSL context to configure.
+ * @param cert The DER-encoded certificate to trust.
+ * @return A status indicating success or failure.
+ */
+lux::status add_trusted_certificate(lux::net::base::ssl_context& ctx, const cert_der& cert);
+
+/**
+ * Creates a TLS 1.2+ server context presenting the certificate.
+ *
+ * @param private_key The ED25519 private key matching the certificate.
+ * @param cert The DER-encoded certificate.
+ * @param chain DER-encoded intermediate certificates sent along with the certificate.
+ * @return A result containing the SSL context on success, or an error message on failure.
+ */
+lux::result<lux::net::base::ssl_context> make_server_ssl_context(const lux::crypto::ed25519_private_key& private_key,
+                                                                 const cert_der& cert,
+                                                                 std::span<const cert_der> chain = {});
+
+/**
+ * Creates a TLS 1.2+ client context verifying the server against the trusted certificate.
+ *
+ * @param trusted_cert The DER-encoded certificate to trust, usually a CA certificate.
+ * @return A result containing the SSL context on success, or an error message on failure.
+ */
+lux::result<lux::net::base::ssl_context> make_client_ssl_context(const cert_der& trusted_cert);
+
+} // namespace lux::crypto
@@ -5,8 +5,11 @@ namespace lux {
 class logger_factory;
 class logger_manager;
 class logger;
+class binary_log_sink;
+class binary_log_reader;
 
 class memory_arena;
+class chunked_buffer_writer;
 class error_message;
 } // namespace lux
 
@@ -24,6 +27,9 @@ namespace lux::net::base {
 class endpoint;
 class hostname_endpoint;
 
+class file_source;
+struct file_region;
+
 enum class http_method;
 enum class http_status;
 
@@ -59,9 +65,13 @@ class udp_socket_handler;
 
 namespace lux::net {
 
+class async_http_client;
+class async_tcp_socket;
 class http_router;
 class http_server_app;
 class socket_factory;
+class static_file_handler;
+struct static_file_handler_config;
 class tcp_socket;
 class tcp_inbound_socket;
 class udp_socket;
@@ -79,6 +89,7 @@ namespace lux::proc {
 
 class process_factory;
 class process;
+class process_pool;
 
 } // namespace lux::proc
 
@@ -86,6 +97,7 @@ namespace lux::time::base {
 
 class timer_factory;
 class interval_timer;
+class retry_budget;
 
 } // namespace lux::time::base
 
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <lux/io/net/base/http_client.hpp>
+#include <lux/io/net/base/http_request.hpp>
+#include <lux/io/net/base/http_response.hpp>
+
+#include <lux/support/move.hpp>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/append.hpp>
+#include <boost/asio/associated_allocator.hpp>
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/recycling_allocator.hpp>
+
+#include <memory>
+
+namespace lux::net {
+
+/**
+ * @brief Completion token based adapter of a lux HTTP client.
+ *
+ * Allows the handler driven http_client to be used with boost::asio::use_awaitable (co_await),
+ * boost::asio::deferred or plain callbacks:
+ *
+ *     const auto result = co_await client.async_request(request, boost::asio::use_awaitable);
+ *
+ * The completion handler is invoked through its associated executor (the given executor by default) and never
+ * from within the initiating function. The adapter does not own the client; the client must outlive it.
+ */
+class async_http_client
+{
+public:
+    using request_signature = void(lux::net::base::http_request_result);
+
+public:
+    async_http_client(boost::asio::any_io_executor exe, lux::net::base::http_client& client)
+        : exe_{lux::move(exe)}, client_{client}
+    {
+    }
+
+public:
+    /**
+     * @brief Sends an HTTP request.
+     * @param request The HTTP request to send.
+     * Completes with the response or with the error that prevented receiving it.
+     */
+    template <boost::asio::completion_token_for<request_signature> CompletionToken>
+    auto async_request(const lux::net::base::http_request& request, CompletionToken&& token)
+    {
+        return boost::asio::async_initiate<CompletionToken, request_signature>(
+            [this](auto handler, const lux::net::base::http_request& request) {
+                start_request(request, lux::move(handler));
+            },
+            token,
+            request);
+    }
+
+private:
+    template <typename Handler>
+    void start_request(const lux::net::base::http_request& request, Handler handler)
+    {
+        // http_client_handler_type is a copyable std::function, so the (possibly move-only) handler is kept in
+        // a shared state allocated with the handler's allocator - asio's recycling allocator by default
+        const auto allocator = boost::asio::get_associated_allocator(handler,
+                                                                     boost::asio::recycling_allocator<void>{});
+        auto state = std::allocate_shared<Handler>(allocator, lux::move(handler));
+
+        client_.request(request, [exe = exe_, state](const lux::net::base::http_request_result& result) {
+            // The client may report errors synchronously, so the completion is always posted
+            boost::asio::post(exe, boost::asio::append(lux::move(*state), result));
+        });
+    }
+
+private:
+    boost::asio::any_io_executor exe_;
+    lux::net::base::http_client& client_;
+};
+
+} // namespace lux::net
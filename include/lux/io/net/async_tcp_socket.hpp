@@ -0,0 +1,174 @@
+#pragma once
+
+#include <lux/fwd.hpp>
+#include <lux/io/net/base/endpoint.hpp>
+#include <lux/io/net/base/ssl.hpp>
+#include <lux/io/net/base/tcp_socket.hpp>
+
+#include <lux/support/move.hpp>
+
+#include <boost/asio/any_completion_handler.hpp>
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/async_result.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <span>
+#include <system_error>
+#include <vector>
+
+namespace lux::net {
+
+/**
+ * @brief Completion token based adapter of a lux TCP socket.
+ *
+ * Turns the handler driven tcp_socket into asio style asynchronous operations, so they can be used with
+ * boost::asio::use_awaitable (co_await), boost::asio::deferred or plain callbacks. Completion handlers are
+ * always invoked through their associated executor (the socket executor by default) and never from within
+ * the initiating function. Pending handlers are type-erased with boost::asio::any_completion_handler, which
+ * allocates through the handler's associated allocator, so awaitable operations reuse asio's per-thread
+ * recycled memory instead of allocating std::function callback chains.
+ *
+ * Data received while a read is pending is copied straight into its buffer; data received while no read is
+ * pending is buffered until the next async_read_some() call, up to tcp_socket_config::buffer.max_unread_size.
+ * At most one connect and one read operation can be pending at a time; sends can be queued.
+ */
+class async_tcp_socket : private lux::net::base::tcp_socket_handler
+{
+public:
+    using connect_signature = void(std::error_code);
+    using read_signature = void(std::error_code, std::size_t);
+    using send_signature = void(std::error_code);
+
+public:
+    async_tcp_socket(boost::asio::any_io_executor exe,
+                     lux::net::base::socket_factory& socket_factory,
+                     const lux::net::base::tcp_socket_config& config);
+
+    async_tcp_socket(boost::asio::any_io_executor exe,
+                     lux::net::base::socket_factory& socket_factory,
+                     const lux::net::base::tcp_socket_config& config,
+                     lux::net::base::ssl_context& ssl_context);
+
+    /**
+     * @brief Disconnects the socket; pending operations complete with std::errc::operation_canceled.
+     */
+    ~async_tcp_socket();
+
+    async_tcp_socket(const async_tcp_socket&) = delete;
+    async_tcp_socket& operator=(const async_tcp_socket&) = delete;
+    async_tcp_socket(async_tcp_socket&&) = delete;
+    async_tcp_socket& operator=(async_tcp_socket&&) = delete;
+
+public:
+    /**
+     * @brief Connects to the given endpoint.
+     * Completes when the connection is established or when the socket gives up (including reconnect attempts
+     * configured in tcp_socket_config::reconnect).
+     */
+    template <boost::asio::completion_token_for<connect_signature> CompletionToken>
+    auto async_connect(const lux::net::base::endpoint& endpoint, CompletionToken&& token)
+    {
+        return boost::asio::async_initiate<CompletionToken, connect_signature>(
+            [this](auto handler, const lux::net::base::endpoint& endpoint) {
+                start_connect(endpoint, lux::move(handler));
+            },
+            token,
+            endpoint);
+    }
+
+    /**
+     * @brief Resolves the host name and connects to the first reachable endpoint.
+     */
+    template <boost::asio::completion_token_for<connect_signature> CompletionToken>
+    auto async_connect(const lux::net::base::hostname_endpoint& endpoint, CompletionToken&& token)
+    {
+        return boost::asio::async_initiate<CompletionToken, connect_signature>(
+            [this](auto handler, const lux::net::base::hostname_endpoint& endpoint) {
+                start_connect(endpoint, lux::move(handler));
+            },
+            token,
+            endpoint);
+    }
+
+    /**
+     * @brief Reads at least one byte into the buffer.
+     * @param buffer Destination buffer; it must stay valid until the operation completes.
+     * Completes with the number of bytes copied, or with the disconnect reason once the connection is lost.
+     */
+    template <boost::asio::completion_token_for<read_signature> CompletionToken>
+    auto async_read_some(std::span<std::byte> buffer, CompletionToken&& token)
+    {
+        return boost::asio::async_initiate<CompletionToken, read_signature>(
+            [this](auto handler, std::span<std::byte> buffer) { start_read(buffer, lux::move(handler)); },
+            token,
+            buffer);
+    }
+
+    /**
+     * @brief Sends the data.
+     * @param data Data to send; it is copied by the underlying socket before this function returns.
+     * Completes once the data has been written to the connection.
+     */
+    template <boost::asio::completion_token_for<send_signature> CompletionToken>
+    auto async_send(std::span<const std::byte> data, CompletionToken&& token)
+    {
+        return boost::asio::async_initiate<CompletionToken, send_signature>(
+            [this](auto handler, std::span<const std::byte> data) { start_send(data, lux::move(handler)); },
+            token,
+            data);
+    }
+
+    /**
+     * @brief Disconnects the socket; pending operations complete with the disconnect error.
+     * @param send_pending If true, sends any pending data before closing.
+     */
+    std::error_code disconnect(bool send_pending);
+
+    bool is_connected() const;
+
+    /**
+     * @brief Returns the underlying socket (e.g. to query endpoints).
+     */
+    lux::net::base::tcp_socket& socket() noexcept
+    {
+        return *socket_;
+    }
+
+private:
+    using connect_handler = boost::asio::any_completion_handler<connect_signature>;
+    using read_handler = boost::asio::any_completion_handler<read_signature>;
+    using send_handler = boost::asio::any_completion_handler<send_signature>;
+
+    void start_connect(const lux::net::base::endpoint& endpoint, connect_handler handler);
+    void start_connect(const lux::net::base::hostname_endpoint& endpoint, connect_handler handler);
+    void start_read(std::span<std::byte> buffer, read_handler handler);
+    void start_send(std::span<const std::byte> data, send_handler handler);
+
+    void on_connect_started(const std::error_code& ec, connect_handler handler);
+    std::size_t consume_received_data(std::span<std::byte> buffer);
+    void fail_pending_operations(const std::error_code& ec, bool include_connect);
+
+private:
+    // lux::net::base::tcp_socket_handler implementation
+    void on_connected(lux::net::base::tcp_socket& socket) override;
+    void on_disconnected(lux::net::base::tcp_socket& socket, const std::error_code& ec, bool will_reconnect) override;
+    void on_data_read(lux::net::base::tcp_socket& socket, const std::span<const std::byte>& data) override;
+    void on_data_sent(lux::net::base::tcp_socket& socket, const std::span<const std::byte>& data) override;
+
+private:
+    boost::asio::any_io_executor exe_;
+    lux::net::base::tcp_socket_ptr socket_;
+
+    connect_handler connect_handler_;
+    read_handler read_handler_;
+    std::span<std::byte> read_buffer_;
+    std::deque<send_handler> send_handlers_;
+
+    std::vector<std::byte> received_data_;
+    std::size_t received_offset_{0};
+    std::size_t max_unread_size_{0};
+    std::error_code read_error_;
+};
+
+} // namespace lux::net
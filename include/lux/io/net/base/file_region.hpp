@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <system_error>
+
+namespace lux::net::base {
+
+/**
+ * Read-only file opened to be sent over a socket. It stays open as long as any region of it is being sent.
+ */
+class file_source
+{
+public:
+#ifdef _WIN32
+    using native_handle_type = void*;
+#else
+    using native_handle_type = int;
+#endif
+
+public:
+    virtual ~file_source() = default;
+
+public:
+    /**
+     * Gets the native handle of the open file.
+     */
+    virtual native_handle_type native_handle() const noexcept = 0;
+
+    /**
+     * Gets the contents of the file if they are loaded into memory.
+     * @return The whole file, or an empty span if the file is not loaded.
+     */
+    virtual std::span<const std::byte> loaded() const noexcept = 0;
+
+    /**
+     * Gets the size of the file in bytes.
+     */
+    virtual std::uint64_t size() const noexcept = 0;
+
+    /**
+     * Reads exactly buffer.size() bytes starting at the offset, without moving the file position.
+     * @param offset The offset in the file to read from.
+     * @param buffer The buffer to fill.
+     * @return An error code indicating success or failure.
+     */
+    virtual std::error_code read(std::uint64_t offset, std::span<std::byte> buffer) const = 0;
+};
+
+/**
+ * Contiguous region of a file to be sent.
+ */
+struct file_region
+{
+    std::shared_ptr<const file_source> source;
+    std::uint64_t offset{0};
+    std::uint64_t size{0};
+};
+
+} // namespace lux::net::base
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <lux/io/net/base/file_region.hpp>
 #include <lux/io/net/base/http_status.hpp>
 #include <lux/support/move.hpp>
 #include <lux/support/container.hpp>
 
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -58,6 +60,19 @@ public:
     void set_body(std::string body)
     {
         body_ = lux::move(body);
+        file_body_.reset();
+    }
+
+    const std::optional<file_region>& file_body() const noexcept
+    {
+        return file_body_;
+    }
+
+    // Sends the region of the file as the body in place of the string body, without loading it into memory
+    void set_file_body(file_region region)
+    {
+        body_.clear();
+        file_body_ = lux::move(region);
     }
 
     std::string_view header(std::string_view key) const
@@ -194,6 +209,7 @@ private:
     unsigned version_ = 11; // HTTP/1.1 by default
     headers_type headers_;
     std::string body_;
+    std::optional<file_region> file_body_;
 };
 
 } // namespace lux::net::base
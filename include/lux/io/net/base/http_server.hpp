@@ -5,9 +5,11 @@
 #include <lux/io/net/base/http_request.hpp>
 #include <lux/io/net/base/tcp_acceptor.hpp>
 
+#include <chrono>
 #include <memory>
 #include <optional>
 #include <system_error>
+#include <tuple>
 
 namespace lux::net::base {
 
@@ -17,6 +19,30 @@ struct http_server_config
      * TCP acceptor configuration for incoming connections.
      */
     lux::net::base::tcp_acceptor_config acceptor_config{};
+
+    /**
+     * Maximum time to wait for the next request on an open connection (including the first one).
+     * Zero disables the timeout.
+     */
+    std::chrono::milliseconds idle_timeout{0};
+
+    /**
+     * Maximum time to receive the complete request header, measured from its first received byte.
+     * Zero disables the timeout.
+     */
+    std::chrono::milliseconds header_read_timeout{0};
+
+    /**
+     * Maximum time to receive the complete request body, measured from the end of the header.
+     * Zero disables the timeout.
+     */
+    std::chrono::milliseconds body_read_timeout{0};
+
+    /**
+     * Maximum time for a pending response write to complete. Overrides acceptor_config.socket_timeout.write
+     * when set. Zero keeps the acceptor setting.
+     */
+    std::chrono::milliseconds write_timeout{0};
 };
 
 class http_server
@@ -75,6 +101,19 @@ public:
      * @return The generated HTTP response.
      */
     virtual lux::net::base::http_response handle_request(const lux::net::base::http_request& request) = 0;
+
+    /**
+     * Tells whether handling the request may block, e.g. on the file system.
+     * Such requests are handled on a separate thread pool, so the other connections of the same thread are served in
+     * the meantime; handle_request must then be safe to call from there. Responses are still sent in request order.
+     * @param request The incoming HTTP request.
+     * @return True to handle the request off the thread of its connection.
+     */
+    virtual bool may_block(const lux::net::base::http_request& request)
+    {
+        std::ignore = request;
+        return false;
+    }
 };
 
 } // namespace lux::net::base
\ No newline at end of file
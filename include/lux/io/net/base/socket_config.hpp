@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <cstddef>
 
 namespace lux::net::base {
@@ -20,6 +21,27 @@ struct socket_buffer_config
      * Size of read buffer to preallocate for reading data.
      */
     std::size_t read_buffer_size{8 * 1024}; // 8 KB
+
+    /**
+     * Most received data async_tcp_socket buffers while no read is pending. Beyond it the connection is closed and
+     * reads fail with std::errc::no_buffer_space once the buffered data is consumed. Zero disables the limit.
+     */
+    std::size_t max_unread_size{1024 * 1024}; // 1 MB
+};
+
+struct socket_timeout_config
+{
+    /**
+     * Disconnects the socket when nothing was received or sent for this long.
+     * Zero disables the timeout.
+     */
+    std::chrono::milliseconds idle{0};
+
+    /**
+     * Disconnects the socket when a pending write doesn't complete within this time.
+     * Zero disables the timeout.
+     */
+    std::chrono::milliseconds write{0};
 };
 
 } // namespace lux::net::base
\ No newline at end of file
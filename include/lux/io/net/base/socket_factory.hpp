@@ -5,6 +5,8 @@
 #include <lux/io/net/base/tcp_socket.hpp>
 #include <lux/io/net/base/udp_socket.hpp>
 
+#include <lux/io/time/base/timer.hpp>
+
 namespace lux::net::base {
 
 class socket_factory
@@ -61,6 +63,13 @@ public:
     virtual lux::net::base::tcp_acceptor_ptr create_ssl_tcp_acceptor(const lux::net::base::tcp_acceptor_config& config,
                                                                      lux::net::base::ssl_context& ssl_context,
                                                                      lux::net::base::tcp_acceptor_handler& handler) = 0;
+
+    /**
+     * Returns the timer factory used by the created sockets (reconnects, timeouts).
+     * It can be used for protocol-level timers that should share the same timer source.
+     * @return A reference to the timer factory.
+     */
+    virtual lux::time::base::timer_factory& timer_factory() = 0;
 };
 
 } // namespace lux::net::base
\ No newline at end of file
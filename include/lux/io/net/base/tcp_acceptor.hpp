@@ -27,6 +27,11 @@ struct tcp_acceptor_config
      * This structure holds various buffer-related settings for the TCP socket.
      */
     lux::net::base::socket_buffer_config socket_buffer{};
+
+    /**
+     * Timeout configuration for the accepted TCP sockets.
+     */
+    lux::net::base::socket_timeout_config socket_timeout{};
 };
 
 /**
@@ -2,9 +2,12 @@
 
 #include <lux/fwd.hpp>
 #include <lux/io/net/base/endpoint.hpp>
+#include <lux/io/net/base/file_region.hpp>
 #include <lux/io/net/base/socket_config.hpp>
 #include <lux/io/time/base/retry_policy.hpp>
+#include <lux/utils/memory_arena.hpp>
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <span>
@@ -35,7 +38,8 @@ struct tcp_socket_config
             .strategy = lux::time::base::retry_policy::backoff_strategy::exponential_backoff,
             .max_attempts = std::nullopt,
             .base_delay = std::chrono::milliseconds{1000},
-            .max_delay = std::chrono::milliseconds{30000}};
+            .max_delay = std::chrono::milliseconds{30000},
+            .budget = nullptr};
 
     } reconnect{};
 
@@ -78,6 +82,13 @@ public:
      */
     virtual std::error_code send(const std::span<const std::byte>& data) = 0;
 
+    /**
+     * Sends a chain of buffers to the connected endpoint as a single scatter/gather write, without copying it.
+     * The buffers are kept until sent and returned to their arena afterwards; on_data_sent is called for each of them.
+     * @param chain The buffers to send, e.g. produced by lux::chunked_buffer_writer.
+     */
+    virtual std::error_code send(lux::buffer_chain&& chain) = 0;
+
     /**
      * Checks if the socket is currently connected.
      * @return true if the socket is connected, false otherwise.
@@ -142,6 +153,12 @@ struct tcp_inbound_socket_config
      * This structure holds various buffer-related settings for the TCP socket.
      */
     socket_buffer_config buffer{};
+
+    /**
+     * Timeout configuration for the TCP socket.
+     * An expired timeout disconnects the socket with std::errc::timed_out.
+     */
+    socket_timeout_config timeout{};
 };
 
 class tcp_inbound_socket
@@ -162,6 +179,31 @@ public:
      */
     virtual std::error_code send(const std::span<const std::byte>& data) = 0;
 
+    /**
+     * Sends a chain of buffers to the connected endpoint as a single scatter/gather write, without copying it.
+     * The buffers are kept until sent and returned to their arena afterwards; on_data_sent is called for each of them.
+     * @param chain The buffers to send, e.g. produced by lux::chunked_buffer_writer.
+     */
+    virtual std::error_code send(lux::buffer_chain&& chain) = 0;
+
+    /**
+     * Sends a region of a file to the connected endpoint after the data queued before it.
+     * Files loaded into memory are written straight from memory. Other files are sent with sendfile(2) on plain TCP
+     * sockets where available, and otherwise read in chunks on a separate thread, so the socket's thread doesn't wait
+     * for the disk. on_data_sent is called once the whole region is sent, with its data if the file is loaded, or with
+     * an empty span otherwise.
+     * @param region The region of the file to send; the file is kept open until it's sent.
+     */
+    virtual std::error_code send_file(lux::net::base::file_region region) = 0;
+
+    /**
+     * Runs work that may block, e.g. on the file system, on the thread pool reading the files of send_file, then the
+     * completion on the socket's thread, so the other sockets of that thread are served in the meantime.
+     * @param work The work to run on the thread pool.
+     * @param completion Called on the socket's thread once the work is done, also if the socket was disconnected.
+     */
+    virtual void run_blocking(std::function<void()> work, std::function<void()> completion) = 0;
+
     /**
      * Starts reading data from the TCP socket.
      * This function initiates an asynchronous read operation.
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <lux/io/net/base/http_request.hpp>
+#include <lux/io/net/base/http_response.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace lux::net {
+
+enum class http_content_coding
+{
+    identity,
+    gzip,
+    deflate,
+};
+
+struct http_compression_config
+{
+    /**
+     * Compression is opt-in, responses are sent as-is unless enabled.
+     */
+    bool enabled{false};
+
+    /**
+     * Bodies smaller than this are sent as-is, compressing them rarely saves more than it costs.
+     */
+    std::size_t min_size{1024};
+
+    /**
+     * Compression level from 1 (fastest) to 9 (smallest).
+     */
+    int level{6};
+
+    /**
+     * Media types of the responses to compress. An entry ending with '/' matches all its subtypes, e.g. "text/".
+     * Already compressed formats like images or archives gain nothing and should not be listed.
+     */
+    std::vector<std::string> content_types{"text/",
+                                           "application/json",
+                                           "application/javascript",
+                                           "application/xml",
+                                           "image/svg+xml"};
+};
+
+/**
+ * Selects the content coding preferred by the client among the supported ones.
+ * @param accept_encoding The value of the Accept-Encoding request header.
+ * @return The coding with the highest quality value, gzip on a tie, or identity if no supported coding is accepted.
+ */
+http_content_coding negotiate_content_coding(std::string_view accept_encoding);
+
+/**
+ * Compresses the data with the content coding.
+ * The data is compressed in bounded steps through a compression context reused by the calling thread, so its large
+ * internal buffers are allocated only once per thread.
+ * @param coding The content coding, gzip or deflate.
+ * @param data The data to compress.
+ * @param level Compression level from 1 (fastest) to 9 (smallest).
+ * @return The compressed data, or std::nullopt if compression failed.
+ */
+std::optional<std::string> compress(http_content_coding coding, std::string_view data, int level);
+
+/**
+ * Compresses the response body if the client accepts a supported coding and the response qualifies according to the
+ * configuration. Sets Content-Encoding on success and adds Accept-Encoding to Vary for every response whose
+ * representation depends on it. A strong ETag of a compressed response is made weak, since it no longer describes the
+ * bytes sent. Responses that already have a Content-Encoding are left as is.
+ * @param request The request the response belongs to.
+ * @param response The response to compress.
+ * @param config The compression configuration.
+ * @return True if the body was compressed.
+ */
+bool compress_response(const lux::net::base::http_request& request,
+                       lux::net::base::http_response& response,
+                       const http_compression_config& config);
+
+} // namespace lux::net
@@ -3,13 +3,16 @@
 #include <lux/io/net/base/http_method.hpp>
 #include <lux/io/net/base/http_request.hpp>
 #include <lux/io/net/base/http_response.hpp>
+#include <lux/io/net/static_file_handler.hpp>
 
 #include <boost/container_hash/hash.hpp>
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace lux::net {
 
@@ -29,6 +32,15 @@ public:
      */
     void add_route(lux::net::base::http_method method, std::string_view target, handler_type handler);
 
+    /**
+     * Serves the files of a directory for GET requests below a path prefix, e.g. with the prefix "/assets" the
+     * request of "/assets/js/app.js" is served with the file "js/app.js" below the root directory.
+     * Exact routes take precedence over static routes; among static routes the longest matching prefix wins.
+     * @param prefix The path prefix, "/" serves the directory for all paths.
+     * @param config The configuration of the static file handler serving the directory.
+     */
+    void add_static_route(std::string_view prefix, const lux::net::static_file_handler_config& config);
+
     /**
      * Routes an incoming HTTP request to the appropriate handler.
      * @param request The incoming HTTP request.
@@ -36,6 +48,13 @@ public:
      */
     void route(const lux::net::base::http_request& request, lux::net::base::http_response& response) const;
 
+    /**
+     * Checks if the request is routed to a static route, which serves it from the file system.
+     * @param request The incoming HTTP request.
+     * @return True if routing the request serves a file.
+     */
+    bool serves_file(const lux::net::base::http_request& request) const;
+
 private:
     struct route_key
     {
@@ -56,7 +75,16 @@ private:
         }
     };
 
+    struct static_route
+    {
+        std::string prefix; // Without the trailing slash, empty for the root
+        std::unique_ptr<lux::net::static_file_handler> handler;
+    };
+
+    const static_route* find_static_route(std::string_view path) const;
+
     std::unordered_map<route_key, handler_type, route_key_hash> routes_;
+    std::vector<static_route> static_routes_; // Longest prefix first
 };
 
 } // namespace lux::net
\ No newline at end of file
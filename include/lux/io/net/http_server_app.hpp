@@ -7,6 +7,7 @@
 #include <lux/io/net/base/http_server.hpp>
 #include <lux/io/net/base/ssl.hpp>
 
+#include <lux/io/net/http_compression.hpp>
 #include <lux/io/net/http_router.hpp>
 
 #include <functional>
@@ -26,6 +27,11 @@ struct http_server_app_config
      * Name of the server to be used in the Server HTTP header.
      */
     std::string server_name{"LuxHTTPServer"};
+
+    /**
+     * Compression of the response bodies, disabled by default.
+     */
+    lux::net::http_compression_config compression{};
 };
 
 /**
@@ -93,6 +99,15 @@ public:
      */
     void del(std::string_view target, handler_type handler);
 
+    /**
+     * Serves the files of a directory for GET requests below a path prefix.
+     * Files are sent without copying them into the response, see lux::net::static_file_handler. The requests are
+     * handled off the thread of their connection, since they wait for the file system.
+     * @param prefix The path prefix, e.g. "/assets"; "/" serves the directory for all paths without another route.
+     * @param config The configuration of the static file handler, including the directory to serve.
+     */
+    void serve_static(std::string_view prefix, const lux::net::static_file_handler_config& config);
+
     /**
      * Sets a custom error handler to be invoked on server errors.
      * @param handler The function to handle server errors.
@@ -111,6 +126,7 @@ private:
     void on_server_stopped() override;
     void on_server_error(const std::error_code& ec) override;
     lux::net::base::http_response handle_request(const lux::net::base::http_request& request) override;
+    bool may_block(const lux::net::base::http_request& request) override;
 
 private:
     const lux::net::http_server_app_config config_;
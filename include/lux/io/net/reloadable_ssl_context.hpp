@@ -0,0 +1,65 @@
+#pragma once
+
+#include <lux/io/net/base/ssl.hpp>
+
+#include <memory>
+#include <mutex>
+
+namespace lux::net::detail {
+class servername_dispatcher;
+} // namespace lux::net::detail
+
+namespace lux::net {
+
+/**
+ * @brief Server SSL context whose certificate can be replaced while connections are being accepted.
+ *
+ * context() is passed to the acceptor or HTTPS server in place of a regular SSL context. During each handshake the
+ * connection is switched to the context that is current at that moment, so after reload() new handshakes present
+ * the new certificate, while established connections keep the context they were accepted with. OpenSSL keeps that
+ * context alive for as long as the connection uses it, so the replaced context may be released right after reload().
+ *
+ * Only the certificate, its chain and the private key are taken from the reloaded contexts; everything else is
+ * configured on context(). reload() may be called from any thread.
+ */
+class reloadable_ssl_context
+{
+public:
+    explicit reloadable_ssl_context(
+        std::shared_ptr<lux::net::base::ssl_context> initial,
+        lux::net::base::ssl_context::method method = lux::net::base::ssl_context::tls_server);
+    ~reloadable_ssl_context();
+
+    reloadable_ssl_context(const reloadable_ssl_context&) = delete;
+    reloadable_ssl_context& operator=(const reloadable_ssl_context&) = delete;
+
+public:
+    /**
+     * @brief Returns the context to be used by the acceptor.
+     */
+    lux::net::base::ssl_context& context() noexcept
+    {
+        return context_;
+    }
+
+    /**
+     * @brief Replaces the context used by new handshakes.
+     * @param ctx The context holding the new certificate and private key, must not be null.
+     */
+    void reload(std::shared_ptr<lux::net::base::ssl_context> ctx);
+
+    /**
+     * @brief Returns the context used by new handshakes.
+     */
+    std::shared_ptr<lux::net::base::ssl_context> current() const;
+
+private:
+    lux::net::base::ssl_context context_;
+
+    mutable std::mutex mutex_;
+    std::shared_ptr<lux::net::base::ssl_context> current_;
+
+    std::unique_ptr<lux::net::detail::servername_dispatcher> dispatcher_;
+};
+
+} // namespace lux::net
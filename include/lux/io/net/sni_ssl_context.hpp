@@ -0,0 +1,70 @@
+#pragma once
+
+#include <lux/io/net/base/ssl.hpp>
+#include <lux/io/net/reloadable_ssl_context.hpp>
+#include <lux/support/container.hpp>
+
+#include <memory>
+#include <string_view>
+
+namespace lux::net::detail {
+class servername_dispatcher;
+} // namespace lux::net::detail
+
+namespace lux::net {
+
+/**
+ * @brief Server SSL context selecting the certificate by the server name (SNI) the client asks for.
+ *
+ * context() is passed to the acceptor or HTTPS server in place of a regular SSL context, so a single listener can
+ * serve many domains. The host names are normalized into a hash table once on construction; during a handshake
+ * the server name is looked up without allocating and the connection is switched to the current context of the
+ * matching entry. Each entry is a reloadable_ssl_context, so the certificate of a single domain can be replaced
+ * while connections are being accepted; only current() of the entries is used.
+ *
+ * A host name like "*.example.com" matches a single label below example.com; an exact host name takes precedence
+ * over a wildcard. Host names are case-insensitive. Clients sending no server name, or one without a match, get
+ * the default context; without a default context their handshake fails with an unrecognized_name alert.
+ *
+ * As with reloadable_ssl_context, everything but the certificate, its chain and the private key is configured on
+ * context().
+ */
+class sni_ssl_context
+{
+public:
+    using context_ptr = std::shared_ptr<lux::net::reloadable_ssl_context>;
+
+    explicit sni_ssl_context(
+        const lux::string_unordered_map<context_ptr>& contexts,
+        context_ptr default_context = nullptr,
+        lux::net::base::ssl_context::method method = lux::net::base::ssl_context::tls_server);
+    ~sni_ssl_context();
+
+    sni_ssl_context(const sni_ssl_context&) = delete;
+    sni_ssl_context& operator=(const sni_ssl_context&) = delete;
+
+public:
+    /**
+     * @brief Returns the context to be used by the acceptor.
+     */
+    lux::net::base::ssl_context& context() noexcept
+    {
+        return context_;
+    }
+
+    /**
+     * @brief Finds the entry serving the server name.
+     * @param server_name The server name sent by the client, empty if none was sent.
+     * @return The matching entry, the default entry if none matches, or nullptr without a default context.
+     */
+    lux::net::reloadable_ssl_context* find(std::string_view server_name) const noexcept;
+
+private:
+    lux::net::base::ssl_context context_;
+    lux::string_unordered_map<context_ptr> contexts_;
+    context_ptr default_context_;
+
+    std::unique_ptr<lux::net::detail::servername_dispatcher> dispatcher_;
+};
+
+} // namespace lux::net
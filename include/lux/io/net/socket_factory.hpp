@@ -17,6 +17,13 @@ class socket_factory : public lux::net::base::socket_factory
 public:
     socket_factory(boost::asio::any_io_executor exe);
 
+    // Uses an external timer source (e.g. lux::time::timer_wheel) for all created sockets.
+    // The timer factory must outlive the socket factory and all created sockets.
+    socket_factory(boost::asio::any_io_executor exe, lux::time::base::timer_factory& timer_factory);
+
+    socket_factory(const socket_factory&) = delete;
+    socket_factory& operator=(const socket_factory&) = delete;
+
 public:
     // lux::net::base::socket_factory implementation
     lux::net::base::udp_socket_ptr create_udp_socket(const lux::net::base::udp_socket_config& config,
@@ -36,9 +43,12 @@ public:
                                                              lux::net::base::ssl_context& ssl_context,
                                                              lux::net::base::tcp_acceptor_handler& handler) override;
 
+    lux::time::base::timer_factory& timer_factory() override;
+
 private:
     boost::asio::any_io_executor executor_;
-    lux::time::timer_factory timer_factory_;
+    lux::time::timer_factory default_timer_factory_;
+    lux::time::base::timer_factory& timer_factory_;
 };
 
 } // namespace lux::net
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <lux/io/net/base/http_request.hpp>
+#include <lux/io/net/base/http_response.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace lux::net {
+
+struct static_file_handler_config
+{
+    /**
+     * Directory the files are served from. Symbolic links below it are followed as long as they stay within it.
+     */
+    std::filesystem::path root;
+
+    /**
+     * File served for requests of a directory. Empty disables serving directories.
+     */
+    std::string index_file{"index.html"};
+
+    /**
+     * Files up to this size are read into memory once and kept in the cache; larger files are opened for every
+     * request and sent straight from the file. Zero disables the cache.
+     * Cached files are updated when their size or modification time changes. The cache holds copies, so files may
+     * be changed in place while they are being served.
+     */
+    std::size_t cache_max_file_size{64 * 1024};
+
+    /**
+     * Total size of the cached files; the least recently used files are evicted beyond it.
+     */
+    std::size_t cache_max_size{16 * 1024 * 1024};
+
+    /**
+     * Value of the Cache-Control header of the served files. Empty omits the header.
+     */
+    std::string cache_control{};
+};
+
+struct static_file_cache_stats
+{
+    /** Files currently in the cache. */
+    std::size_t files{0};
+
+    /** Total size of the cached files in bytes. */
+    std::size_t bytes{0};
+};
+
+/**
+ * @brief Serves files from a directory.
+ *
+ * Responses carry the file as a file body, so the file is never copied into the response: cached files are sent from
+ * their copy in memory, other files from the open file, with sendfile(2) on plain TCP connections where available.
+ *
+ * Every response carries a strong ETag derived from the size, the modification time and, where the platform provides
+ * it, the inode of the file, and Last-Modified. Requests with a matching If-None-Match or If-Modified-Since get 304 Not Modified. A single byte range
+ * is served as 206 Partial Content, honoring If-Range; requests for multiple ranges get the whole file.
+ *
+ * Requests are served concurrently; the cache is shared by all of them. Serving waits for the file system, so servers
+ * call it off the threads of their connections, see lux::net::base::http_server_handler::may_block.
+ */
+class static_file_handler
+{
+public:
+    explicit static_file_handler(const lux::net::static_file_handler_config& config);
+    ~static_file_handler();
+
+    static_file_handler(const static_file_handler&) = delete;
+    static_file_handler& operator=(const static_file_handler&) = delete;
+
+public:
+    /**
+     * Serves the file at the path below the root directory.
+     * Paths escaping the root directory, also through symbolic links, and files that don't exist, get 404 Not Found.
+     * @param request The request to serve; its conditional and Range headers are honored.
+     * @param path The percent-encoded path of the file relative to the root directory, e.g. "css/site.css".
+     * @param response The response to populate.
+     */
+    void serve(const lux::net::base::http_request& request,
+               std::string_view path,
+               lux::net::base::http_response& response) const;
+
+    /**
+     * Returns the current usage of the cache.
+     */
+    lux::net::static_file_cache_stats cache_stats() const;
+
+private:
+    class impl;
+    std::unique_ptr<impl> impl_;
+};
+
+} // namespace lux::net
@@ -15,7 +15,8 @@ class tcp_acceptor : public lux::net::base::tcp_acceptor
 public:
     tcp_acceptor(boost::asio::any_io_executor exe,
                  lux::net::base::tcp_acceptor_handler& handler,
-                 const lux::net::base::tcp_acceptor_config& config);
+                 const lux::net::base::tcp_acceptor_config& config,
+                 lux::time::base::timer_factory& timer_factory);
     ~tcp_acceptor();
 
     tcp_acceptor(const tcp_acceptor&) = delete;
@@ -39,6 +40,7 @@ public:
     ssl_tcp_acceptor(boost::asio::any_io_executor exe,
                      lux::net::base::tcp_acceptor_handler& handler,
                      const lux::net::base::tcp_acceptor_config& config,
+                     lux::time::base::timer_factory& timer_factory,
                      lux::net::base::ssl_context& ssl_context);
     ~ssl_tcp_acceptor();
 
@@ -12,7 +12,8 @@ class tcp_inbound_socket : public lux::net::base::tcp_inbound_socket
 {
 public:
     tcp_inbound_socket(boost::asio::ip::tcp::socket&& socket,
-                       const lux::net::base::tcp_inbound_socket_config& config);
+                       const lux::net::base::tcp_inbound_socket_config& config,
+                       lux::time::base::timer_factory& timer_factory);
     ~tcp_inbound_socket();
 
     tcp_inbound_socket(const tcp_inbound_socket&) = delete;
@@ -24,6 +25,9 @@ public:
     // lux::net::base::tcp_inbound_socket implementation
     void set_handler(lux::net::base::tcp_inbound_socket_handler& handler) override;
     std::error_code send(const std::span<const std::byte>& data) override;
+    std::error_code send(lux::buffer_chain&& chain) override;
+    std::error_code send_file(lux::net::base::file_region region) override;
+    void run_blocking(std::function<void()> work, std::function<void()> completion) override;
     void read() override;
 
     std::error_code disconnect(bool send_pending) override;
@@ -40,7 +44,8 @@ class ssl_tcp_inbound_socket : public lux::net::base::tcp_inbound_socket
 {
 public:
     ssl_tcp_inbound_socket(boost::asio::ssl::stream<boost::asio::ip::tcp::socket>&& stream,
-                           const lux::net::base::tcp_inbound_socket_config& config);
+                           const lux::net::base::tcp_inbound_socket_config& config,
+                           lux::time::base::timer_factory& timer_factory);
 
     ~ssl_tcp_inbound_socket();
 
@@ -53,6 +58,9 @@ public:
     // lux::net::base::tcp_inbound_socket implementation
     void set_handler(lux::net::base::tcp_inbound_socket_handler& handler) override;
     std::error_code send(const std::span<const std::byte>& data) override;
+    std::error_code send(lux::buffer_chain&& chain) override;
+    std::error_code send_file(lux::net::base::file_region region) override;
+    void run_blocking(std::function<void()> work, std::function<void()> completion) override;
     void read() override;
     
     std::error_code disconnect(bool send_pending) override;
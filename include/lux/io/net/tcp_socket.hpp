@@ -28,6 +28,7 @@ public:
     std::error_code connect(const lux::net::base::hostname_endpoint& hostname_endpoint) override;
     std::error_code disconnect(bool send_pending) override;
     std::error_code send(const std::span<const std::byte>& data) override;
+    std::error_code send(lux::buffer_chain&& chain) override;
     bool is_connected() const override;
     std::optional<lux::net::base::endpoint> local_endpoint() const override;
     std::optional<lux::net::base::endpoint> remote_endpoint() const override;
@@ -58,6 +59,7 @@ public:
     std::error_code connect(const lux::net::base::hostname_endpoint& hostname_endpoint) override;
     std::error_code disconnect(bool send_pending) override;
     std::error_code send(const std::span<const std::byte>& data) override;
+    std::error_code send(lux::buffer_chain&& chain) override;
     bool is_connected() const override;
     std::optional<lux::net::base::endpoint> local_endpoint() const override;
     std::optional<lux::net::base::endpoint> remote_endpoint() const override;
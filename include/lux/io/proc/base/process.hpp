@@ -2,21 +2,174 @@
 
 #include <lux/support/result.hpp>
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <vector>
 
 namespace lux::proc::base {
 
+enum class output_stream
+{
+    out,
+    err
+};
+
+enum class output_framing
+{
+    /**
+     * Output is delivered in chunks as read from the pipe; chunk boundaries are arbitrary.
+     */
+    chunk,
+
+    /**
+     * Output is delivered line by line, without the trailing newline. The views point into the read buffer,
+     * so lines are not copied. A line longer than the buffer is delivered in buffer-sized parts, and an
+     * unterminated last line is delivered when the stream ends.
+     */
+    line
+};
+
+struct process_output_config
+{
+    /**
+     * Size of the read buffer in bytes. In line framing mode it is also the maximum length of a single line.
+     */
+    std::size_t buffer_size{8 * 1024};
+
+    /**
+     * How the output is split before it is passed to the handler.
+     */
+    output_framing framing{output_framing::chunk};
+};
+
+struct process_input_config
+{
+    /**
+     * If true, the standard input of the child is connected to a pipe fed with write_stdin().
+     * Otherwise the child inherits the standard input of the parent.
+     * Note: on POSIX, writing to a child that has exited raises SIGPIPE, which the application should ignore.
+     */
+    bool enabled{false};
+
+    /**
+     * Number of buffer chunks to preallocate for copied writes.
+     */
+    std::size_t initial_chunk_count{4};
+
+    /**
+     * Capacity of each preallocated buffer chunk in bytes.
+     */
+    std::size_t initial_chunk_size{1024};
+};
+
+/**
+ * Resource limits applied to the child at spawn (POSIX rlimits; ignored on Windows).
+ * A child exceeding a limit is stopped by the operating system, e.g. SIGXCPU for the CPU time or failing
+ * allocations for the address space.
+ */
+struct process_limits
+{
+    /**
+     * Maximum CPU time (RLIMIT_CPU).
+     */
+    std::optional<std::chrono::seconds> cpu_time;
+
+    /**
+     * Maximum size of the virtual address space in bytes (RLIMIT_AS).
+     */
+    std::optional<std::size_t> address_space;
+
+    /**
+     * Maximum number of open file descriptors (RLIMIT_NOFILE).
+     */
+    std::optional<std::size_t> open_files;
+};
+
+/**
+ * Resources used by a child process, reported when it exits.
+ */
+struct process_usage
+{
+    /**
+     * Time between the start of the process and its exit being noticed.
+     */
+    std::chrono::nanoseconds wall_time{0};
+
+    /**
+     * CPU time spent in user mode.
+     */
+    std::chrono::microseconds user_cpu_time{0};
+
+    /**
+     * CPU time spent in kernel mode.
+     */
+    std::chrono::microseconds system_cpu_time{0};
+
+    /**
+     * Peak resident set size in bytes.
+     */
+    std::size_t max_rss{0};
+
+    /**
+     * Number of block input operations (read operations on Windows).
+     */
+    std::size_t input_operations{0};
+
+    /**
+     * Number of block output operations (write operations on Windows).
+     */
+    std::size_t output_operations{0};
+};
+
+struct process_config
+{
+    /**
+     * Resource limits of the child.
+     */
+    process_limits limits{};
+
+    /**
+     * Standard input writing settings.
+     */
+    process_input_config in{};
+
+    /**
+     * Standard output reading settings.
+     */
+    process_output_config out{.buffer_size = 8 * 1024, .framing = output_framing::chunk};
+
+    /**
+     * Standard error reading settings.
+     */
+    process_output_config err{.buffer_size = 1024, .framing = output_framing::chunk};
+};
+
 class process_handler
 {
 public:
     virtual void on_process_error(const std::string& error_message) = 0;
-    virtual void on_process_exit(int exit_code) = 0;
+
+    /**
+     * Called once the child has exited and both its output streams reached the end, so all the output is
+     * delivered before the exit. Output of a paused stream holds the exit back until the stream is resumed.
+     */
+    virtual void on_process_exit(int exit_code, const process_usage& usage) = 0;
+
     virtual void on_process_stdout(std::string_view out) = 0;
     virtual void on_process_stderr(std::string_view err) = 0;
 
+    /**
+     * Called when data passed to write_stdin() has been written to the standard input pipe, in the order of
+     * the write_stdin() calls.
+     */
+    virtual void on_process_stdin_written(std::span<const std::byte> data) = 0;
+
 protected:
     virtual ~process_handler() = default;
 };
@@ -30,6 +183,37 @@ public:
     virtual lux::status start(const std::vector<std::string>& args) = 0;
     virtual void terminate() = 0;
     virtual bool is_running() const = 0;
+
+    /**
+     * Stops reading the given output stream (backpressure). Data produced meanwhile stays in the pipe, so a child
+     * that keeps writing eventually blocks. Lines already read but not yet delivered are kept until resumed, and so
+     * is the exit notification. May be called from within the output handler.
+     */
+    virtual void pause_output(output_stream stream) = 0;
+
+    /**
+     * Resumes delivering and reading the given output stream.
+     */
+    virtual void resume_output(output_stream stream) = 0;
+
+    /**
+     * Queues data to be written to the standard input of the child. The data is copied.
+     * @return An error code if the standard input is not enabled, already closed or the data is empty.
+     */
+    virtual std::error_code write_stdin(std::span<const std::byte> data) = 0;
+
+    /**
+     * Queues data to be written to the standard input of the child, taking ownership of the buffer (no copy).
+     * @return An error code if the standard input is not enabled, already closed or the data is empty.
+     */
+    virtual std::error_code write_stdin(std::vector<std::byte>&& data) = 0;
+
+    /**
+     * Closes the standard input of the child, so it sees the end of stream.
+     * @param send_pending If true, the pipe is closed once all queued data is written; otherwise the queued data
+     * is dropped and the pipe is closed immediately.
+     */
+    virtual std::error_code close_stdin(bool send_pending) = 0;
 };
 
 using process_ptr = std::unique_ptr<process>;
@@ -12,6 +12,10 @@ public:
     virtual lux::proc::base::process_ptr create_process(const std::string& executable_path,
                                                         lux::proc::base::process_handler& handler) = 0;
 
+    virtual lux::proc::base::process_ptr create_process(const std::string& executable_path,
+                                                        const lux::proc::base::process_config& config,
+                                                        lux::proc::base::process_handler& handler) = 0;
+
 protected:
     virtual ~process_factory() = default;
 };
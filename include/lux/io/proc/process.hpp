@@ -4,8 +4,11 @@
 
 #include <boost/asio/any_io_executor.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <string>
+#include <system_error>
 #include <vector>
 
 namespace lux::proc {
@@ -17,6 +20,11 @@ public:
             lux::proc::base::process_handler& handler,
             const std::string& exe_path);
 
+    process(boost::asio::any_io_executor executor,
+            lux::proc::base::process_handler& handler,
+            const std::string& exe_path,
+            const lux::proc::base::process_config& config);
+
     ~process();
 
     process(const process&) = delete;
@@ -29,6 +37,11 @@ public:
     lux::status start(const std::vector<std::string>& args) override;
     void terminate() override;
     bool is_running() const override;
+    void pause_output(lux::proc::base::output_stream stream) override;
+    void resume_output(lux::proc::base::output_stream stream) override;
+    std::error_code write_stdin(std::span<const std::byte> data) override;
+    std::error_code write_stdin(std::vector<std::byte>&& data) override;
+    std::error_code close_stdin(bool send_pending) override;
 
 private:
     class impl;
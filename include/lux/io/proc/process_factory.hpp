@@ -22,6 +22,10 @@ public:
     lux::proc::base::process_ptr create_process(const std::string& executable_path,
                                                 lux::proc::base::process_handler& handler) override;
 
+    lux::proc::base::process_ptr create_process(const std::string& executable_path,
+                                                const lux::proc::base::process_config& config,
+                                                lux::proc::base::process_handler& handler) override;
+
 private:
     boost::asio::any_io_executor executor_;
 };
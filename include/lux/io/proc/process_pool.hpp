@@ -0,0 +1,146 @@
+#pragma once
+
+#include <lux/fwd.hpp>
+#include <lux/io/time/base/retry_policy.hpp>
+#include <lux/support/result.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace lux::proc {
+
+struct process_pool_config
+{
+    /**
+     * Number of worker processes kept running.
+     */
+    std::size_t size{4};
+
+    /**
+     * Arguments passed to each worker process.
+     */
+    std::vector<std::string> args;
+
+    /**
+     * Maximum size of a single response frame in bytes. A worker sending a larger frame is considered broken
+     * and is restarted.
+     */
+    std::size_t max_frame_size{16 * 1024 * 1024};
+
+    /**
+     * Size of the buffer used to read responses from each worker.
+     */
+    std::size_t read_buffer_size{64 * 1024};
+
+    /**
+     * Retry policy for restarting workers that exited or failed to start.
+     * The backoff is reset once a restarted worker completes a job.
+     */
+    lux::time::base::retry_policy restart_policy{
+        .strategy = lux::time::base::retry_policy::backoff_strategy::exponential_backoff,
+        .max_attempts = std::nullopt,
+        .base_delay = std::chrono::milliseconds{100},
+        .max_delay = std::chrono::milliseconds{10000},
+        .budget = nullptr};
+};
+
+/**
+ * @brief Pool of pre-spawned worker processes executing jobs.
+ *
+ * Every worker runs one job at a time. A job is sent to the worker's standard input as a frame consisting of
+ * a 4-byte big-endian payload length followed by the payload, and the worker answers with a frame of the same
+ * format on its standard output. Jobs are queued while all workers are busy.
+ *
+ * A worker that exits (or violates the protocol) fails its current job with std::errc::io_error and is restarted
+ * according to the restart policy. Jobs are never re-sent to another worker, as they might not be idempotent.
+ * Job handlers are invoked on the executor of the process factory, and must not destroy the pool.
+ */
+class process_pool
+{
+public:
+    using job_result = std::expected<std::vector<std::byte>, std::error_code>;
+    using job_handler = std::function<void(job_result)>;
+
+public:
+    process_pool(lux::time::base::timer_factory& timer_factory,
+                 lux::proc::base::process_factory& process_factory,
+                 const std::string& exe_path,
+                 const process_pool_config& config);
+
+    ~process_pool();
+
+    process_pool(const process_pool&) = delete;
+    process_pool& operator=(const process_pool&) = delete;
+    process_pool(process_pool&&) = delete;
+    process_pool& operator=(process_pool&&) = delete;
+
+public:
+    /**
+     * @brief Spawns the worker processes.
+     * @return Error if any of the workers could not be started; no workers are left running in that case.
+     */
+    lux::status start();
+
+    /**
+     * @brief Terminates the workers. Running and queued jobs fail with std::errc::operation_canceled.
+     */
+    void stop();
+
+    /**
+     * @brief Queues a job and dispatches it to the first idle worker.
+     * @param payload Job payload; the buffer is passed to the worker without copying.
+     * @param handler Invoked with the response payload or the error that prevented receiving it.
+     * @return std::errc::no_such_process if the pool is not started or all workers are permanently lost,
+     * std::errc::message_size if the payload doesn't fit the frame length.
+     */
+    std::error_code submit(std::vector<std::byte> payload, job_handler handler);
+
+    /**
+     * @brief Returns the number of worker processes currently running.
+     */
+    std::size_t running_worker_count() const;
+
+    /**
+     * @brief Returns the number of running workers without a job.
+     */
+    std::size_t idle_worker_count() const;
+
+    /**
+     * @brief Returns the number of jobs waiting for a worker.
+     */
+    std::size_t queued_job_count() const;
+
+private:
+    class worker;
+
+    struct job
+    {
+        std::vector<std::byte> payload;
+        job_handler handler;
+    };
+
+    void dispatch_queued_jobs();
+    void on_worker_lost();
+    void fail_queued_jobs(std::error_code ec);
+
+private:
+    lux::time::base::timer_factory& timer_factory_;
+    lux::proc::base::process_factory& process_factory_;
+    const std::string exe_path_;
+    const process_pool_config config_;
+
+private:
+    std::vector<std::unique_ptr<worker>> workers_;
+    std::deque<job> queued_jobs_;
+    bool running_{false};
+};
+
+} // namespace lux::proc
@@ -1,95 +1,873 @@
 #pragma once
 
+#include <lux/support/assert.hpp>
 #include <lux/support/move.hpp>
-#include <lux/support/overload.hpp>
 
-#include <boost/asio/experimental/promise.hpp>
-#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/dispatch.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
+#include <functional>
+#include <future>
 #include <memory>
+#include <new>
+#include <optional>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace lux {
 
-template <typename T, typename Executor = boost::asio::any_io_executor, typename Allocator = std::allocator<void>>
-using base_promise = boost::asio::experimental::promise<void(std::exception_ptr, T), Executor, Allocator>;
+template <typename T>
+class future;
+
+template <typename T>
+class promise;
+
+namespace detail {
+
+struct future_access;
+
+template <typename T>
+using future_value_t = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+template <typename T>
+struct is_future : std::false_type
+{
+};
+
+template <typename T>
+struct is_future<lux::future<T>> : std::true_type
+{
+};
+
+template <typename T>
+struct unwrap_future
+{
+    using type = T;
+};
+
+template <typename T>
+struct unwrap_future<lux::future<T>>
+{
+    using type = T;
+};
+
+template <typename F, typename T>
+struct continuation_result
+{
+    using type = std::invoke_result_t<F, T>;
+};
+
+template <typename F>
+struct continuation_result<F, void>
+{
+    using type = std::invoke_result_t<F>;
+};
+
+// Value type of the future returned by then(); continuations returning a future are flattened
+template <typename F, typename T>
+using then_value_t = typename unwrap_future<std::remove_cvref_t<typename continuation_result<F, T>::type>>::type;
+
+/**
+ * Move-only type-erased continuation. Callables up to inline_size bytes are stored in place, so attaching a
+ * continuation doesn't allocate. That's enough for the continuation of then(executor, f) with an any_io_executor
+ * and a callable capturing a few pointers.
+ */
+class future_continuation
+{
+public:
+    static constexpr std::size_t inline_size = 128;
+
+    template <typename F>
+    static constexpr bool fits_inline = sizeof(F) <= inline_size && alignof(F) <= alignof(std::max_align_t) &&
+                                        std::is_nothrow_move_constructible_v<F>;
+
+public:
+    future_continuation() = default;
+
+    template <typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, future_continuation>)
+    future_continuation(F&& f)
+    {
+        using callable = std::remove_cvref_t<F>;
+
+        if constexpr (fits_inline<callable>)
+        {
+            ::new (static_cast<void*>(storage_)) callable(std::forward<F>(f));
+            vtable_ = &inline_vtable<callable>;
+        }
+        else
+        {
+            ::new (static_cast<void*>(storage_)) callable*(new callable(std::forward<F>(f)));
+            vtable_ = &heap_vtable<callable>;
+        }
+    }
+
+    ~future_continuation()
+    {
+        reset();
+    }
+
+    future_continuation(future_continuation&& other) noexcept
+    {
+        move_from(other);
+    }
+
+    future_continuation& operator=(future_continuation&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            move_from(other);
+        }
+        return *this;
+    }
+
+    future_continuation(const future_continuation&) = delete;
+    future_continuation& operator=(const future_continuation&) = delete;
+
+public:
+    explicit operator bool() const noexcept
+    {
+        return vtable_ != nullptr;
+    }
+
+    void operator()()
+    {
+        LUX_ASSERT(vtable_, "Continuation must not be empty");
+        vtable_->invoke(storage_);
+    }
+
+private:
+    struct vtable
+    {
+        void (*invoke)(void* storage);
+        void (*move)(void* dst, void* src) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template <typename F>
+    static constexpr vtable inline_vtable{
+        [](void* storage) { (*static_cast<F*>(storage))(); },
+        [](void* dst, void* src) noexcept {
+            ::new (dst) F(lux::move(*static_cast<F*>(src)));
+            static_cast<F*>(src)->~F();
+        },
+        [](void* storage) noexcept { static_cast<F*>(storage)->~F(); }};
+
+    template <typename F>
+    static constexpr vtable heap_vtable{
+        [](void* storage) { (**static_cast<F**>(storage))(); },
+        [](void* dst, void* src) noexcept { ::new (dst) F*(*static_cast<F**>(src)); },
+        [](void* storage) noexcept { delete *static_cast<F**>(storage); }};
+
+    void reset() noexcept
+    {
+        if (vtable_)
+        {
+            vtable_->destroy(storage_);
+            vtable_ = nullptr;
+        }
+    }
+
+    void move_from(future_continuation& other) noexcept
+    {
+        if (other.vtable_)
+        {
+            other.vtable_->move(storage_, other.storage_);
+            vtable_ = std::exchange(other.vtable_, nullptr);
+        }
+    }
+
+private:
+    alignas(std::max_align_t) std::byte storage_[inline_size];
+    const vtable* vtable_{nullptr};
+};
 
 /**
- * @brief A simplified promise wrapper for asynchronous operations that handle exceptions by rethrowing.
+ * Shared state of a promise/future pair. Synchronization is a single atomic status: the producer publishes the
+ * result, the consumer publishes the continuation, and whichever comes second runs the continuation.
+ */
+template <typename T>
+class future_state
+{
+public:
+    bool is_ready() const noexcept
+    {
+        return status_.load(std::memory_order_acquire) == status::ready;
+    }
+
+    void wait() const noexcept
+    {
+        for (auto current = status_.load(std::memory_order_acquire); current != status::ready;
+             current = status_.load(std::memory_order_acquire))
+        {
+            status_.wait(current, std::memory_order_acquire);
+        }
+    }
+
+    template <typename... Args>
+    void set_value(Args&&... args)
+    {
+        value_.emplace(std::forward<Args>(args)...);
+        complete();
+    }
+
+    void set_exception(std::exception_ptr exception)
+    {
+        LUX_ASSERT(exception, "Exception must not be null");
+        exception_ = lux::move(exception);
+        complete();
+    }
+
+    void set_continuation(future_continuation continuation)
+    {
+        LUX_ASSERT(!continuation_, "Future can have only one continuation");
+        continuation_ = lux::move(continuation);
+
+        auto expected = status::pending;
+        if (!status_.compare_exchange_strong(expected,
+                                             status::continuation_set,
+                                             std::memory_order_acq_rel,
+                                             std::memory_order_acquire))
+        {
+            // The result is already there - run the continuation right away
+            run_continuation();
+        }
+    }
+
+    // Accessible only once the state is ready
+    const std::exception_ptr& exception() const noexcept
+    {
+        return exception_;
+    }
+
+    future_value_t<T>& value() noexcept
+    {
+        LUX_ASSERT(value_.has_value(), "Future has no value");
+        return *value_;
+    }
+
+private:
+    enum class status : std::uint8_t
+    {
+        pending,
+        continuation_set,
+        ready
+    };
+
+    void complete()
+    {
+        const auto previous = status_.exchange(status::ready, std::memory_order_acq_rel);
+        LUX_ASSERT(previous != status::ready, "Promise already satisfied");
+
+        status_.notify_all();
+
+        if (previous == status::continuation_set)
+        {
+            run_continuation();
+        }
+    }
+
+    void run_continuation()
+    {
+        // Captured resources (e.g. the next promise) are released as soon as the continuation has run
+        auto continuation = lux::move(continuation_);
+        continuation();
+    }
+
+private:
+    std::atomic<status> status_{status::pending};
+    std::optional<future_value_t<T>> value_;
+    std::exception_ptr exception_;
+    future_continuation continuation_;
+};
+
+} // namespace detail
+
+/**
+ * @brief Consumer side of a single-shot asynchronous result.
  *
- * @tparam T The type of the value to be delivered when the promise is ready.
- * @tparam Executor The executor type used for asynchronous operations. Defaults to boost::asio::any_io_executor.
- * @tparam Allocator The allocator type used for memory management. Defaults to std::allocator<void>.
+ * A future is move-only and accepts at most one continuation. Continuations attached with then() run on the thread
+ * that satisfies the promise (or immediately, if the result is already available); continuations attached with
+ * then(executor, ...) are dispatched to the given executor. Exceptions skip the continuations and propagate to
+ * the futures returned by then().
  *
- * @note This class wraps a base promise that uses a completion signature of void(std::exception_ptr, T). If an
- * exception occurs, it is rethrown to the caller (e.g. to the exection context event loop).
+ * @tparam T Value type; void for futures without a value.
  */
-template <typename T, typename Executor = boost::asio::any_io_executor, typename Allocator = std::allocator<void>>
-class promise
+template <typename T>
+class future
 {
 public:
-    using base_promise_type = lux::base_promise<T, Executor, Allocator>;
+    using value_type = T;
 
-    promise(base_promise_type&& base) : promise_holder_{lux::move(base)}
+public:
+    future() = default;
+
+    future(future&&) noexcept = default;
+    future& operator=(future&&) noexcept = default;
+    future(const future&) = delete;
+    future& operator=(const future&) = delete;
+
+public:
+    /**
+     * @brief Checks if the future refers to a shared state (it was not default constructed or consumed).
+     */
+    bool valid() const noexcept
     {
+        return state_ != nullptr;
     }
 
-    template <typename U>
-    promise(U&& ready_value) : promise_holder_{std::forward<U>(ready_value)}
+    /**
+     * @brief Checks if the result (value or exception) is available.
+     */
+    bool is_ready() const noexcept
     {
+        LUX_ASSERT(valid(), "Future is not valid");
+        return state_->is_ready();
     }
 
-    // Wait for the promise to become ready and invoke the handler with the result.
-    template <typename Handler>
-    void then(Handler&& handler)
+    /**
+     * @brief Waits for the result and returns it. The future is consumed.
+     * @note Blocks the calling thread; it must not be called from the thread that is expected to satisfy the
+     * promise (e.g. the only thread running the io_context).
+     * @throws The exception stored in the future.
+     */
+    T get()
     {
-        if (auto* base = std::get_if<base_promise_type>(&promise_holder_))
+        LUX_ASSERT(valid(), "Future is not valid");
+
+        const auto state = lux::move(state_);
+        state->wait();
+
+        if (state->exception())
         {
-            then_impl(*base, std::forward<Handler>(handler));
+            std::rethrow_exception(state->exception());
         }
-        else if (auto* value = std::get_if<T>(&promise_holder_))
+
+        if constexpr (!std::is_void_v<T>)
         {
-            then_impl(*value, std::forward<Handler>(handler));
+            return lux::move(state->value());
         }
     }
 
-    T get()
+    /**
+     * @brief Attaches a continuation invoked with the value. The future is consumed.
+     * @param f Callable taking T (or nothing for future<void>). It may return a value, void or another future.
+     * @return Future of the continuation result.
+     */
+    template <typename F>
+    auto then(F&& f) -> future<detail::then_value_t<F, T>>
     {
-        T value;
-        then([&value](T v) mutable { value = lux::move(v); });
-        return value;
+        LUX_ASSERT(valid(), "Future is not valid");
+
+        using result_type = detail::then_value_t<F, T>;
+
+        promise<result_type> next;
+        auto result = next.get_future();
+
+        auto* state = state_.get();
+        state->set_continuation(
+            [state_ptr = lux::move(state_), next = lux::move(next), f = std::forward<F>(f)]() mutable {
+                run_continuation(*state_ptr, next, f);
+            });
+
+        return result;
     }
 
-    bool resolved() const noexcept
+    /**
+     * @brief Attaches a continuation that is dispatched to the executor. The future is consumed.
+     * @param executor Executor on which the continuation runs.
+     * @param f Callable taking T (or nothing for future<void>). It may return a value, void or another future.
+     * @return Future of the continuation result.
+     */
+    template <typename Executor, typename F>
+    auto then(const Executor& executor, F&& f) -> future<detail::then_value_t<F, T>>
     {
-        return std::holds_alternative<T>(promise_holder_);
+        LUX_ASSERT(valid(), "Future is not valid");
+
+        using result_type = detail::then_value_t<F, T>;
+
+        promise<result_type> next;
+        auto result = next.get_future();
+
+        auto* state = state_.get();
+        state->set_continuation([executor,
+                                 state_ptr = lux::move(state_),
+                                 next = lux::move(next),
+                                 f = std::forward<F>(f)]() mutable {
+            boost::asio::dispatch(executor,
+                                  [state_ptr = lux::move(state_ptr), next = lux::move(next), f = lux::move(f)]() mutable {
+                                      run_continuation(*state_ptr, next, f);
+                                  });
+        });
+
+        return result;
     }
 
 private:
-    template <typename Handler>
-    auto then_impl(base_promise_type& base, Handler&& handler)
+    template <typename U>
+    friend class future;
+
+    template <typename U>
+    friend class promise;
+
+    friend struct detail::future_access;
+
+    explicit future(std::shared_ptr<detail::future_state<T>> state) : state_{lux::move(state)}
+    {
+    }
+
+    template <typename U, typename F>
+    static void run_continuation(detail::future_state<T>& state, promise<U>& next, F& f)
     {
-        base([handler = std::forward<Handler>(handler)](std::exception_ptr eptr, T value) mutable {
-            if (eptr)
+        if (state.exception())
+        {
+            next.set_exception(state.exception());
+            return;
+        }
+
+        try
+        {
+            if constexpr (std::is_void_v<T>)
             {
-                std::rethrow_exception(eptr);
+                complete_with(next, [&f]() -> decltype(auto) { return std::invoke(f); });
             }
-            handler(lux::move(value));
-        });
+            else
+            {
+                complete_with(next, [&f, &state]() -> decltype(auto) { return std::invoke(f, lux::move(state.value())); });
+            }
+        }
+        catch (...)
+        {
+            next.set_exception(std::current_exception());
+        }
+    }
+
+    template <typename U, typename Invoke>
+    static void complete_with(promise<U>& next, Invoke&& invoke)
+    {
+        using invoke_result = std::remove_cvref_t<decltype(invoke())>;
+
+        if constexpr (std::is_void_v<invoke_result>)
+        {
+            invoke();
+            next.set_value();
+        }
+        else if constexpr (detail::is_future<invoke_result>::value)
+        {
+            // Flatten future<future<U>> by forwarding the inner result
+            invoke_result inner = invoke();
+            inner.state_->set_continuation(
+                [inner_state = lux::move(inner.state_), next = lux::move(next)]() mutable {
+                    forward_result(*inner_state, next);
+                });
+        }
+        else
+        {
+            next.set_value(invoke());
+        }
     }
 
-    template <typename Handler>
-    void then_impl(T& value, Handler&& handler)
+    template <typename U>
+    static void forward_result(detail::future_state<U>& state, promise<U>& next)
+    {
+        if (state.exception())
+        {
+            next.set_exception(state.exception());
+        }
+        else if constexpr (std::is_void_v<U>)
+        {
+            next.set_value();
+        }
+        else
+        {
+            next.set_value(lux::move(state.value()));
+        }
+    }
+
+private:
+    std::shared_ptr<detail::future_state<T>> state_;
+};
+
+/**
+ * @brief Producer side of a single-shot asynchronous result.
+ *
+ * The promise and its future share a single allocation. A promise destroyed without being satisfied stores
+ * std::future_error(std::future_errc::broken_promise) in the future. The promise is also an asio completion
+ * handler for the signature void(std::exception_ptr, T), so it can be passed directly to boost::asio::co_spawn.
+ *
+ * @tparam T Value type; void for promises without a value.
+ */
+template <typename T>
+class promise
+{
+public:
+    promise() : state_{std::make_shared<detail::future_state<T>>()}
+    {
+    }
+
+    ~promise()
+    {
+        abandon();
+    }
+
+    promise(promise&&) noexcept = default;
+    promise& operator=(promise&& other) noexcept
+    {
+        if (this != &other)
+        {
+            abandon();
+            state_ = lux::move(other.state_);
+            future_retrieved_ = other.future_retrieved_;
+        }
+        return *this;
+    }
+
+    promise(const promise&) = delete;
+    promise& operator=(const promise&) = delete;
+
+public:
+    /**
+     * @brief Returns the future associated with this promise. Can be called only once.
+     */
+    future<T> get_future()
+    {
+        LUX_ASSERT(state_, "Promise is already satisfied");
+        LUX_ASSERT(!future_retrieved_, "Future already retrieved");
+
+        future_retrieved_ = true;
+        return future<T>{state_};
+    }
+
+    template <typename U = T>
+        requires(!std::is_void_v<T> && std::is_constructible_v<T, U &&>)
+    void set_value(U&& value)
+    {
+        take_state()->set_value(std::forward<U>(value));
+    }
+
+    void set_value()
+        requires std::is_void_v<T>
+    {
+        take_state()->set_value();
+    }
+
+    void set_exception(std::exception_ptr exception)
     {
-        handler(lux::move(value));
+        take_state()->set_exception(lux::move(exception));
+    }
+
+    // Completion handler for boost::asio::co_spawn and other operations with an exception_ptr signature
+    template <typename U = T>
+        requires(!std::is_void_v<T>)
+    void operator()(std::exception_ptr exception, U&& value)
+    {
+        if (exception)
+        {
+            set_exception(lux::move(exception));
+        }
+        else
+        {
+            set_value(std::forward<U>(value));
+        }
+    }
+
+    void operator()(std::exception_ptr exception)
+        requires std::is_void_v<T>
+    {
+        if (exception)
+        {
+            set_exception(lux::move(exception));
+        }
+        else
+        {
+            set_value();
+        }
     }
 
 private:
-    std::variant<base_promise_type, T> promise_holder_;
+    void abandon()
+    {
+        if (state_)
+        {
+            take_state()->set_exception(
+                std::make_exception_ptr(std::future_error{std::future_errc::broken_promise}));
+        }
+    }
+
+    std::shared_ptr<detail::future_state<T>> take_state()
+    {
+        LUX_ASSERT(state_, "Promise is already satisfied");
+        return lux::move(state_);
+    }
+
+private:
+    std::shared_ptr<detail::future_state<T>> state_;
+    bool future_retrieved_{false};
 };
 
+/**
+ * @brief Creates a future that already holds the value.
+ */
+template <typename T>
+future<std::decay_t<T>> make_ready_future(T&& value)
+{
+    promise<std::decay_t<T>> p;
+    auto f = p.get_future();
+    p.set_value(std::forward<T>(value));
+    return f;
+}
+
+inline future<void> make_ready_future()
+{
+    promise<void> p;
+    auto f = p.get_future();
+    p.set_value();
+    return f;
+}
+
+/**
+ * @brief Creates a future that already holds the exception.
+ */
+template <typename T>
+future<T> make_exceptional_future(std::exception_ptr exception)
+{
+    promise<T> p;
+    auto f = p.get_future();
+    p.set_exception(lux::move(exception));
+    return f;
+}
+
+/**
+ * @brief Result of when_any(): index of the first completed future and its value.
+ */
+template <typename T>
+struct when_any_result
+{
+    std::size_t index;
+    T value;
+};
+
+template <>
+struct when_any_result<void>
+{
+    std::size_t index;
+};
+
+namespace detail {
+
+// Gives the combinators access to the shared state, so they observe values and exceptions without an extra future
+struct future_access
+{
+    template <typename T, typename F>
+    static void on_complete(future<T>&& f, F&& callback)
+    {
+        LUX_ASSERT(f.valid(), "Future is not valid");
+
+        auto* state = f.state_.get();
+        state->set_continuation(
+            [state_ptr = lux::move(f.state_), callback = std::forward<F>(callback)]() mutable { callback(*state_ptr); });
+    }
+};
+
+template <typename T>
+struct when_all_state
+{
+    using result_type = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+
+    explicit when_all_state(std::size_t count) : values(count), remaining{count}
+    {
+    }
+
+    std::vector<std::optional<future_value_t<T>>> values;
+    std::atomic<std::size_t> remaining;
+    std::atomic<bool> done{false};
+    lux::promise<result_type> promise;
+};
+
+template <typename... Ts>
+struct when_all_tuple_state
+{
+    std::tuple<std::optional<future_value_t<Ts>>...> values;
+    std::atomic<std::size_t> remaining{sizeof...(Ts)};
+    std::atomic<bool> done{false};
+    lux::promise<std::tuple<future_value_t<Ts>...>> promise;
+};
+
+template <typename T>
+struct when_any_state
+{
+    std::atomic<bool> done{false};
+    lux::promise<when_any_result<T>> promise;
+};
+
+// Returns true if the caller is the first one to complete the combined result
+template <typename State>
+bool try_fail(State& state, const std::exception_ptr& exception)
+{
+    if (state.done.exchange(true, std::memory_order_acq_rel))
+    {
+        return false;
+    }
+
+    state.promise.set_exception(exception);
+    return true;
+}
+
+template <typename... Ts, std::size_t... Is>
+void set_tuple_result(when_all_tuple_state<Ts...>& state, std::index_sequence<Is...>)
+{
+    state.promise.set_value(std::tuple<future_value_t<Ts>...>{lux::move(*std::get<Is>(state.values))...});
+}
+
+template <std::size_t I, typename... Ts, typename T>
+void attach_to_tuple(const std::shared_ptr<when_all_tuple_state<Ts...>>& state, future<T>&& f)
+{
+    future_access::on_complete(lux::move(f), [state](future_state<T>& completed) {
+        if (completed.exception())
+        {
+            try_fail(*state, completed.exception());
+            return;
+        }
+
+        std::get<I>(state->values).emplace(lux::move(completed.value()));
+
+        if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+            !state->done.exchange(true, std::memory_order_acq_rel))
+        {
+            set_tuple_result(*state, std::index_sequence_for<Ts...>{});
+        }
+    });
+}
+
+} // namespace detail
+
+/**
+ * @brief Waits for all futures.
+ * @return Future of the values in the input order (future<void> for void futures). The first exception fails the
+ * combined future right away; the results of the remaining futures are discarded.
+ */
+template <typename T>
+auto when_all(std::vector<future<T>> futures) -> future<typename detail::when_all_state<T>::result_type>
+{
+    if (futures.empty())
+    {
+        if constexpr (std::is_void_v<T>)
+        {
+            return make_ready_future();
+        }
+        else
+        {
+            return make_ready_future(std::vector<T>{});
+        }
+    }
+
+    // One allocation for the join state, shared by all continuations
+    auto state = std::make_shared<detail::when_all_state<T>>(futures.size());
+    auto result = state->promise.get_future();
+
+    for (std::size_t i = 0; i < futures.size(); ++i)
+    {
+        detail::future_access::on_complete(lux::move(futures[i]), [state, i](detail::future_state<T>& completed) {
+            if (completed.exception())
+            {
+                detail::try_fail(*state, completed.exception());
+                return;
+            }
+
+            state->values[i].emplace(lux::move(completed.value()));
+
+            if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1 ||
+                state->done.exchange(true, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
+            if constexpr (std::is_void_v<T>)
+            {
+                state->promise.set_value();
+            }
+            else
+            {
+                std::vector<T> values;
+                values.reserve(state->values.size());
+                for (auto& value : state->values)
+                {
+                    values.push_back(lux::move(*value));
+                }
+                state->promise.set_value(lux::move(values));
+            }
+        });
+    }
+
+    return result;
+}
+
+/**
+ * @brief Waits for all futures of possibly different types.
+ * @return Future of a tuple with the values (std::monostate for void futures). The first exception fails the
+ * combined future right away.
+ */
+template <typename... Ts>
+    requires(sizeof...(Ts) > 0)
+auto when_all(future<Ts>&&... futures) -> future<std::tuple<detail::future_value_t<Ts>...>>
+{
+    auto state = std::make_shared<detail::when_all_tuple_state<Ts...>>();
+    auto result = state->promise.get_future();
+
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        (detail::attach_to_tuple<Is>(state, lux::move(futures)), ...);
+    }(std::index_sequence_for<Ts...>{});
+
+    return result;
+}
+
+/**
+ * @brief Waits for the first of the futures.
+ * @param futures Futures to wait for; must not be empty.
+ * @return Future of the index and value of the first completed future. If the first completed future holds an
+ * exception, the combined future holds it as well.
+ */
+template <typename T>
+future<when_any_result<T>> when_any(std::vector<future<T>> futures)
+{
+    LUX_ASSERT(!futures.empty(), "when_any requires at least one future");
+
+    auto state = std::make_shared<detail::when_any_state<T>>();
+    auto result = state->promise.get_future();
+
+    for (std::size_t i = 0; i < futures.size(); ++i)
+    {
+        detail::future_access::on_complete(lux::move(futures[i]), [state, i](detail::future_state<T>& completed) {
+            if (completed.exception())
+            {
+                detail::try_fail(*state, completed.exception());
+                return;
+            }
+
+            if (state->done.exchange(true, std::memory_order_acq_rel))
+            {
+                return;
+            }
+
+            if constexpr (std::is_void_v<T>)
+            {
+                state->promise.set_value(when_any_result<void>{i});
+            }
+            else
+            {
+                state->promise.set_value(when_any_result<T>{i, lux::move(completed.value())});
+            }
+        });
+    }
 
+    return result;
+}
 
-} // namespace lux
\ No newline at end of file
+} // namespace lux
@@ -0,0 +1,26 @@
+#pragma once
+
+namespace lux::time::base {
+
+/**
+ * @brief An interface for a retry budget shared between retry executors.
+ *
+ * A budget limits the total rate of retries across all executors drawing from it, so that a widespread failure
+ * does not turn into a retry storm against the recovering peer. Implementations must be thread-safe, because
+ * executors sharing a budget might run on different executors (threads).
+ */
+class retry_budget
+{
+public:
+    /**
+     * @brief Tries to take permission for a single retry attempt.
+     *
+     * @return true if the attempt may be executed, false if the budget is currently exhausted.
+     */
+    virtual bool try_acquire() = 0;
+
+public:
+    virtual ~retry_budget() = default;
+};
+
+} // namespace lux::time::base
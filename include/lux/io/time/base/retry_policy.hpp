@@ -1,7 +1,10 @@
 #pragma once
 
+#include <lux/io/time/base/retry_budget.hpp>
+
 #include <chrono>
 #include <cstddef>
+#include <memory>
 #include <optional>
 
 namespace lux::time::base {
@@ -13,6 +16,8 @@ struct retry_policy
         fixed_delay,
         linear_backoff,
         exponential_backoff,
+        full_jitter,
+        decorrelated_jitter,
     };
 
     /**
@@ -21,6 +26,11 @@ struct retry_policy
      * - fixed_delay: The delay between attempts is constant.
      * - exponential_backoff: The delay increases exponentially with each attempt.
      * - linear_backoff: The delay increases linearly with each attempt.
+     * - full_jitter: The delay is uniformly random between one millisecond and the exponential backoff delay.
+     * - decorrelated_jitter: The delay is uniformly random between base_delay and three times the previous delay,
+     *   starting from base_delay before the first attempt.
+     * The jittered strategies spread retries of many clients over time, so they don't hit a recovering peer
+     * in lockstep.
      */
     backoff_strategy strategy{backoff_strategy::exponential_backoff};
 
@@ -41,6 +51,13 @@ struct retry_policy
      * This is used as a ceiling for the delay, regardless of the backoff strategy.
      */
     std::chrono::milliseconds max_delay{30000};
+
+    /**
+     * @brief Optional retry budget shared with other executors.
+     * Each retry attempt takes a token from the budget. When the budget is exhausted, the attempt is skipped
+     * (but still counted towards max_attempts) and the next one is scheduled according to the strategy.
+     */
+    std::shared_ptr<lux::time::base::retry_budget> budget;
 };
 
 } // namespace lux::time::base
\ No newline at end of file
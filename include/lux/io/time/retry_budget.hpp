@@ -0,0 +1,104 @@
+#pragma once
+
+#include <lux/io/time/base/retry_budget.hpp>
+
+#include <lux/support/assert.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace lux::time {
+
+struct token_bucket_retry_budget_config
+{
+    /** Maximum number of tokens (retries) that can be accumulated. The bucket starts full. */
+    std::size_t capacity{10};
+
+    /** Time needed to refill a single token. */
+    std::chrono::milliseconds refill_interval{1000};
+};
+
+/**
+ * @brief Thread-safe token bucket implementation of the retry budget.
+ *
+ * Every retry attempt consumes one token and tokens are refilled at a constant rate, so the executors sharing
+ * the budget can perform bursts of up to `capacity` retries, and no more than one retry per `refill_interval`
+ * on average afterwards.
+ */
+template <typename Clock>
+class basic_token_bucket_retry_budget : public lux::time::base::retry_budget
+{
+public:
+    explicit basic_token_bucket_retry_budget(const token_bucket_retry_budget_config& config = {})
+        : config_{config}, tokens_{config.capacity}, last_refill_{Clock::now()}
+    {
+        LUX_ASSERT(config_.refill_interval.count() > 0, "Retry budget refill interval must be positive");
+    }
+
+    basic_token_bucket_retry_budget(const basic_token_bucket_retry_budget&) = delete;
+    basic_token_bucket_retry_budget& operator=(const basic_token_bucket_retry_budget&) = delete;
+
+public:
+    // lux::time::base::retry_budget implementation
+    bool try_acquire() override
+    {
+        std::lock_guard lock{mutex_};
+
+        refill();
+        if (tokens_ == 0)
+        {
+            return false;
+        }
+
+        --tokens_;
+        return true;
+    }
+
+public:
+    /**
+     * @brief Returns the number of currently available tokens.
+     */
+    std::size_t available() const
+    {
+        std::lock_guard lock{mutex_};
+
+        refill();
+        return tokens_;
+    }
+
+private:
+    void refill() const
+    {
+        const auto now = Clock::now();
+        const auto refills = static_cast<std::size_t>((now - last_refill_) / config_.refill_interval);
+        if (refills == 0)
+        {
+            return;
+        }
+
+        tokens_ = std::min(config_.capacity, tokens_ + std::min(refills, config_.capacity));
+
+        if (tokens_ == config_.capacity)
+        {
+            // A full bucket doesn't bank time, otherwise tokens taken after a quiet period would be refilled at once
+            last_refill_ = now;
+        }
+        else
+        {
+            last_refill_ += config_.refill_interval * static_cast<std::chrono::milliseconds::rep>(refills);
+        }
+    }
+
+private:
+    const token_bucket_retry_budget_config config_;
+
+    mutable std::mutex mutex_;
+    mutable std::size_t tokens_;
+    mutable typename Clock::time_point last_refill_;
+};
+
+using token_bucket_retry_budget = basic_token_bucket_retry_budget<std::chrono::steady_clock>;
+
+} // namespace lux::time
@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <functional>
+#include <random>
 
 namespace lux::time {
 
@@ -52,9 +53,12 @@ public:
 
 private:
     void on_timer_expired();
-    std::chrono::milliseconds calculate_next_delay() const;
+    std::chrono::milliseconds calculate_next_delay();
     std::chrono::milliseconds calculate_linear_backoff_delay() const;
     std::chrono::milliseconds calculate_exponential_backoff_delay() const;
+    std::chrono::milliseconds calculate_full_jitter_delay();
+    std::chrono::milliseconds calculate_decorrelated_jitter_delay();
+    std::chrono::milliseconds random_delay(std::chrono::milliseconds min, std::chrono::milliseconds max);
 
 private:
     const lux::time::base::retry_policy policy_;
@@ -65,6 +69,11 @@ private:
     std::size_t attempts_{0};
     bool canceled_{false};
     lux::time::base::interval_timer_ptr timer_;
+
+private:
+    // Seeded per executor, so executors created at the same time don't draw the same jitter
+    std::minstd_rand random_engine_;
+    std::chrono::milliseconds previous_delay_{0};
 };
 
 } // namespace lux::time
\ No newline at end of file
@@ -0,0 +1,341 @@
+#pragma once
+
+#include <lux/io/time/base/timer.hpp>
+
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/basic_waitable_timer.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace lux::time {
+
+struct timer_wheel_config
+{
+    /** Wheel resolution. Timer deadlines are rounded up to the next tick. */
+    std::chrono::milliseconds tick{10};
+
+    /** Number of slots. Delays longer than tick * slot_count take additional rounds of the wheel. */
+    std::size_t slot_count{512};
+};
+
+namespace detail {
+
+// Intrusive list hook; slot lists are circular with a sentinel so link/unlink are O(1) and branch-free
+struct timer_wheel_node
+{
+    timer_wheel_node* prev{nullptr};
+    timer_wheel_node* next{nullptr};
+    std::size_t rounds{0};
+
+    bool linked() const noexcept
+    {
+        return next != nullptr;
+    }
+
+    void make_sentinel() noexcept
+    {
+        prev = this;
+        next = this;
+    }
+
+    bool empty() const noexcept
+    {
+        return next == this;
+    }
+
+    void push_back(timer_wheel_node& node) noexcept
+    {
+        node.prev = prev;
+        node.next = this;
+        prev->next = &node;
+        prev = &node;
+    }
+
+    void unlink() noexcept
+    {
+        prev->next = next;
+        next->prev = prev;
+        prev = nullptr;
+        next = nullptr;
+    }
+};
+
+template <typename Clock>
+class wheel_interval_timer;
+
+template <typename Clock>
+class timer_wheel_core : public std::enable_shared_from_this<timer_wheel_core<Clock>>
+{
+public:
+    using time_point = typename Clock::time_point;
+
+public:
+    timer_wheel_core(boost::asio::any_io_executor executor, const timer_wheel_config& config)
+        : timer_{executor}, tick_{config.tick}, slots_(config.slot_count)
+    {
+        LUX_ASSERT(tick_.count() > 0, "Timer wheel tick must be positive");
+        LUX_ASSERT(!slots_.empty(), "Timer wheel must have at least one slot");
+
+        for (auto& slot : slots_)
+        {
+            slot.make_sentinel();
+        }
+        expired_.make_sentinel();
+    }
+
+    ~timer_wheel_core()
+    {
+        LUX_ASSERT(linked_count_ == 0, "Timer wheel destroyed with scheduled timers");
+    }
+
+    timer_wheel_core(const timer_wheel_core&) = delete;
+    timer_wheel_core& operator=(const timer_wheel_core&) = delete;
+
+public:
+    void link(timer_wheel_node& node, time_point deadline)
+    {
+        if (node.linked())
+        {
+            unlink(node);
+        }
+
+        if (!ticking_)
+        {
+            start_ticking();
+        }
+
+        // Tick k (k >= 1) is processed at next_tick_ + (k - 1) * tick_; pick the first one not before the deadline
+        std::size_t ticks{1};
+        if (deadline > next_tick_)
+        {
+            const auto remaining = deadline - next_tick_;
+            ticks += static_cast<std::size_t>((remaining + tick_ - typename Clock::duration{1}) / tick_);
+        }
+
+        node.rounds = (ticks - 1) / slots_.size();
+        slots_[(current_slot_ + ticks) % slots_.size()].push_back(node);
+        ++linked_count_;
+    }
+
+    void unlink(timer_wheel_node& node) noexcept
+    {
+        if (!node.linked())
+        {
+            return;
+        }
+
+        node.unlink();
+        --linked_count_;
+    }
+
+    std::size_t scheduled_count() const noexcept
+    {
+        return linked_count_;
+    }
+
+private:
+    void start_ticking()
+    {
+        ticking_ = true;
+        next_tick_ = Clock::now() + tick_;
+        arm();
+    }
+
+    void arm()
+    {
+        timer_.expires_at(next_tick_);
+        timer_.async_wait([this](const boost::system::error_code& ec) {
+            if (ec)
+            {
+                // Be careful here - object might be destroyed before this callback is called.
+                return;
+            }
+
+            on_tick();
+        });
+    }
+
+    void on_tick();
+
+private:
+    boost::asio::basic_waitable_timer<Clock> timer_;
+    const std::chrono::milliseconds tick_;
+
+    std::vector<timer_wheel_node> slots_;
+    timer_wheel_node expired_;
+
+    std::size_t current_slot_{0};
+    std::size_t linked_count_{0};
+    time_point next_tick_{};
+    bool ticking_{false};
+};
+
+template <typename Clock>
+class wheel_interval_timer : public lux::time::base::interval_timer, private timer_wheel_node
+{
+    friend class timer_wheel_core<Clock>;
+
+public:
+    explicit wheel_interval_timer(std::shared_ptr<timer_wheel_core<Clock>> core) : core_{lux::move(core)}
+    {
+        LUX_ASSERT(core_, "Timer wheel core must not be null");
+    }
+
+    ~wheel_interval_timer() override
+    {
+        core_->unlink(*this);
+    }
+
+    wheel_interval_timer(const wheel_interval_timer&) = delete;
+    wheel_interval_timer& operator=(const wheel_interval_timer&) = delete;
+
+public:
+    // lux::time::base::interval_timer implementation
+    void set_handler(std::function<void()> callback) override
+    {
+        if (handler_)
+        {
+            LUX_ASSERT(false, "Handler for timer is already set.");
+            return;
+        }
+
+        handler_ = lux::move(callback);
+    }
+
+    void schedule(std::chrono::milliseconds delay) override
+    {
+        interval_ = std::chrono::milliseconds::zero();
+        deadline_ = Clock::now() + delay;
+        core_->link(*this, deadline_);
+    }
+
+    void schedule_periodic(std::chrono::milliseconds interval) override
+    {
+        LUX_ASSERT(interval.count() > 0, "Periodic interval must be positive");
+
+        interval_ = interval;
+        deadline_ = Clock::now() + interval;
+        core_->link(*this, deadline_);
+    }
+
+    void cancel() override
+    {
+        core_->unlink(*this);
+    }
+
+private:
+    void expire()
+    {
+        if (interval_.count() > 0)
+        {
+            // Reschedule before running the handler so that cancel() or schedule() in the handler takes precedence
+            deadline_ += interval_;
+            core_->link(*this, deadline_);
+        }
+
+        if (handler_)
+        {
+            // The timer might be destroyed by its own handler, so nothing may touch `this` afterwards
+            handler_();
+        }
+    }
+
+private:
+    std::shared_ptr<timer_wheel_core<Clock>> core_;
+    std::function<void()> handler_{};
+    std::chrono::milliseconds interval_{};
+    typename Clock::time_point deadline_{};
+};
+
+template <typename Clock>
+void timer_wheel_core<Clock>::on_tick()
+{
+    // A handler may release the last reference to the core (e.g. by destroying the last timer)
+    const auto self = this->shared_from_this();
+
+    current_slot_ = (current_slot_ + 1) % slots_.size();
+    next_tick_ += tick_;
+
+    auto& slot = slots_[current_slot_];
+    for (auto* node = slot.next; node != &slot;)
+    {
+        auto* next = node->next;
+        if (node->rounds > 0)
+        {
+            --node->rounds;
+        }
+        else
+        {
+            // Move to the expired list first so handlers can freely cancel or destroy other timers
+            node->unlink();
+            expired_.push_back(*node);
+        }
+        node = next;
+    }
+
+    while (!expired_.empty())
+    {
+        auto& node = *expired_.next;
+        unlink(node);
+        static_cast<wheel_interval_timer<Clock>&>(node).expire();
+    }
+
+    if (linked_count_ == 0)
+    {
+        // Nothing left to wait for - stay idle until the next timer is scheduled
+        ticking_ = false;
+        return;
+    }
+
+    arm();
+}
+
+} // namespace detail
+
+/**
+ * @brief Hashed timing wheel that implements the timer factory interface on top of a single asio timer.
+ *
+ * Each created timer is an intrusive node of one of the wheel slots, so scheduling and canceling are O(1)
+ * and don't involve the asio timer queue. The wheel ticks only while at least one timer is scheduled.
+ * Deadlines are rounded up to the tick resolution; timers never fire early. Like the other timers, the wheel
+ * and its timers must be used from a single executor (strand).
+ */
+template <typename Clock>
+class basic_timer_wheel : public lux::time::base::timer_factory
+{
+public:
+    basic_timer_wheel(boost::asio::any_io_executor executor, const timer_wheel_config& config = {})
+        : core_{std::make_shared<detail::timer_wheel_core<Clock>>(executor, config)}
+    {
+    }
+
+public:
+    // lux::time::base::timer_factory implementation
+    lux::time::base::interval_timer_ptr create_interval_timer() override
+    {
+        return std::make_unique<detail::wheel_interval_timer<Clock>>(core_);
+    }
+
+public:
+    /**
+     * @brief Returns the number of currently scheduled timers.
+     */
+    std::size_t scheduled_count() const noexcept
+    {
+        return core_->scheduled_count();
+    }
+
+private:
+    std::shared_ptr<detail::timer_wheel_core<Clock>> core_;
+};
+
+using timer_wheel = basic_timer_wheel<std::chrono::steady_clock>;
+
+} // namespace lux::time
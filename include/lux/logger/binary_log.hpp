@@ -0,0 +1,286 @@
+#pragma once
+
+#include <lux/logger/log_level.hpp>
+
+#include <lux/support/enum.hpp>
+
+#include <fmt/format.h>
+
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iosfwd>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace lux {
+
+/**
+ * Binary log file layout (host byte order):
+ *
+ *   header:  magic "LUXB" | u16 version
+ *   record:  u8 record_type | record payload
+ *
+ *   logger record:  u32 logger_id | u32 name_size | name
+ *   format record:  u64 format_id | u32 format_size | format
+ *   event record:   u64 timestamp_ns | u8 level | u32 logger_id | u64 format_id | u8 arg_count | args...
+ *   argument:       u8 arg_type | value (strings are u32 size-prefixed)
+ *
+ * Logger and format records are written once, before the first event that references them.
+ */
+inline constexpr std::string_view binary_log_magic{"LUXB"};
+inline constexpr std::uint16_t binary_log_version{1};
+
+enum class binary_log_record_type : std::uint8_t
+{
+    logger = 1,
+    format = 2,
+    event = 3
+};
+
+enum class binary_log_arg_type : std::uint8_t
+{
+    boolean = 1,
+    character = 2,
+    signed_integer = 3,
+    unsigned_integer = 4,
+    floating_point = 5,
+    string = 6,
+    pointer = 7
+};
+
+namespace detail {
+
+// FNV-1a, stable across processes so the decoder can match format ids from different runs
+constexpr std::uint64_t binary_log_format_id(std::string_view format) noexcept
+{
+    std::uint64_t hash{14695981039346656037ull};
+    for (const char c : format)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+class binary_log_encoder
+{
+public:
+    explicit binary_log_encoder(std::vector<std::byte>& buffer) noexcept : buffer_{buffer}
+    {
+    }
+
+public:
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void write(const T& value)
+    {
+        const auto offset = buffer_.size();
+        buffer_.resize(offset + sizeof(T));
+        std::memcpy(buffer_.data() + offset, &value, sizeof(T));
+    }
+
+    void write_string(std::string_view str)
+    {
+        write(static_cast<std::uint32_t>(str.size()));
+        const auto offset = buffer_.size();
+        buffer_.resize(offset + str.size());
+        std::memcpy(buffer_.data() + offset, str.data(), str.size());
+    }
+
+    template <typename T>
+    void encode_argument(const T& arg)
+    {
+        using type = std::remove_cvref_t<T>;
+
+        if constexpr (std::same_as<type, bool>)
+        {
+            write(binary_log_arg_type::boolean);
+            write(static_cast<std::uint8_t>(arg));
+        }
+        else if constexpr (std::same_as<type, char>)
+        {
+            write(binary_log_arg_type::character);
+            write(arg);
+        }
+        else if constexpr (lux::enumeration<type>)
+        {
+            write(binary_log_arg_type::string);
+            write_string(lux::to_string_view(arg));
+        }
+        else if constexpr (std::signed_integral<type>)
+        {
+            write(binary_log_arg_type::signed_integer);
+            write(static_cast<std::int64_t>(arg));
+        }
+        else if constexpr (std::unsigned_integral<type>)
+        {
+            write(binary_log_arg_type::unsigned_integer);
+            write(static_cast<std::uint64_t>(arg));
+        }
+        else if constexpr (std::floating_point<type>)
+        {
+            write(binary_log_arg_type::floating_point);
+            write(static_cast<double>(arg));
+        }
+        else if constexpr (std::convertible_to<const type&, std::string_view>)
+        {
+            write(binary_log_arg_type::string);
+            write_string(std::string_view{arg});
+        }
+        else if constexpr (std::convertible_to<const type&, std::string>)
+        {
+            write(binary_log_arg_type::string);
+            write_string(std::string{arg});
+        }
+        else if constexpr (std::is_pointer_v<type> || std::same_as<type, std::nullptr_t>)
+        {
+            write(binary_log_arg_type::pointer);
+            write(static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(static_cast<const void*>(arg))));
+        }
+        else
+        {
+            // Types without a binary representation (ranges, user types, ...) are formatted eagerly
+            write(binary_log_arg_type::string);
+            write_string(fmt::format("{}", arg));
+        }
+    }
+
+private:
+    std::vector<std::byte>& buffer_;
+};
+
+} // namespace detail
+
+/**
+ * @brief Log sink that stores events as compact binary records instead of formatted text.
+ *
+ * Only the raw arguments are serialized on the logging thread; the format string is stored once per file
+ * and referenced by id. The text is reconstructed offline by binary_log_reader (see the lux-logdecode tool).
+ * The sink is thread-safe.
+ */
+class binary_log_sink
+{
+public:
+    /**
+     * @brief Opens (truncates) the given file and writes the binary log header.
+     * @param filename Path of the binary log file.
+     * @param level Minimum level of events written by this sink.
+     * @throws lux::formatted_exception if the file cannot be opened.
+     */
+    binary_log_sink(const std::string& filename, log_level level);
+    ~binary_log_sink();
+
+    binary_log_sink(const binary_log_sink&) = delete;
+    binary_log_sink& operator=(const binary_log_sink&) = delete;
+
+public:
+    log_level level() const noexcept
+    {
+        return level_;
+    }
+
+    bool should_log(log_level level) const noexcept
+    {
+        return level != log_level::none && level >= level_;
+    }
+
+    /**
+     * @brief Writes a logger record that maps the logger id to its name.
+     * @param logger_id Id used by subsequent events of the logger.
+     * @param name Logger name.
+     */
+    void register_logger(std::uint32_t logger_id, std::string_view name);
+
+    /**
+     * @brief Encodes the arguments and writes an event record.
+     * @param logger_id Id of a logger previously passed to register_logger().
+     * @param level Event level.
+     * @param format Format string; must be a fmt format string compatible with the argument types.
+     * @param args Format arguments.
+     */
+    template <typename... Args>
+    void log(std::uint32_t logger_id, log_level level, std::string_view format, const Args&... args)
+    {
+        static_assert(sizeof...(Args) <= UINT8_MAX, "Too many arguments for a binary log event");
+
+        // Reused per thread, so encoding does not allocate once the buffer has grown to the working size
+        thread_local std::vector<std::byte> args_buffer;
+        args_buffer.clear();
+
+        detail::binary_log_encoder encoder{args_buffer};
+        (encoder.encode_argument(args), ...);
+
+        write_event(logger_id, level, format, static_cast<std::uint8_t>(sizeof...(Args)), args_buffer);
+    }
+
+    void flush();
+
+private:
+    void write_event(std::uint32_t logger_id,
+                     log_level level,
+                     std::string_view format,
+                     std::uint8_t arg_count,
+                     std::span<const std::byte> args);
+
+private:
+    std::mutex mutex_;
+    std::ofstream stream_;
+    std::unordered_set<std::uint64_t> known_formats_;
+    std::vector<std::byte> record_buffer_;
+    const log_level level_;
+};
+
+struct binary_log_record
+{
+    std::chrono::system_clock::time_point timestamp;
+    log_level level{log_level::info};
+    std::string logger_name;
+    std::string message;
+};
+
+/**
+ * @brief Reads and formats events written by binary_log_sink.
+ */
+class binary_log_reader
+{
+public:
+    /**
+     * @brief Constructs a reader and validates the binary log header.
+     * @param stream Input stream opened in binary mode. Caller is responsible for stream lifetime.
+     * @throws lux::formatted_exception if the header is missing or the version is unsupported.
+     */
+    explicit binary_log_reader(std::istream& stream);
+
+public:
+    /**
+     * @brief Reads records until the next event and formats its message.
+     * @return The next event, or std::nullopt at the end of the stream.
+     * @throws lux::formatted_exception if the stream contains a truncated or malformed record.
+     */
+    std::optional<binary_log_record> next();
+
+private:
+    std::istream& stream_;
+    std::unordered_map<std::uint32_t, std::string> loggers_;
+    std::unordered_map<std::uint64_t, std::string> formats_;
+};
+
+/**
+ * @brief Formats a decoded record using the layout of lux::default_log_pattern.
+ * @param record Decoded record.
+ * @return Single line of text without a trailing newline.
+ */
+std::string to_string(const binary_log_record& record);
+
+} // namespace lux
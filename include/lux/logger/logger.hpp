@@ -1,5 +1,6 @@
 #pragma once
 
+#include <lux/logger/binary_log.hpp>
 #include <lux/logger/log_level.hpp>
 
 #include <lux/support/assert.hpp>
@@ -11,6 +12,7 @@
 
 #include <fmt/ranges.h>
 
+#include <cstdint>
 #include <memory>
 #include <ranges>
 #include <string_view>
@@ -36,6 +38,13 @@ public:
         LUX_ASSERT(spd_logger_, "spdlog::logger must not be null");
     }
 
+    // Logger that additionally writes events to a binary sink under the given logger id
+    logger(std::shared_ptr<spdlog::logger> spd_logger, std::shared_ptr<binary_log_sink> binary_sink, std::uint32_t id)
+        : spd_logger_(lux::move(spd_logger)), binary_sink_(lux::move(binary_sink)), id_{id}
+    {
+        LUX_ASSERT(spd_logger_, "spdlog::logger must not be null");
+    }
+
     logger(const logger&) = delete;
     logger& operator=(const logger&) = delete;
     logger(logger&&) = default;
@@ -61,22 +70,39 @@ public:
     template <typename... Args>
     void log(log_level level, fmt::format_string<preprocessed_argument_t<Args>...> fmt, Args&&... args)
     {
+        if (binary_sink_ && binary_sink_->should_log(level))
+        {
+            const fmt::string_view format{fmt};
+            binary_sink_->log(id_, level, std::string_view{format.data(), format.size()}, args...);
+        }
+
         spd_logger_->log(detail::to_spdlog_level(level), fmt, preprocess_argument(std::forward<Args>(args))...);
     }
 
     template <std::convertible_to<std::string> T>
     void log(log_level level, T&& msg)
     {
+        if (binary_sink_ && binary_sink_->should_log(level))
+        {
+            binary_sink_->log(id_, level, "{}", msg);
+        }
+
         spd_logger_->log(detail::to_spdlog_level(level), std::forward<T>(msg));
     }
 
     void flush()
     {
         spd_logger_->flush();
+        if (binary_sink_)
+        {
+            binary_sink_->flush();
+        }
     }
 
 private:
     std::shared_ptr<spdlog::logger> spd_logger_;
+    std::shared_ptr<binary_log_sink> binary_sink_;
+    std::uint32_t id_{0};
 };
 
 } // namespace lux
@@ -1,18 +1,23 @@
 #pragma once
 
+#include <lux/logger/binary_log.hpp>
 #include <lux/logger/log_level.hpp>
 #include <lux/logger/logger.hpp>
 #include <lux/logger/logger_factory.hpp>
 
+#include <lux/support/container.hpp>
+
 #include <spdlog/common.h>
 
+#include <cstdint>
 #include <optional>
 #include <functional>
 #include <iosfwd>
+#include <memory>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <variant>
-#include <unordered_map>
 
 namespace lux {
 
@@ -57,11 +62,19 @@ struct daily_file_log_config : public basic_file_log_config
 
 using file_log_config = std::variant<basic_file_log_config, rotating_file_log_config, daily_file_log_config>;
 
+// Events are stored as binary records and turned into text offline (see binary_log_reader / lux-logdecode).
+struct binary_log_config
+{
+    log_level level{default_log_level};
+    std::string filename{"lux.blog"};
+};
+
 struct log_config
 {
     std::optional<console_log_config> console;
     std::optional<ostream_log_config> ostream;
     std::optional<file_log_config> file;
+    std::optional<binary_log_config> binary;
 };
 
 class logger_manager : public lux::logger_factory
@@ -77,6 +90,8 @@ public:
 
 public:
     // lux::logger_factory implementation
+    // Thread-safe. Lookup of an existing logger does not allocate and only takes a shared lock; the returned
+    // reference stays valid for the lifetime of the manager, so it can be cached by the caller.
     lux::logger& get_logger(const char* name) override;
 
 public:
@@ -88,6 +103,10 @@ public:
     {
         return loggers_;
     }
+    const auto& binary_sink() const
+    {
+        return binary_sink_;
+    }
 
 private:
     void configure_sinks(const log_config& config);
@@ -97,10 +116,15 @@ private:
     void configure_basic_file_sink(const basic_file_log_config& config);
     void configure_rotating_file_sink(const rotating_file_log_config& config);
     void configure_daily_file_sink(const daily_file_log_config& config);
+    void configure_binary_sink(const binary_log_config& config);
 
 private:
     std::vector<spdlog::sink_ptr> sinks_;
-    std::unordered_map<std::string, logger> loggers_;
+    std::shared_ptr<binary_log_sink> binary_sink_;
+    lux::string_unordered_map<logger> loggers_;
+
+    // Held by pointer to keep the manager movable. Not required to be held when the manager is moved.
+    std::unique_ptr<std::shared_mutex> loggers_mutex_{std::make_unique<std::shared_mutex>()};
 
     // Minimum log level across all sinks to prevent unnecessary logging
     spdlog::level::level_enum min_log_level_{spdlog::level::off};
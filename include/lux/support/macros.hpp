@@ -10,3 +10,14 @@
  * @brief Generate a unique name by concatenating the base name with the current line number and counter.
  */
 #define LUX_UNIQUE_NAME(base) LUX_CONCAT(base, LUX_CONCAT(__LINE__, __COUNTER__))
+
+/**
+ * @brief Prevent the function from being inlined, e.g. to keep cold error paths out of hot callers.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define LUX_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define LUX_NOINLINE __declspec(noinline)
+#else
+#define LUX_NOINLINE
+#endif
@@ -1,13 +1,23 @@
 #pragma once
 
+#include <lux/support/assert.hpp>
 #include <lux/support/concepts.hpp>
 #include <lux/support/exception.hpp>
+#include <lux/support/macros.hpp>
+#include <lux/utils/varint.hpp>
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
 #include <cstring>
+#include <expected>
+#include <limits>
 #include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <vector>
 
 namespace lux {
@@ -18,9 +28,16 @@ namespace lux {
  * The buffer_reader class provides a fluent interface for reading binary data
  * from a std::span<const std::byte>. It tracks the current read position and handles
  * buffer underflow by throwing exceptions.
+ *
+ * For hot paths there are two alternatives that never throw: the try_read* functions report
+ * truncated data with std::errc::result_out_of_range, and reserve() checks the data for a batch
+ * of reads once and hands out a reservation whose reads are not checked at all.
  */
 class buffer_reader
 {
+public:
+    class reservation;
+
 public:
     /**
      * @brief Constructs a buffer_reader with the given buffer.
@@ -74,11 +91,9 @@ public:
      */
     buffer_reader& skip(std::size_t bytes)
     {
-        if (remaining() < bytes)
+        if (remaining() < bytes) [[unlikely]]
         {
-            throw lux::formatted_exception("Buffer underflow: attempting to skip {} bytes, but only {} bytes remaining",
-                                           bytes,
-                                           remaining());
+            throw_underflow("skip", bytes);
         }
 
         position_ += bytes;
@@ -94,15 +109,12 @@ public:
     template <lux::trivially_copyable T>
     buffer_reader& read(T& value)
     {
-        if (remaining() < sizeof(T))
+        if (remaining() < sizeof(T)) [[unlikely]]
         {
-            throw lux::formatted_exception("Buffer underflow: attempting to read {} bytes, but only {} bytes remaining",
-                                           sizeof(T),
-                                           remaining());
+            throw_underflow("read", sizeof(T));
         }
 
-        std::memcpy(&value, buffer_.data() + position_, sizeof(T));
-        position_ += sizeof(T);
+        get(&value, sizeof(T));
         return *this;
     }
 
@@ -117,16 +129,12 @@ public:
     buffer_reader& read(T (&arr)[N])
     {
         const auto bytes_needed = sizeof(T) * N;
-        if (remaining() < bytes_needed)
+        if (remaining() < bytes_needed) [[unlikely]]
         {
-            throw lux::formatted_exception(
-                "Buffer underflow: attempting to read {} bytes for array, but only {} bytes remaining",
-                bytes_needed,
-                remaining());
+            throw_underflow("read", bytes_needed);
         }
 
-        std::memcpy(arr, buffer_.data() + position_, bytes_needed);
-        position_ += bytes_needed;
+        get(arr, bytes_needed);
         return *this;
     }
 
@@ -141,16 +149,12 @@ public:
     buffer_reader& read(std::array<T, N>& arr)
     {
         const auto bytes_needed = sizeof(T) * N;
-        if (remaining() < bytes_needed)
+        if (remaining() < bytes_needed) [[unlikely]]
         {
-            throw lux::formatted_exception(
-                "Buffer underflow: attempting to read {} bytes for std::array, but only {} bytes remaining",
-                bytes_needed,
-                remaining());
+            throw_underflow("read", bytes_needed);
         }
 
-        std::memcpy(arr.data(), buffer_.data() + position_, bytes_needed);
-        position_ += bytes_needed;
+        get(arr.data(), bytes_needed);
         return *this;
     }
 
@@ -183,6 +187,261 @@ public:
         return arr;
     }
 
+    /**
+     * @brief Reads a view of the given number of bytes without copying them.
+     * @param size Number of bytes to read.
+     * @return A span referring to the source buffer.
+     * @throws lux::formatted_exception if there's insufficient buffer data.
+     */
+    std::span<const std::byte> read_bytes(std::size_t size)
+    {
+        if (remaining() < size) [[unlikely]]
+        {
+            throw_underflow("read", size);
+        }
+
+        return take(size);
+    }
+
+    /**
+     * @brief Reads an integer stored in big-endian byte order.
+     * @tparam T Integer type.
+     * @return The read value in host byte order.
+     * @throws lux::formatted_exception if there's insufficient buffer data.
+     */
+    template <std::integral T>
+    T read_big_endian()
+    {
+        return read_with_byte_order<std::endian::big, T>();
+    }
+
+    /**
+     * @brief Reads an integer stored in little-endian byte order.
+     * @tparam T Integer type.
+     * @return The read value in host byte order.
+     * @throws lux::formatted_exception if there's insufficient buffer data.
+     */
+    template <std::integral T>
+    T read_little_endian()
+    {
+        return read_with_byte_order<std::endian::little, T>();
+    }
+
+    /**
+     * @brief Reads an unsigned LEB128 varint.
+     * @tparam T Unsigned integer type the value is expected to fit in.
+     * @return The decoded value.
+     * @throws lux::formatted_exception if the varint is truncated or doesn't fit T; the read position is left
+     * unchanged in that case.
+     */
+    template <std::unsigned_integral T>
+    T read_varint()
+    {
+        T value{};
+        if (const auto ec = decode_varint(value); ec != std::errc{}) [[unlikely]]
+        {
+            throw_varint_error<T>(ec);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Reads a zigzag encoded LEB128 varint.
+     * @tparam T Signed integer type the value is expected to fit in.
+     * @return The decoded value.
+     * @throws lux::formatted_exception if the varint is truncated or doesn't fit T; the read position is left
+     * unchanged in that case.
+     */
+    template <std::signed_integral T>
+    T read_signed_varint()
+    {
+        return lux::zigzag_decode(read_varint<std::make_unsigned_t<T>>());
+    }
+
+    /**
+     * @brief Reads binary data preceded by its size encoded as a varint, without copying it.
+     * @return A span referring to the source buffer.
+     * @throws lux::formatted_exception if there's insufficient buffer data; the read position is left unchanged
+     * in that case.
+     */
+    std::span<const std::byte> read_length_prefixed_bytes()
+    {
+        const auto start = position_;
+        const auto size = read_varint<std::size_t>();
+        if (remaining() < size) [[unlikely]]
+        {
+            const auto available = remaining();
+            position_ = start;
+            throw lux::formatted_exception(
+                "Buffer underflow: length prefix announces {} bytes, but only {} bytes remaining",
+                size,
+                available);
+        }
+
+        return take(size);
+    }
+
+    /**
+     * @brief Reads a string preceded by its size encoded as a varint, without copying it.
+     * @return A string_view referring to the source buffer.
+     * @throws lux::formatted_exception if there's insufficient buffer data; the read position is left unchanged
+     * in that case.
+     */
+    std::string_view read_length_prefixed_string()
+    {
+        const auto data = read_length_prefixed_bytes();
+        return std::string_view{reinterpret_cast<const char*>(data.data()), data.size()};
+    }
+
+    /**
+     * @brief Checks that a batch of reads is available with a single bounds check.
+     * @param bytes Number of bytes to reserve.
+     * @return Reservation reading at the current position of this buffer_reader.
+     * @throws lux::formatted_exception if there's insufficient buffer data.
+     */
+    reservation reserve(std::size_t bytes);
+
+    /**
+     * @brief Checks that a batch of reads is available with a single bounds check, without throwing.
+     * @param bytes Number of bytes to reserve.
+     * @return Reservation reading at the current position of this buffer_reader,
+     * or std::errc::result_out_of_range if there's insufficient buffer data.
+     */
+    std::expected<reservation, std::error_code> try_reserve(std::size_t bytes) noexcept;
+
+    /**
+     * @brief Reads a trivially copyable type from the buffer without throwing.
+     * @tparam T The type to read (must be trivially copyable and default constructible).
+     * @return The read value, or std::errc::result_out_of_range if there's insufficient buffer data.
+     */
+    template <lux::trivially_readable T>
+    std::expected<T, std::error_code> try_read() noexcept
+    {
+        if (remaining() < sizeof(T)) [[unlikely]]
+        {
+            return std::unexpected{std::make_error_code(std::errc::result_out_of_range)};
+        }
+
+        T value{};
+        get(&value, sizeof(T));
+        return value;
+    }
+
+    /**
+     * @brief Reads a view of the given number of bytes without copying them and without throwing.
+     * @return A span referring to the source buffer, or std::errc::result_out_of_range if there's insufficient
+     * buffer data.
+     */
+    std::expected<std::span<const std::byte>, std::error_code> try_read_bytes(std::size_t size) noexcept
+    {
+        if (remaining() < size) [[unlikely]]
+        {
+            return std::unexpected{std::make_error_code(std::errc::result_out_of_range)};
+        }
+        return take(size);
+    }
+
+    /**
+     * @brief Reads an integer stored in big-endian byte order without throwing.
+     * @return The read value in host byte order, or std::errc::result_out_of_range if there's insufficient
+     * buffer data.
+     */
+    template <std::integral T>
+    std::expected<T, std::error_code> try_read_big_endian() noexcept
+    {
+        auto value = try_read<T>();
+        if (value) [[likely]]
+        {
+            *value = from_byte_order<std::endian::big>(*value);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Reads an integer stored in little-endian byte order without throwing.
+     * @return The read value in host byte order, or std::errc::result_out_of_range if there's insufficient
+     * buffer data.
+     */
+    template <std::integral T>
+    std::expected<T, std::error_code> try_read_little_endian() noexcept
+    {
+        auto value = try_read<T>();
+        if (value) [[likely]]
+        {
+            *value = from_byte_order<std::endian::little>(*value);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Reads an unsigned LEB128 varint without throwing.
+     * @return The decoded value, std::errc::result_out_of_range if the varint is truncated, or
+     * std::errc::value_too_large if it doesn't fit T. The read position is left unchanged on error.
+     */
+    template <std::unsigned_integral T>
+    std::expected<T, std::error_code> try_read_varint() noexcept
+    {
+        T value{};
+        if (const auto ec = decode_varint(value); ec != std::errc{}) [[unlikely]]
+        {
+            return std::unexpected{std::make_error_code(ec)};
+        }
+        return value;
+    }
+
+    /**
+     * @brief Reads a zigzag encoded LEB128 varint without throwing.
+     * @return The decoded value, std::errc::result_out_of_range if the varint is truncated, or
+     * std::errc::value_too_large if it doesn't fit T. The read position is left unchanged on error.
+     */
+    template <std::signed_integral T>
+    std::expected<T, std::error_code> try_read_signed_varint() noexcept
+    {
+        std::make_unsigned_t<T> value{};
+        if (const auto ec = decode_varint(value); ec != std::errc{}) [[unlikely]]
+        {
+            return std::unexpected{std::make_error_code(ec)};
+        }
+        return lux::zigzag_decode(value);
+    }
+
+    /**
+     * @brief Reads binary data preceded by its size encoded as a varint, without copying it and without throwing.
+     * @return A span referring to the source buffer, or the error of the length prefix or
+     * std::errc::result_out_of_range if the data is truncated. The read position is left unchanged on error.
+     */
+    std::expected<std::span<const std::byte>, std::error_code> try_read_length_prefixed_bytes() noexcept
+    {
+        const auto start = position_;
+        std::size_t size{};
+        if (const auto ec = decode_varint(size); ec != std::errc{}) [[unlikely]]
+        {
+            return std::unexpected{std::make_error_code(ec)};
+        }
+
+        if (remaining() < size) [[unlikely]]
+        {
+            position_ = start;
+            return std::unexpected{std::make_error_code(std::errc::result_out_of_range)};
+        }
+        return take(size);
+    }
+
+    /**
+     * @brief Reads a string preceded by its size encoded as a varint, without copying it and without throwing.
+     * @return A string_view referring to the source buffer, or the error of the length prefix or
+     * std::errc::result_out_of_range if the data is truncated. The read position is left unchanged on error.
+     */
+    std::expected<std::string_view, std::error_code> try_read_length_prefixed_string() noexcept
+    {
+        const auto data = try_read_length_prefixed_bytes();
+        if (!data) [[unlikely]]
+        {
+            return std::unexpected{data.error()};
+        }
+        return std::string_view{reinterpret_cast<const char*>(data->data()), data->size()};
+    }
+
     /**
      * @brief Stream operator for reading trivially copyable types.
      * @tparam T The type to read (must be trivially copyable).
@@ -208,9 +467,201 @@ public:
         return read(arr);
     }
 
+private:
+    template <std::endian Order, std::integral T>
+    static T from_byte_order(T value) noexcept
+    {
+        if constexpr (sizeof(T) > 1 && Order != std::endian::native)
+        {
+            value = std::byteswap(value);
+        }
+        return value;
+    }
+
+    template <std::endian Order, std::integral T>
+    T read_with_byte_order()
+    {
+        return from_byte_order<Order>(read<T>());
+    }
+
+    void get(void* data, std::size_t size) noexcept
+    {
+        std::memcpy(data, buffer_.data() + position_, size);
+        position_ += size;
+    }
+
+    std::span<const std::byte> take(std::size_t size) noexcept
+    {
+        const auto data = buffer_.subspan(position_, size);
+        position_ += size;
+        return data;
+    }
+
+    template <std::unsigned_integral T>
+    std::errc decode_varint(T& value) noexcept
+    {
+        constexpr auto max_size = lux::max_varint_size<T>;
+        constexpr auto last_byte_bits = std::numeric_limits<T>::digits - 7 * (max_size - 1);
+
+        // A single bounds check covers the whole varint in the common case
+        const auto* data = buffer_.data() + position_;
+        const auto limit = std::min(max_size, remaining());
+
+        T result = 0;
+        for (std::size_t i = 0; i < limit; ++i)
+        {
+            const auto byte = std::to_integer<std::uint8_t>(data[i]);
+            const auto bits = static_cast<T>(byte & 0x7F);
+            if (i == max_size - 1 && (bits >> last_byte_bits) != 0)
+            {
+                return std::errc::value_too_large;
+            }
+
+            result |= static_cast<T>(bits << (7 * i));
+            if ((byte & 0x80) == 0)
+            {
+                value = result;
+                position_ += i + 1;
+                return std::errc{};
+            }
+        }
+
+        return limit < max_size ? std::errc::result_out_of_range : std::errc::value_too_large;
+    }
+
+    [[noreturn]] LUX_NOINLINE void throw_underflow(const char* operation, std::size_t bytes) const
+    {
+        throw lux::formatted_exception("Buffer underflow: attempting to {} {} bytes, but only {} bytes remaining",
+                                       operation,
+                                       bytes,
+                                       remaining());
+    }
+
+    template <std::unsigned_integral T>
+    [[noreturn]] LUX_NOINLINE static void throw_varint_error(std::errc ec)
+    {
+        if (ec == std::errc::result_out_of_range)
+        {
+            throw lux::formatted_exception("Buffer underflow: varint is truncated");
+        }
+        throw lux::formatted_exception("Varint overflow: value doesn't fit {} bits", std::numeric_limits<T>::digits);
+    }
+
 private:
     std::span<const std::byte> buffer_;
     std::size_t position_;
 };
 
+/**
+ * @brief Data reserved in a buffer_reader by a single bounds check.
+ *
+ * Reads from a reservation are not checked against the buffer size (overruns are only asserted in debug builds),
+ * so a batch of fixed size values can be decoded without a branch per value. Every read advances the position of
+ * the buffer_reader the reservation was obtained from; the reservation must not outlive it and must not be used
+ * after reading from the buffer_reader directly. Varints are not supported, as their size depends on the data.
+ */
+class buffer_reader::reservation
+{
+public:
+    /**
+     * @brief Gets the number of reserved bytes not read yet.
+     */
+    std::size_t remaining() const noexcept
+    {
+        return end_ - reader_.position_;
+    }
+
+    /**
+     * @brief Reads a view of the given number of bytes from the reservation without copying them.
+     */
+    std::span<const std::byte> read_bytes(std::size_t size) noexcept
+    {
+        LUX_ASSERT(size <= remaining(), "Read exceeds the reserved data");
+        return reader_.take(size);
+    }
+
+    /**
+     * @brief Reads a trivially copyable type from the reservation.
+     */
+    template <lux::trivially_copyable T>
+    reservation& read(T& value) noexcept
+    {
+        LUX_ASSERT(sizeof(T) <= remaining(), "Read exceeds the reserved data");
+        reader_.get(&value, sizeof(T));
+        return *this;
+    }
+
+    /**
+     * @brief Reads a trivially copyable type from the reservation and returns it.
+     */
+    template <lux::trivially_readable T>
+    T read() noexcept
+    {
+        T value{};
+        read(value);
+        return value;
+    }
+
+    /**
+     * @brief Reads an integer stored in big-endian byte order from the reservation.
+     */
+    template <std::integral T>
+    T read_big_endian() noexcept
+    {
+        return buffer_reader::from_byte_order<std::endian::big>(read<T>());
+    }
+
+    /**
+     * @brief Reads an integer stored in little-endian byte order from the reservation.
+     */
+    template <std::integral T>
+    T read_little_endian() noexcept
+    {
+        return buffer_reader::from_byte_order<std::endian::little>(read<T>());
+    }
+
+    /**
+     * @brief Stream operator for reading trivially copyable types from the reservation.
+     */
+    template <lux::trivially_copyable T>
+    reservation& operator>>(T& value) noexcept
+    {
+        return read(value);
+    }
+
+private:
+    friend class buffer_reader;
+
+    reservation(buffer_reader& reader, std::size_t bytes) noexcept
+        : reader_{reader}, end_{reader.position_ + bytes}
+    {
+    }
+
+private:
+    buffer_reader& reader_;
+    std::size_t end_;
+};
+
+// lux::buffer_reader implementation
+
+inline buffer_reader::reservation buffer_reader::reserve(std::size_t bytes)
+{
+    if (remaining() < bytes) [[unlikely]]
+    {
+        throw_underflow("reserve", bytes);
+    }
+
+    return reservation{*this, bytes};
+}
+
+inline std::expected<buffer_reader::reservation, std::error_code> buffer_reader::try_reserve(std::size_t bytes) noexcept
+{
+    if (remaining() < bytes) [[unlikely]]
+    {
+        return std::unexpected{std::make_error_code(std::errc::result_out_of_range)};
+    }
+
+    return reservation{*this, bytes};
+}
+
 } // namespace lux
\ No newline at end of file
@@ -1,13 +1,20 @@
 #pragma once
 
+#include <lux/support/assert.hpp>
 #include <lux/support/concepts.hpp>
 #include <lux/support/exception.hpp>
+#include <lux/support/macros.hpp>
+#include <lux/utils/varint.hpp>
 
 #include <array>
+#include <bit>
+#include <concepts>
 #include <cstring>
+#include <expected>
 #include <span>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <vector>
 
 namespace lux {
@@ -18,9 +25,16 @@ namespace lux {
  * The buffer_writer class provides a fluent interface for writing binary data
  * into a std::span<std::byte>. It tracks the current write position and handles
  * buffer overflow by throwing exceptions.
+ *
+ * For hot paths there are two alternatives that never throw: the try_write* functions report
+ * overflow with std::errc::no_buffer_space, and reserve() checks the space for a batch of writes
+ * once and hands out a reservation whose writes are not checked at all.
  */
 class buffer_writer
 {
+public:
+    class reservation;
+
 public:
     /**
      * @brief Constructs a buffer_writer with the given buffer.
@@ -74,11 +88,9 @@ public:
      */
     buffer_writer& skip(std::size_t bytes)
     {
-        if (remaining() < bytes)
+        if (remaining() < bytes) [[unlikely]]
         {
-            throw lux::formatted_exception("Buffer overflow: attempting to skip {} bytes, but only {} bytes remaining",
-                                           bytes,
-                                           remaining());
+            throw_overflow("skip", bytes);
         }
 
         position_ += bytes;
@@ -95,15 +107,12 @@ public:
     template <std::size_t N>
     buffer_writer& write(std::span<const std::byte, N> data)
     {
-        if (remaining() < data.size())
+        if (remaining() < data.size()) [[unlikely]]
         {
-            throw lux::formatted_exception("Buffer overflow: attempting to write {} bytes, but only {} bytes remaining",
-                                           data.size(),
-                                           remaining());
+            throw_overflow("write", data.size());
         }
 
-        std::memcpy(buffer_.data() + position_, data.data(), data.size());
-        position_ += data.size();
+        put(data.data(), data.size());
         return *this;
     }
 
@@ -229,6 +238,229 @@ public:
         return write(std::string_view{str});
     }
 
+    /**
+     * @brief Writes an integer in big-endian byte order.
+     * @tparam T Integer type.
+     * @param value The value to write.
+     * @return Reference to this buffer_writer for chaining.
+     * @throws lux::formatted_exception if there's insufficient buffer space.
+     */
+    template <std::integral T>
+    buffer_writer& write_big_endian(T value)
+    {
+        return write_with_byte_order<std::endian::big>(value);
+    }
+
+    /**
+     * @brief Writes an integer in little-endian byte order.
+     * @tparam T Integer type.
+     * @param value The value to write.
+     * @return Reference to this buffer_writer for chaining.
+     * @throws lux::formatted_exception if there's insufficient buffer space.
+     */
+    template <std::integral T>
+    buffer_writer& write_little_endian(T value)
+    {
+        return write_with_byte_order<std::endian::little>(value);
+    }
+
+    /**
+     * @brief Writes an unsigned integer as an LEB128 varint (7 bits per byte, least significant group first).
+     * @tparam T Unsigned integer type.
+     * @param value The value to write.
+     * @return Reference to this buffer_writer for chaining.
+     * @throws lux::formatted_exception if there's insufficient buffer space; nothing is written in that case.
+     */
+    template <std::unsigned_integral T>
+    buffer_writer& write_varint(T value)
+    {
+        if (remaining() < lux::max_varint_size<T> && remaining() < lux::varint_size(value)) [[unlikely]]
+        {
+            throw_overflow("write", lux::varint_size(value));
+        }
+
+        put_varint(value);
+        return *this;
+    }
+
+    /**
+     * @brief Writes a signed integer as a zigzag encoded LEB128 varint.
+     * @tparam T Signed integer type.
+     * @param value The value to write.
+     * @return Reference to this buffer_writer for chaining.
+     * @throws lux::formatted_exception if there's insufficient buffer space; nothing is written in that case.
+     */
+    template <std::signed_integral T>
+    buffer_writer& write_signed_varint(T value)
+    {
+        return write_varint(lux::zigzag_encode(value));
+    }
+
+    /**
+     * @brief Writes binary data preceded by its size encoded as a varint.
+     * @param data Span of bytes to write.
+     * @return Reference to this buffer_writer for chaining.
+     * @throws lux::formatted_exception if there's insufficient buffer space; nothing is written in that case.
+     */
+    buffer_writer& write_length_prefixed(std::span<const std::byte> data)
+    {
+        const auto bytes_needed = lux::varint_size(data.size()) + data.size();
+        if (remaining() < bytes_needed) [[unlikely]]
+        {
+            throw_overflow("write", bytes_needed);
+        }
+
+        put_varint(data.size());
+        put(data.data(), data.size());
+        return *this;
+    }
+
+    /**
+     * @brief Writes a string preceded by its size encoded as a varint.
+     * @param str The string to write.
+     * @return Reference to this buffer_writer for chaining.
+     * @throws lux::formatted_exception if there's insufficient buffer space; nothing is written in that case.
+     */
+    buffer_writer& write_length_prefixed(std::string_view str)
+    {
+        return write_length_prefixed(std::as_bytes(std::span{str.data(), str.size()}));
+    }
+
+    /**
+     * @brief Reserves space for a batch of writes with a single bounds check.
+     * @param bytes Number of bytes to reserve.
+     * @return Reservation writing at the current position of this buffer_writer.
+     * @throws lux::formatted_exception if there's insufficient buffer space.
+     */
+    reservation reserve(std::size_t bytes);
+
+    /**
+     * @brief Reserves space for a batch of writes with a single bounds check, without throwing.
+     * @param bytes Number of bytes to reserve.
+     * @return Reservation writing at the current position of this buffer_writer,
+     * or std::errc::no_buffer_space if there's insufficient buffer space.
+     */
+    std::expected<reservation, std::error_code> try_reserve(std::size_t bytes) noexcept;
+
+    /**
+     * @brief Writes binary data to the buffer without throwing.
+     * @param data Span of bytes to write.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    std::error_code try_write(std::span<const std::byte> data) noexcept
+    {
+        if (remaining() < data.size()) [[unlikely]]
+        {
+            return std::make_error_code(std::errc::no_buffer_space);
+        }
+
+        put(data.data(), data.size());
+        return {};
+    }
+
+    /**
+     * @brief Writes a trivially copyable type to the buffer without throwing.
+     * @tparam T The type to write (must be trivially copyable).
+     * @param value The value to write.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    template <lux::trivially_copyable T>
+    std::error_code try_write(const T& value) noexcept
+    {
+        return try_write(std::as_bytes(std::span{&value, 1}));
+    }
+
+    /**
+     * @brief Writes a string to the buffer without length prefix and without throwing.
+     * @param str The string to write.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    std::error_code try_write(std::string_view str) noexcept
+    {
+        return try_write(std::as_bytes(std::span{str.data(), str.size()}));
+    }
+
+    /**
+     * @brief Writes a C-style string to the buffer without length prefix and without throwing.
+     * @param str The C-style string to write.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    std::error_code try_write(const char* str) noexcept
+    {
+        return try_write(std::string_view{str});
+    }
+
+    /**
+     * @brief Writes an integer in big-endian byte order without throwing.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    template <std::integral T>
+    std::error_code try_write_big_endian(T value) noexcept
+    {
+        return try_write(to_byte_order<std::endian::big>(value));
+    }
+
+    /**
+     * @brief Writes an integer in little-endian byte order without throwing.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    template <std::integral T>
+    std::error_code try_write_little_endian(T value) noexcept
+    {
+        return try_write(to_byte_order<std::endian::little>(value));
+    }
+
+    /**
+     * @brief Writes an unsigned integer as an LEB128 varint without throwing.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    template <std::unsigned_integral T>
+    std::error_code try_write_varint(T value) noexcept
+    {
+        if (remaining() < lux::max_varint_size<T> && remaining() < lux::varint_size(value)) [[unlikely]]
+        {
+            return std::make_error_code(std::errc::no_buffer_space);
+        }
+
+        put_varint(value);
+        return {};
+    }
+
+    /**
+     * @brief Writes a signed integer as a zigzag encoded LEB128 varint without throwing.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    template <std::signed_integral T>
+    std::error_code try_write_signed_varint(T value) noexcept
+    {
+        return try_write_varint(lux::zigzag_encode(value));
+    }
+
+    /**
+     * @brief Writes binary data preceded by its size encoded as a varint, without throwing.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    std::error_code try_write_length_prefixed(std::span<const std::byte> data) noexcept
+    {
+        if (remaining() < lux::varint_size(data.size()) + data.size()) [[unlikely]]
+        {
+            return std::make_error_code(std::errc::no_buffer_space);
+        }
+
+        put_varint(data.size());
+        put(data.data(), data.size());
+        return {};
+    }
+
+    /**
+     * @brief Writes a string preceded by its size encoded as a varint, without throwing.
+     * @return std::errc::no_buffer_space if there's insufficient buffer space; nothing is written in that case.
+     */
+    std::error_code try_write_length_prefixed(std::string_view str) noexcept
+    {
+        return try_write_length_prefixed(std::as_bytes(std::span{str.data(), str.size()}));
+    }
+
     /**
      * @brief Stream operator for writing trivially copyable types.
      * @tparam T The type to write (must be trivially copyable).
@@ -335,9 +567,194 @@ public:
         return write(arr);
     }
 
+private:
+    template <std::endian Order, std::integral T>
+    static T to_byte_order(T value) noexcept
+    {
+        if constexpr (sizeof(T) > 1 && Order != std::endian::native)
+        {
+            value = std::byteswap(value);
+        }
+        return value;
+    }
+
+    template <std::endian Order, std::integral T>
+    buffer_writer& write_with_byte_order(T value)
+    {
+        return write(to_byte_order<Order>(value));
+    }
+
+    void put(const void* data, std::size_t size) noexcept
+    {
+        // memcpy with a null pointer is undefined even for zero size
+        if (size != 0)
+        {
+            std::memcpy(buffer_.data() + position_, data, size);
+            position_ += size;
+        }
+    }
+
+    template <std::unsigned_integral T>
+    void put_varint(T value) noexcept
+    {
+        auto* out = buffer_.data() + position_;
+        while (value >= 0x80)
+        {
+            *out++ = static_cast<std::byte>((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        *out++ = static_cast<std::byte>(value);
+        position_ = static_cast<std::size_t>(out - buffer_.data());
+    }
+
+    [[noreturn]] LUX_NOINLINE void throw_overflow(const char* operation, std::size_t bytes) const
+    {
+        throw lux::formatted_exception("Buffer overflow: attempting to {} {} bytes, but only {} bytes remaining",
+                                       operation,
+                                       bytes,
+                                       remaining());
+    }
+
 private:
     std::span<std::byte> buffer_;
     std::size_t position_;
 };
 
+/**
+ * @brief Space reserved in a buffer_writer by a single bounds check.
+ *
+ * Writes into a reservation are not checked against the buffer size (overruns are only asserted in debug builds),
+ * so a batch of small values can be encoded without a branch per value. Every write advances the position of the
+ * buffer_writer the reservation was obtained from; the reservation must not outlive it and must not be used after
+ * writing to the buffer_writer directly.
+ */
+class buffer_writer::reservation
+{
+public:
+    /**
+     * @brief Gets the number of reserved bytes not written yet.
+     */
+    std::size_t remaining() const noexcept
+    {
+        return end_ - writer_.position_;
+    }
+
+    /**
+     * @brief Writes binary data into the reservation.
+     */
+    reservation& write(std::span<const std::byte> data) noexcept
+    {
+        LUX_ASSERT(data.size() <= remaining(), "Write exceeds the reserved space");
+        writer_.put(data.data(), data.size());
+        return *this;
+    }
+
+    /**
+     * @brief Writes a trivially copyable type into the reservation.
+     */
+    template <lux::trivially_copyable T>
+    reservation& write(const T& value) noexcept
+    {
+        return write(std::as_bytes(std::span{&value, 1}));
+    }
+
+    /**
+     * @brief Writes a string into the reservation without length prefix.
+     */
+    reservation& write(std::string_view str) noexcept
+    {
+        return write(std::as_bytes(std::span{str.data(), str.size()}));
+    }
+
+    /**
+     * @brief Writes a C-style string into the reservation without length prefix.
+     */
+    reservation& write(const char* str) noexcept
+    {
+        return write(std::string_view{str});
+    }
+
+    /**
+     * @brief Writes an integer in big-endian byte order into the reservation.
+     */
+    template <std::integral T>
+    reservation& write_big_endian(T value) noexcept
+    {
+        return write(buffer_writer::to_byte_order<std::endian::big>(value));
+    }
+
+    /**
+     * @brief Writes an integer in little-endian byte order into the reservation.
+     */
+    template <std::integral T>
+    reservation& write_little_endian(T value) noexcept
+    {
+        return write(buffer_writer::to_byte_order<std::endian::little>(value));
+    }
+
+    /**
+     * @brief Writes an unsigned integer as an LEB128 varint into the reservation.
+     * Reserve lux::max_varint_size<T> bytes for values of unknown magnitude.
+     */
+    template <std::unsigned_integral T>
+    reservation& write_varint(T value) noexcept
+    {
+        LUX_ASSERT(lux::varint_size(value) <= remaining(), "Write exceeds the reserved space");
+        writer_.put_varint(value);
+        return *this;
+    }
+
+    /**
+     * @brief Writes a signed integer as a zigzag encoded LEB128 varint into the reservation.
+     */
+    template <std::signed_integral T>
+    reservation& write_signed_varint(T value) noexcept
+    {
+        return write_varint(lux::zigzag_encode(value));
+    }
+
+    /**
+     * @brief Stream operator for writing trivially copyable types into the reservation.
+     */
+    template <lux::trivially_copyable T>
+    reservation& operator<<(const T& value) noexcept
+    {
+        return write(value);
+    }
+
+private:
+    friend class buffer_writer;
+
+    reservation(buffer_writer& writer, std::size_t bytes) noexcept
+        : writer_{writer}, end_{writer.position_ + bytes}
+    {
+    }
+
+private:
+    buffer_writer& writer_;
+    std::size_t end_;
+};
+
+// lux::buffer_writer implementation
+
+inline buffer_writer::reservation buffer_writer::reserve(std::size_t bytes)
+{
+    if (remaining() < bytes) [[unlikely]]
+    {
+        throw_overflow("reserve", bytes);
+    }
+
+    return reservation{*this, bytes};
+}
+
+inline std::expected<buffer_writer::reservation, std::error_code> buffer_writer::try_reserve(std::size_t bytes) noexcept
+{
+    if (remaining() < bytes) [[unlikely]]
+    {
+        return std::unexpected{std::make_error_code(std::errc::no_buffer_space)};
+    }
+
+    return reservation{*this, bytes};
+}
+
 } // namespace lux
\ No newline at end of file
@@ -0,0 +1,255 @@
+#pragma once
+
+#include <lux/support/assert.hpp>
+#include <lux/support/concepts.hpp>
+#include <lux/support/move.hpp>
+#include <lux/utils/memory_arena.hpp>
+#include <lux/utils/varint.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace lux {
+
+/**
+ * @brief Binary output writer that appends to a chain of pooled chunks and grows as needed.
+ *
+ * The chunked_buffer_writer class provides the same fluent interface as lux::buffer_writer, but instead of a fixed
+ * buffer it fills chunks taken from a growable memory arena, so it never overflows and never moves data written
+ * so far. The resulting lux::buffer_chain can be handed over as is, e.g. to lux::net::base::tcp_socket::send,
+ * which sends it as a scatter/gather list without flattening it first.
+ */
+class chunked_buffer_writer
+{
+public:
+    /**
+     * @brief Constructs a chunked_buffer_writer taking its chunks from the given arena.
+     * @param arena The arena providing the chunks; chunks return to it once the chain is destroyed.
+     * @param chunk_size Maximum number of bytes stored in a single chunk.
+     */
+    chunked_buffer_writer(lux::growable_memory_arena_ptr<> arena, std::size_t chunk_size)
+        : arena_{lux::move(arena)}, chunk_size_{chunk_size}
+    {
+        LUX_ASSERT(arena_, "Memory arena must not be null");
+        LUX_ASSERT(chunk_size_ > 0, "Chunk size must be greater than zero");
+    }
+
+    /**
+     * @brief Gets the number of bytes written so far.
+     */
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    /**
+     * @brief Checks if nothing was written so far.
+     */
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /**
+     * @brief Gets the chunks written so far; each chunk is sized to the data it holds.
+     */
+    const lux::buffer_chain& chunks() const noexcept
+    {
+        return chain_;
+    }
+
+    /**
+     * @brief Takes the chunks written so far, leaving the writer empty and ready to write the next message.
+     */
+    lux::buffer_chain release() noexcept
+    {
+        size_ = 0;
+        return std::exchange(chain_, {});
+    }
+
+    /**
+     * @brief Copies the data written so far into a single contiguous buffer.
+     */
+    std::vector<std::byte> to_vector() const
+    {
+        std::vector<std::byte> result;
+        result.reserve(size_);
+        for (const auto& chunk : chain_)
+        {
+            result.insert(result.end(), chunk->begin(), chunk->end());
+        }
+        return result;
+    }
+
+    /**
+     * @brief Appends binary data, spreading it over as many chunks as needed.
+     * @param data Span of bytes to write.
+     * @return Reference to this chunked_buffer_writer for chaining.
+     */
+    chunked_buffer_writer& write(std::span<const std::byte> data)
+    {
+        while (!data.empty())
+        {
+            if (chain_.empty() || chain_.back()->size() == chunk_size_)
+            {
+                add_chunk();
+            }
+
+            auto& chunk = *chain_.back();
+            const auto count = std::min(data.size(), chunk_size_ - chunk.size());
+            chunk.insert(chunk.end(), data.begin(), data.begin() + count);
+            data = data.subspan(count);
+            size_ += count;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Writes a trivially copyable type in host byte order.
+     * @tparam T The type to write (must be trivially copyable).
+     * @param value The value to write.
+     * @return Reference to this chunked_buffer_writer for chaining.
+     */
+    template <lux::trivially_copyable T>
+    chunked_buffer_writer& write(const T& value)
+    {
+        return write(std::as_bytes(std::span{&value, 1}));
+    }
+
+    /**
+     * @brief Writes a string without length prefix.
+     * @param str The string to write.
+     * @return Reference to this chunked_buffer_writer for chaining.
+     */
+    chunked_buffer_writer& write(std::string_view str)
+    {
+        return write(std::as_bytes(std::span{str.data(), str.size()}));
+    }
+
+    /**
+     * @brief Writes a C-style string without length prefix.
+     * @param str The C-style string to write.
+     * @return Reference to this chunked_buffer_writer for chaining.
+     */
+    chunked_buffer_writer& write(const char* str)
+    {
+        return write(std::string_view{str});
+    }
+
+    /**
+     * @brief Writes an integer in big-endian byte order.
+     */
+    template <std::integral T>
+    chunked_buffer_writer& write_big_endian(T value)
+    {
+        if constexpr (sizeof(T) > 1 && std::endian::native != std::endian::big)
+        {
+            value = std::byteswap(value);
+        }
+        return write(value);
+    }
+
+    /**
+     * @brief Writes an integer in little-endian byte order.
+     */
+    template <std::integral T>
+    chunked_buffer_writer& write_little_endian(T value)
+    {
+        if constexpr (sizeof(T) > 1 && std::endian::native != std::endian::little)
+        {
+            value = std::byteswap(value);
+        }
+        return write(value);
+    }
+
+    /**
+     * @brief Writes an unsigned integer as an LEB128 varint.
+     */
+    template <std::unsigned_integral T>
+    chunked_buffer_writer& write_varint(T value)
+    {
+        std::array<std::byte, lux::max_varint_size<T>> encoded;
+        std::size_t size = 0;
+        while (value >= 0x80)
+        {
+            encoded[size++] = static_cast<std::byte>((value & 0x7F) | 0x80);
+            value >>= 7;
+        }
+        encoded[size++] = static_cast<std::byte>(value);
+
+        return write(std::span<const std::byte>{encoded.data(), size});
+    }
+
+    /**
+     * @brief Writes a signed integer as a zigzag encoded LEB128 varint.
+     */
+    template <std::signed_integral T>
+    chunked_buffer_writer& write_signed_varint(T value)
+    {
+        return write_varint(lux::zigzag_encode(value));
+    }
+
+    /**
+     * @brief Writes binary data preceded by its size encoded as a varint.
+     */
+    chunked_buffer_writer& write_length_prefixed(std::span<const std::byte> data)
+    {
+        return write_varint(data.size()).write(data);
+    }
+
+    /**
+     * @brief Writes a string preceded by its size encoded as a varint.
+     */
+    chunked_buffer_writer& write_length_prefixed(std::string_view str)
+    {
+        return write_varint(str.size()).write(str);
+    }
+
+    /**
+     * @brief Stream operator for writing trivially copyable types.
+     */
+    template <lux::trivially_copyable T>
+    chunked_buffer_writer& operator<<(const T& value)
+    {
+        return write(value);
+    }
+
+    /**
+     * @brief Stream operator for writing strings without length prefix.
+     */
+    chunked_buffer_writer& operator<<(std::string_view str)
+    {
+        return write(str);
+    }
+
+    /**
+     * @brief Stream operator for writing C-style strings without length prefix.
+     */
+    chunked_buffer_writer& operator<<(const char* str)
+    {
+        return write(str);
+    }
+
+private:
+    void add_chunk()
+    {
+        auto chunk = arena_->get(0);
+        chunk->reserve(chunk_size_);
+        chain_.push_back(lux::move(chunk));
+    }
+
+private:
+    lux::growable_memory_arena_ptr<> arena_;
+    const std::size_t chunk_size_;
+    lux::buffer_chain chain_;
+    std::size_t size_{0};
+};
+
+} // namespace lux
@@ -97,4 +97,10 @@ auto make_growable_memory_arena(std::size_t init_size, std::size_t reserve_size)
     return growable_memory_arena<T>::make(init_size, reserve_size);
 }
 
+/**
+ * @brief Sequence of arena buffers forming a single logical message, e.g. one produced by
+ * lux::chunked_buffer_writer. The buffers return to their arena when the chain is destroyed.
+ */
+using buffer_chain = std::vector<growable_memory_arena<std::vector<std::byte>>::element_type>;
+
 } // namespace lux
\ No newline at end of file
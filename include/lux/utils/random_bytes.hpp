@@ -1,36 +1,46 @@
 #pragma once
 
+#include <lux/support/concepts.hpp>
+
 #include <cstddef>
-#include <random>
+#include <span>
 #include <vector>
 
 namespace lux {
 
 /**
- * @brief Generate a vector of random bytes using a non-deterministic random number generator.
+ * @brief Fill a buffer with cryptographically secure random bytes.
+ *
+ * Small requests are served from a thread-local pool refilled in batches from the operating system CSPRNG
+ * (getrandom, arc4random_buf or BCryptGenRandom), so generating nonces or identifiers at a high rate neither
+ * allocates nor locks and rarely makes a system call. Bytes are wiped from the pool once handed out and the pool
+ * is discarded in a child process after fork, so no two callers ever get the same bytes.
+ *
+ * @param buffer The buffer to fill.
+ * @throws lux::formatted_exception if the operating system CSPRNG fails.
+ */
+void fill_random_bytes(std::span<std::byte> buffer);
+
+/**
+ * @brief Generate a vector of cryptographically secure random bytes.
  * @param count The number of random bytes to generate.
  * @return A vector containing the generated random bytes.
+ * @throws lux::formatted_exception if the operating system CSPRNG fails.
  */
-[[nodiscard]] std::vector<std::byte> random_bytes(std::size_t count)
-{
-
-    if (count == 0)
-    {
-        return {};
-    }
+[[nodiscard]] std::vector<std::byte> random_bytes(std::size_t count);
 
-    std::mt19937 rng(std::random_device{}());
-    std::uniform_int_distribution<> dist(0, 255);
-
-    std::vector<std::byte> result;
-    result.resize(count);
-
-    for (std::size_t i = 0; i < count; ++i)
-    {
-        result[i] = static_cast<std::byte>(dist(rng));
-    }
-
-    return result;
+/**
+ * @brief Generate a cryptographically secure random value, e.g. a request identifier.
+ * @tparam T The type of the value (must be trivially readable); every object representation must be valid.
+ * @return The generated value.
+ * @throws lux::formatted_exception if the operating system CSPRNG fails.
+ */
+template <lux::trivially_readable T>
+[[nodiscard]] T random_value()
+{
+    T value;
+    lux::fill_random_bytes(std::as_writable_bytes(std::span{&value, 1}));
+    return value;
 }
 
-} // namespace lux
\ No newline at end of file
+} // namespace lux
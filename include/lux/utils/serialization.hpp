@@ -0,0 +1,596 @@
+#pragma once
+
+#include <lux/support/concepts.hpp>
+#include <lux/support/exception.hpp>
+#include <lux/utils/buffer_reader.hpp>
+#include <lux/utils/buffer_writer.hpp>
+#include <lux/utils/varint.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Compile-time schema serialization on top of lux::buffer_writer and lux::buffer_reader.
+ *
+ * Supported types are arithmetic types, enums, std::byte, std::array, std::string, std::string_view, std::vector,
+ * std::optional, std::pair, std::tuple and aggregates (up to 16 fields, without C-style arrays or base classes)
+ * of supported types. Aggregate fields are found with structured bindings, so no registration is needed.
+ *
+ * Wire format: fields are written in declaration order without padding; fixed-size values in host byte order (like
+ * the rest of buffer_writer), strings and vectors prefixed with their element count as a varint, and optionals
+ * prefixed with a one byte presence flag. The layout of fixed-size types is computed at compile time: they are
+ * written and read with a single bounds check, and those without padding with a single memcpy.
+ */
+namespace lux {
+
+namespace detail {
+
+struct any_field
+{
+    // Only used in unevaluated contexts to count aggregate fields
+    template <typename T>
+    operator T&() const&& noexcept;
+};
+
+template <typename T, typename... Fields>
+consteval std::size_t aggregate_field_count()
+{
+    if constexpr (requires { T{std::declval<Fields>()..., std::declval<any_field>()}; })
+    {
+        return aggregate_field_count<T, Fields..., any_field>();
+    }
+    else
+    {
+        return sizeof...(Fields);
+    }
+}
+
+template <typename T>
+struct is_std_array : std::false_type
+{
+};
+
+template <typename T, std::size_t N>
+struct is_std_array<std::array<T, N>> : std::true_type
+{
+};
+
+template <typename T>
+struct is_std_vector : std::false_type
+{
+};
+
+template <typename T, typename Allocator>
+struct is_std_vector<std::vector<T, Allocator>> : std::true_type
+{
+};
+
+template <typename T>
+struct is_std_optional : std::false_type
+{
+};
+
+template <typename T>
+struct is_std_optional<std::optional<T>> : std::true_type
+{
+};
+
+template <typename T>
+struct is_std_tuple : std::false_type
+{
+};
+
+template <typename... Ts>
+struct is_std_tuple<std::tuple<Ts...>> : std::true_type
+{
+};
+
+template <typename T1, typename T2>
+struct is_std_tuple<std::pair<T1, T2>> : std::true_type
+{
+};
+
+template <typename T>
+concept serializable_scalar = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+template <typename T>
+concept serializable_string = std::same_as<T, std::string> || std::same_as<T, std::string_view>;
+
+template <typename T>
+concept serializable_aggregate = std::is_class_v<T> && std::is_aggregate_v<T> && !is_std_array<T>::value &&
+                                 aggregate_field_count<T>() > 0 && aggregate_field_count<T>() <= 16;
+
+/**
+ * Returns the fields of an aggregate as a tuple of references.
+ */
+template <typename T>
+constexpr auto tie_fields(T& value) noexcept
+{
+    constexpr auto count = aggregate_field_count<std::remove_const_t<T>>();
+    if constexpr (count == 1)
+    {
+        auto& [f0] = value;
+        return std::tie(f0);
+    }
+    else if constexpr (count == 2)
+    {
+        auto& [f0, f1] = value;
+        return std::tie(f0, f1);
+    }
+    else if constexpr (count == 3)
+    {
+        auto& [f0, f1, f2] = value;
+        return std::tie(f0, f1, f2);
+    }
+    else if constexpr (count == 4)
+    {
+        auto& [f0, f1, f2, f3] = value;
+        return std::tie(f0, f1, f2, f3);
+    }
+    else if constexpr (count == 5)
+    {
+        auto& [f0, f1, f2, f3, f4] = value;
+        return std::tie(f0, f1, f2, f3, f4);
+    }
+    else if constexpr (count == 6)
+    {
+        auto& [f0, f1, f2, f3, f4, f5] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5);
+    }
+    else if constexpr (count == 7)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6);
+    }
+    else if constexpr (count == 8)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7);
+    }
+    else if constexpr (count == 9)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+    }
+    else if constexpr (count == 10)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+    }
+    else if constexpr (count == 11)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+    }
+    else if constexpr (count == 12)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+    }
+    else if constexpr (count == 13)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+    }
+    else if constexpr (count == 14)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+    }
+    else if constexpr (count == 15)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+    }
+    else if constexpr (count == 16)
+    {
+        auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = value;
+        return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+    }
+}
+
+template <typename T>
+using field_types = decltype(tie_fields(std::declval<T&>()));
+
+struct layout
+{
+    bool supported;   // Type can be serialized
+    bool fixed;       // Encoded size doesn't depend on the value
+    std::size_t size; // Encoded size if fixed
+    bool bitwise;     // Encoded as the object representation of the value
+};
+
+template <typename T>
+consteval layout layout_of();
+
+template <typename Tuple, std::size_t... Is>
+consteval layout tuple_layout_of(std::index_sequence<Is...>)
+{
+    const std::array<layout, sizeof...(Is)> fields{
+        layout_of<std::remove_cvref_t<std::tuple_element_t<Is, Tuple>>>()...};
+
+    layout result{.supported = true, .fixed = true, .size = 0, .bitwise = true};
+    for (const auto& field : fields)
+    {
+        result.supported = result.supported && field.supported;
+        result.fixed = result.fixed && field.fixed;
+        result.size += field.size;
+        result.bitwise = result.bitwise && field.bitwise;
+    }
+    return result;
+}
+
+template <typename T>
+consteval layout layout_of()
+{
+    if constexpr (std::same_as<T, bool>)
+    {
+        // Only 0 and 1 are valid object representations, so other bytes must be rejected while decoding
+        return {.supported = true, .fixed = true, .size = 1, .bitwise = false};
+    }
+    else if constexpr (serializable_scalar<T> || std::same_as<T, std::byte>)
+    {
+        return {.supported = true, .fixed = true, .size = sizeof(T), .bitwise = true};
+    }
+    else if constexpr (is_std_array<T>::value)
+    {
+        constexpr auto element = layout_of<typename T::value_type>();
+        return {.supported = element.supported,
+                .fixed = element.fixed,
+                .size = element.size * std::tuple_size_v<T>,
+                .bitwise = element.bitwise && element.size * std::tuple_size_v<T> == sizeof(T)};
+    }
+    else if constexpr (serializable_string<T>)
+    {
+        return {.supported = true, .fixed = false, .size = 0, .bitwise = false};
+    }
+    else if constexpr (is_std_vector<T>::value || is_std_optional<T>::value)
+    {
+        return {.supported = layout_of<typename T::value_type>().supported,
+                .fixed = false,
+                .size = 0,
+                .bitwise = false};
+    }
+    else if constexpr (is_std_tuple<T>::value)
+    {
+        // The memory layout of std::tuple is unspecified, so it's never copied as a whole
+        auto result = tuple_layout_of<T>(std::make_index_sequence<std::tuple_size_v<T>>{});
+        result.bitwise = false;
+        return result;
+    }
+    else if constexpr (serializable_aggregate<T>)
+    {
+        using fields = field_types<T>;
+        auto result = tuple_layout_of<fields>(std::make_index_sequence<std::tuple_size_v<fields>>{});
+
+        // Without padding the fields of a standard layout aggregate are laid out exactly like the encoding
+        result.bitwise = result.bitwise && result.fixed && result.size == sizeof(T) &&
+                         std::is_standard_layout_v<T> && std::is_trivially_copyable_v<T>;
+        return result;
+    }
+    else
+    {
+        return {.supported = false, .fixed = false, .size = 0, .bitwise = false};
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Concept of types supported by lux::serialize and lux::deserialize.
+ */
+template <typename T>
+concept serializable = detail::layout_of<std::remove_cvref_t<T>>().supported;
+
+/**
+ * @brief Concept of types whose encoding has a size known at compile time.
+ */
+template <typename T>
+concept fixed_size_serializable = serializable<T> && detail::layout_of<std::remove_cvref_t<T>>().fixed;
+
+/**
+ * @brief Encoded size of a fixed-size type.
+ */
+template <fixed_size_serializable T>
+inline constexpr std::size_t fixed_serialized_size_v = detail::layout_of<T>().size;
+
+namespace detail {
+
+template <typename T>
+constexpr std::size_t encoded_size(const T& value) noexcept
+{
+    if constexpr (layout_of<T>().fixed)
+    {
+        return layout_of<T>().size;
+    }
+    else if constexpr (serializable_string<T>)
+    {
+        return lux::varint_size(value.size()) + value.size();
+    }
+    else if constexpr (is_std_vector<T>::value)
+    {
+        std::size_t size = lux::varint_size(value.size());
+        if constexpr (layout_of<typename T::value_type>().fixed)
+        {
+            size += value.size() * layout_of<typename T::value_type>().size;
+        }
+        else
+        {
+            for (const auto& element : value)
+            {
+                size += encoded_size(element);
+            }
+        }
+        return size;
+    }
+    else if constexpr (is_std_optional<T>::value)
+    {
+        return 1 + (value ? encoded_size(*value) : 0);
+    }
+    else if constexpr (is_std_array<T>::value)
+    {
+        std::size_t size = 0;
+        for (const auto& element : value)
+        {
+            size += encoded_size(element);
+        }
+        return size;
+    }
+    else
+    {
+        const auto fields = [&] {
+            if constexpr (is_std_tuple<T>::value)
+            {
+                return std::apply([](const auto&... f) { return std::tie(f...); }, value);
+            }
+            else
+            {
+                return tie_fields(value);
+            }
+        }();
+        return std::apply([](const auto&... f) { return (std::size_t{0} + ... + encoded_size(f)); }, fields);
+    }
+}
+
+template <typename T>
+void encode(lux::buffer_writer::reservation& out, const T& value) noexcept
+{
+    if constexpr (layout_of<T>().bitwise)
+    {
+        out.write(std::as_bytes(std::span{&value, 1}));
+    }
+    else if constexpr (std::same_as<T, bool>)
+    {
+        out.write(static_cast<std::uint8_t>(value));
+    }
+    else if constexpr (serializable_string<T>)
+    {
+        out.write_varint(value.size()).write(std::string_view{value});
+    }
+    else if constexpr (is_std_vector<T>::value)
+    {
+        out.write_varint(value.size());
+        if constexpr (layout_of<typename T::value_type>().bitwise)
+        {
+            out.write(std::as_bytes(std::span{value}));
+        }
+        else
+        {
+            for (const auto& element : value)
+            {
+                encode(out, element);
+            }
+        }
+    }
+    else if constexpr (is_std_optional<T>::value)
+    {
+        out.write(static_cast<std::uint8_t>(value.has_value()));
+        if (value)
+        {
+            encode(out, *value);
+        }
+    }
+    else if constexpr (is_std_array<T>::value)
+    {
+        for (const auto& element : value)
+        {
+            encode(out, element);
+        }
+    }
+    else if constexpr (is_std_tuple<T>::value)
+    {
+        std::apply([&](const auto&... f) { (encode(out, f), ...); }, value);
+    }
+    else
+    {
+        std::apply([&](const auto&... f) { (encode(out, f), ...); }, tie_fields(value));
+    }
+}
+
+template <typename T>
+void decode_fixed(lux::buffer_reader::reservation& in, T& value)
+{
+    if constexpr (layout_of<T>().bitwise)
+    {
+        in.read(value);
+    }
+    else if constexpr (std::same_as<T, bool>)
+    {
+        std::uint8_t byte = 0;
+        in.read(byte);
+        if (byte > 1)
+        {
+            throw lux::formatted_exception("Invalid bool value {}", byte);
+        }
+        value = byte != 0;
+    }
+    else if constexpr (is_std_array<T>::value)
+    {
+        for (auto& element : value)
+        {
+            decode_fixed(in, element);
+        }
+    }
+    else if constexpr (is_std_tuple<T>::value)
+    {
+        std::apply([&](auto&... f) { (decode_fixed(in, f), ...); }, value);
+    }
+    else
+    {
+        std::apply([&](auto&... f) { (decode_fixed(in, f), ...); }, tie_fields(value));
+    }
+}
+
+template <typename T>
+void decode(lux::buffer_reader& in, T& value)
+{
+    if constexpr (layout_of<T>().fixed)
+    {
+        // A single bounds check for the whole value
+        auto reservation = in.reserve(layout_of<T>().size);
+        decode_fixed(reservation, value);
+    }
+    else if constexpr (serializable_string<T>)
+    {
+        value = in.read_length_prefixed_string();
+    }
+    else if constexpr (is_std_vector<T>::value)
+    {
+        using element_type = typename T::value_type;
+
+        // Validate the count before allocating, the data may come from an untrusted source. Every element but
+        // those of fixed zero size takes at least one byte.
+        constexpr auto min_element_size = layout_of<element_type>().fixed ? layout_of<element_type>().size : 1;
+        const auto count = in.read_varint<std::size_t>();
+        if (count > in.remaining() / std::max<std::size_t>(min_element_size, 1))
+        {
+            throw lux::formatted_exception("Buffer underflow: vector of {} elements doesn't fit {} bytes remaining",
+                                           count,
+                                           in.remaining());
+        }
+
+        value.resize(count);
+        if constexpr (std::same_as<element_type, bool>)
+        {
+            // std::vector<bool> packs its elements, so they can't be read into by reference
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                bool element = false;
+                decode(in, element);
+                value[i] = element;
+            }
+        }
+        else if constexpr (layout_of<element_type>().bitwise)
+        {
+            if (count > 0)
+            {
+                const auto data = in.read_bytes(count * sizeof(element_type));
+                std::memcpy(value.data(), data.data(), data.size());
+            }
+        }
+        else
+        {
+            for (auto& element : value)
+            {
+                decode(in, element);
+            }
+        }
+    }
+    else if constexpr (is_std_optional<T>::value)
+    {
+        if (in.read<std::uint8_t>() != 0)
+        {
+            decode(in, value.emplace());
+        }
+        else
+        {
+            value.reset();
+        }
+    }
+    else if constexpr (is_std_array<T>::value)
+    {
+        for (auto& element : value)
+        {
+            decode(in, element);
+        }
+    }
+    else if constexpr (is_std_tuple<T>::value)
+    {
+        std::apply([&](auto&... f) { (decode(in, f), ...); }, value);
+    }
+    else
+    {
+        std::apply([&](auto&... f) { (decode(in, f), ...); }, tie_fields(value));
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Returns the number of bytes lux::serialize writes for the given value.
+ */
+template <serializable T>
+constexpr std::size_t serialized_size(const T& value) noexcept
+{
+    return detail::encoded_size(value);
+}
+
+/**
+ * @brief Writes the value with a single bounds check for the whole encoding.
+ * @param writer The writer to write to.
+ * @param value The value to write.
+ * @return Reference to the writer for chaining.
+ * @throws lux::formatted_exception if there's insufficient buffer space; nothing is written in that case.
+ */
+template <serializable T>
+lux::buffer_writer& serialize(lux::buffer_writer& writer, const T& value)
+{
+    auto reservation = writer.reserve(lux::serialized_size(value));
+    detail::encode(reservation, value);
+    return writer;
+}
+
+/**
+ * @brief Reads a value into an existing object.
+ * Strings read into std::string_view refer to the source buffer of the reader.
+ * @param reader The reader to read from.
+ * @param value The object to read into.
+ * @return Reference to the reader for chaining.
+ * @throws lux::formatted_exception if the data is truncated or malformed; the reader is left at an unspecified
+ * position within the value in that case.
+ */
+template <serializable T>
+lux::buffer_reader& deserialize(lux::buffer_reader& reader, T& value)
+{
+    detail::decode(reader, value);
+    return reader;
+}
+
+/**
+ * @brief Reads a value of a default constructible type.
+ * @param reader The reader to read from.
+ * @return The read value.
+ * @throws lux::formatted_exception if the data is truncated or malformed.
+ */
+template <serializable T>
+    requires std::default_initializable<T>
+T deserialize(lux::buffer_reader& reader)
+{
+    T value{};
+    detail::decode(reader, value);
+    return value;
+}
+
+} // namespace lux
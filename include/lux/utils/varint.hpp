@@ -0,0 +1,52 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace lux {
+
+/**
+ * @brief Maximum number of bytes of an unsigned LEB128 varint encoding a value of type T.
+ */
+template <std::unsigned_integral T>
+inline constexpr std::size_t max_varint_size = (std::numeric_limits<T>::digits + 6) / 7;
+
+/**
+ * @brief Returns the number of bytes of the unsigned LEB128 encoding of the given value.
+ */
+template <std::unsigned_integral T>
+constexpr std::size_t varint_size(T value) noexcept
+{
+    std::size_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+/**
+ * @brief Maps a signed integer onto an unsigned one so that values of small magnitude stay small
+ * (0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...), which keeps their varint encoding short.
+ */
+template <std::signed_integral T>
+constexpr std::make_unsigned_t<T> zigzag_encode(T value) noexcept
+{
+    using unsigned_type = std::make_unsigned_t<T>;
+    return static_cast<unsigned_type>(static_cast<unsigned_type>(value) << 1) ^
+           static_cast<unsigned_type>(value >> std::numeric_limits<T>::digits);
+}
+
+/**
+ * @brief Reverses zigzag_encode.
+ */
+template <std::unsigned_integral T>
+constexpr std::make_signed_t<T> zigzag_decode(T value) noexcept
+{
+    return static_cast<std::make_signed_t<T>>(static_cast<T>(value >> 1) ^ static_cast<T>(-(value & 1)));
+}
+
+} // namespace lux
@@ -0,0 +1,458 @@
+#include <lux/crypto/aead.hpp>
+
+#include <lux/crypto/detail/openssl_utils.hpp>
+#include <lux/support/move.hpp>
+
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#ifdef OPENSSL_IS_BORINGSSL
+#include <openssl/aead.h>
+#endif
+
+#include <algorithm>
+#include <climits>
+#include <memory>
+
+namespace lux::crypto {
+
+namespace detail {
+
+#ifdef OPENSSL_IS_BORINGSSL
+
+// BoringSSL only offers ChaCha20-Poly1305 through the EVP_AEAD interface, which seals and opens in a single call
+struct aead_ctx
+{
+    aead_ctx()
+    {
+        EVP_AEAD_CTX_zero(&ctx);
+    }
+
+    ~aead_ctx()
+    {
+        EVP_AEAD_CTX_cleanup(&ctx);
+    }
+
+    aead_ctx(const aead_ctx&) = delete;
+    aead_ctx& operator=(const aead_ctx&) = delete;
+
+    EVP_AEAD_CTX ctx;
+};
+
+#else
+
+struct cipher_ctx_deleter
+{
+    void operator()(EVP_CIPHER_CTX* ctx) const
+    {
+        if (ctx)
+        {
+            EVP_CIPHER_CTX_free(ctx);
+        }
+    }
+};
+
+using cipher_ctx_ptr = std::unique_ptr<EVP_CIPHER_CTX, cipher_ctx_deleter>;
+
+struct aead_ctx
+{
+    cipher_ctx_ptr encrypt;
+    cipher_ctx_ptr decrypt;
+};
+
+#endif
+
+void aead_ctx_deleter::operator()(aead_ctx* ctx) const noexcept
+{
+    delete ctx;
+}
+
+} // namespace detail
+
+namespace {
+
+const char* cipher_name(aead_algorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case aead_algorithm::aes_128_gcm:
+        return "AES-128-GCM";
+    case aead_algorithm::aes_256_gcm:
+        return "AES-256-GCM";
+    case aead_algorithm::chacha20_poly1305:
+        return "ChaCha20-Poly1305";
+    }
+    return "unknown";
+}
+
+lux::status check_nonce(std::span<const std::byte> nonce)
+{
+    if (nonce.size() != aead_nonce_size)
+    {
+        return lux::err("Invalid AEAD nonce size (expected={}, actual={})", aead_nonce_size, nonce.size());
+    }
+    return lux::ok();
+}
+
+lux::status check_tag(std::span<const std::byte> tag)
+{
+    if (tag.size() != aead_tag_size)
+    {
+        return lux::err("Invalid AEAD tag size (expected={}, actual={})", aead_tag_size, tag.size());
+    }
+    return lux::ok();
+}
+
+#ifdef OPENSSL_IS_BORINGSSL
+
+const EVP_AEAD* get_aead(aead_algorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case aead_algorithm::aes_128_gcm:
+        return EVP_aead_aes_128_gcm();
+    case aead_algorithm::aes_256_gcm:
+        return EVP_aead_aes_256_gcm();
+    case aead_algorithm::chacha20_poly1305:
+        return EVP_aead_chacha20_poly1305();
+    }
+    return nullptr;
+}
+
+lux::result<std::unique_ptr<detail::aead_ctx, detail::aead_ctx_deleter>>
+    make_aead_ctx(aead_algorithm algorithm, std::span<const std::byte> key)
+{
+    std::unique_ptr<detail::aead_ctx, detail::aead_ctx_deleter> ctx{new detail::aead_ctx{}};
+
+    // The key schedule is computed here once; the context is reused for every message
+    if (EVP_AEAD_CTX_init(&ctx->ctx,
+                          get_aead(algorithm),
+                          detail::as_uint8_ptr(key.data()),
+                          key.size(),
+                          aead_tag_size,
+                          nullptr) <= 0)
+    {
+        return lux::err("Failed to initialize {} (err={})", cipher_name(algorithm), detail::get_openssl_error());
+    }
+
+    return ctx;
+}
+
+lux::status seal_in_place(detail::aead_ctx& ctx,
+                          std::span<const std::byte> nonce,
+                          std::span<const std::byte> aad,
+                          std::span<std::byte> data,
+                          std::span<std::byte> tag)
+{
+    std::size_t tag_len{0};
+    if (EVP_AEAD_CTX_seal_scatter(&ctx.ctx,
+                                  detail::as_uint8_ptr(data.data()),
+                                  detail::as_uint8_ptr(tag.data()),
+                                  &tag_len,
+                                  tag.size(),
+                                  detail::as_uint8_ptr(nonce.data()),
+                                  nonce.size(),
+                                  detail::as_uint8_ptr(data.data()),
+                                  data.size(),
+                                  nullptr,
+                                  0,
+                                  detail::as_uint8_ptr(aad.data()),
+                                  aad.size()) <= 0)
+    {
+        return lux::err("Failed to seal AEAD data (err={})", detail::get_openssl_error());
+    }
+    return lux::ok();
+}
+
+lux::status open_in_place(detail::aead_ctx& ctx,
+                          std::span<const std::byte> nonce,
+                          std::span<const std::byte> aad,
+                          std::span<std::byte> data,
+                          std::span<const std::byte> tag)
+{
+    if (EVP_AEAD_CTX_open_gather(&ctx.ctx,
+                                 detail::as_uint8_ptr(data.data()),
+                                 detail::as_uint8_ptr(nonce.data()),
+                                 nonce.size(),
+                                 detail::as_uint8_ptr(data.data()),
+                                 data.size(),
+                                 detail::as_uint8_ptr(tag.data()),
+                                 tag.size(),
+                                 detail::as_uint8_ptr(aad.data()),
+                                 aad.size()) <= 0)
+    {
+        return lux::err("AEAD authentication failed");
+    }
+    return lux::ok();
+}
+
+#else
+
+const EVP_CIPHER* get_cipher(aead_algorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case aead_algorithm::aes_128_gcm:
+        return EVP_aes_128_gcm();
+    case aead_algorithm::aes_256_gcm:
+        return EVP_aes_256_gcm();
+    case aead_algorithm::chacha20_poly1305:
+        return EVP_chacha20_poly1305();
+    }
+    return nullptr;
+}
+
+// EVP lengths are ints, larger buffers are processed in several steps
+template <typename Update>
+bool update_in_steps(std::span<const std::byte> input, std::byte* output, Update&& update)
+{
+    constexpr std::size_t max_step = INT_MAX & ~std::size_t{0xFF};
+    do
+    {
+        const auto step = std::min(input.size(), max_step);
+        int len{0};
+        if (update(output ? detail::as_uint8_ptr(output) : nullptr,
+                   &len,
+                   detail::as_uint8_ptr(input.data()),
+                   static_cast<int>(step)) <= 0)
+        {
+            return false;
+        }
+
+        input = input.subspan(step);
+        if (output)
+        {
+            output += step;
+        }
+    } while (!input.empty());
+    return true;
+}
+
+lux::result<detail::cipher_ctx_ptr>
+    make_cipher_ctx(aead_algorithm algorithm, std::span<const std::byte> key, bool encrypt)
+{
+    detail::cipher_ctx_ptr ctx{EVP_CIPHER_CTX_new()};
+    if (!ctx)
+    {
+        return lux::err("Failed to create EVP_CIPHER_CTX (err={})", detail::get_openssl_error());
+    }
+
+    // The key schedule is computed here once; each message only sets its nonce
+    if (EVP_CipherInit_ex(ctx.get(),
+                          get_cipher(algorithm),
+                          nullptr,
+                          detail::as_uint8_ptr(key.data()),
+                          nullptr,
+                          encrypt ? 1 : 0) <= 0)
+    {
+        return lux::err("Failed to initialize {} (err={})", cipher_name(algorithm), detail::get_openssl_error());
+    }
+
+    return ctx;
+}
+
+lux::result<std::unique_ptr<detail::aead_ctx, detail::aead_ctx_deleter>>
+    make_aead_ctx(aead_algorithm algorithm, std::span<const std::byte> key)
+{
+    auto encrypt_ctx = make_cipher_ctx(algorithm, key, true);
+    if (!encrypt_ctx)
+    {
+        return lux::err(lux::move(encrypt_ctx.error()));
+    }
+
+    auto decrypt_ctx = make_cipher_ctx(algorithm, key, false);
+    if (!decrypt_ctx)
+    {
+        return lux::err(lux::move(decrypt_ctx.error()));
+    }
+
+    return std::unique_ptr<detail::aead_ctx, detail::aead_ctx_deleter>{
+        new detail::aead_ctx{lux::move(*encrypt_ctx), lux::move(*decrypt_ctx)}};
+}
+
+lux::status seal_in_place(detail::aead_ctx& aead_ctx,
+                          std::span<const std::byte> nonce,
+                          std::span<const std::byte> aad,
+                          std::span<std::byte> data,
+                          std::span<std::byte> tag)
+{
+    EVP_CIPHER_CTX* ctx{aead_ctx.encrypt.get()};
+    if (EVP_EncryptInit_ex(ctx, nullptr, nullptr, nullptr, detail::as_uint8_ptr(nonce.data())) <= 0)
+    {
+        return lux::err("Failed to set AEAD nonce (err={})", detail::get_openssl_error());
+    }
+
+    const auto encrypt_update = [ctx](auto* out, int* out_len, const auto* in, int in_len) {
+        return EVP_EncryptUpdate(ctx, out, out_len, in, in_len);
+    };
+
+    if (!aad.empty() && !update_in_steps(aad, nullptr, encrypt_update))
+    {
+        return lux::err("Failed to authenticate AEAD associated data (err={})", detail::get_openssl_error());
+    }
+
+    if (!data.empty() && !update_in_steps(data, data.data(), encrypt_update))
+    {
+        return lux::err("Failed to encrypt AEAD data (err={})", detail::get_openssl_error());
+    }
+
+    int len{0};
+    if (EVP_EncryptFinal_ex(ctx, nullptr, &len) <= 0)
+    {
+        return lux::err("Failed to finalize AEAD encryption (err={})", detail::get_openssl_error());
+    }
+
+    if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, static_cast<int>(tag.size()), tag.data()) <= 0)
+    {
+        return lux::err("Failed to get AEAD tag (err={})", detail::get_openssl_error());
+    }
+
+    return lux::ok();
+}
+
+lux::status open_in_place(detail::aead_ctx& aead_ctx,
+                          std::span<const std::byte> nonce,
+                          std::span<const std::byte> aad,
+                          std::span<std::byte> data,
+                          std::span<const std::byte> tag)
+{
+    EVP_CIPHER_CTX* ctx{aead_ctx.decrypt.get()};
+    if (EVP_DecryptInit_ex(ctx, nullptr, nullptr, nullptr, detail::as_uint8_ptr(nonce.data())) <= 0)
+    {
+        return lux::err("Failed to set AEAD nonce (err={})", detail::get_openssl_error());
+    }
+
+    const auto decrypt_update = [ctx](auto* out, int* out_len, const auto* in, int in_len) {
+        return EVP_DecryptUpdate(ctx, out, out_len, in, in_len);
+    };
+
+    if (!aad.empty() && !update_in_steps(aad, nullptr, decrypt_update))
+    {
+        return lux::err("Failed to authenticate AEAD associated data (err={})", detail::get_openssl_error());
+    }
+
+    if (!data.empty() && !update_in_steps(data, data.data(), decrypt_update))
+    {
+        return lux::err("Failed to decrypt AEAD data (err={})", detail::get_openssl_error());
+    }
+
+    // The expected tag is only read by the context, the API just isn't const-correct
+    auto* expected_tag = const_cast<std::byte*>(tag.data());
+    if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_TAG, static_cast<int>(tag.size()), expected_tag) <= 0)
+    {
+        return lux::err("Failed to set AEAD tag (err={})", detail::get_openssl_error());
+    }
+
+    int len{0};
+    if (EVP_DecryptFinal_ex(ctx, nullptr, &len) <= 0)
+    {
+        return lux::err("AEAD authentication failed");
+    }
+
+    return lux::ok();
+}
+
+#endif
+
+} // namespace
+
+// lux::crypto::aead_cipher implementation
+
+lux::status aead_cipher::seal(std::span<const std::byte> nonce,
+                              std::span<const std::byte> aad,
+                              std::span<std::byte> data,
+                              std::span<std::byte> tag)
+{
+    if (auto res = check_nonce(nonce); !res)
+    {
+        return res;
+    }
+
+    if (auto res = check_tag(tag); !res)
+    {
+        return res;
+    }
+
+    return seal_in_place(*ctx_, nonce, aad, data, tag);
+}
+
+lux::status aead_cipher::seal(std::span<const std::byte> nonce,
+                              std::span<const std::byte> aad,
+                              std::span<std::byte> message)
+{
+    if (message.size() < aead_tag_size)
+    {
+        return lux::err("AEAD message too short for the tag (size={})", message.size());
+    }
+
+    const auto payload_size = message.size() - aead_tag_size;
+    return seal(nonce, aad, message.first(payload_size), message.subspan(payload_size));
+}
+
+lux::status aead_cipher::open(std::span<const std::byte> nonce,
+                              std::span<const std::byte> aad,
+                              std::span<std::byte> data,
+                              std::span<const std::byte> tag)
+{
+    if (auto res = check_nonce(nonce); !res)
+    {
+        return res;
+    }
+
+    if (auto res = check_tag(tag); !res)
+    {
+        return res;
+    }
+
+    // Unauthenticated plaintext is wiped whatever step failed
+    auto res = open_in_place(*ctx_, nonce, aad, data, tag);
+    if (!res)
+    {
+        OPENSSL_cleanse(data.data(), data.size());
+
+        // Tampered messages are expected here, don't let them pile up in the error queue of the thread
+        ERR_clear_error();
+    }
+    return res;
+}
+
+lux::result<std::span<std::byte>> aead_cipher::open(std::span<const std::byte> nonce,
+                                                    std::span<const std::byte> aad,
+                                                    std::span<std::byte> message)
+{
+    if (message.size() < aead_tag_size)
+    {
+        return lux::err("AEAD message too short for the tag (size={})", message.size());
+    }
+
+    const auto payload = message.first(message.size() - aead_tag_size);
+    if (auto res = open(nonce, aad, payload, message.subspan(payload.size())); !res)
+    {
+        return lux::err(lux::move(res.error()));
+    }
+
+    return payload;
+}
+
+// Free functions implementation
+
+lux::result<aead_cipher> make_aead_cipher(aead_algorithm algorithm, std::span<const std::byte> key)
+{
+    if (key.size() != aead_key_size(algorithm))
+    {
+        return lux::err("Invalid {} key size (expected={}, actual={})",
+                        cipher_name(algorithm),
+                        aead_key_size(algorithm),
+                        key.size());
+    }
+
+    auto ctx = make_aead_ctx(algorithm, key);
+    if (!ctx)
+    {
+        return lux::err(lux::move(ctx.error()));
+    }
+
+    return aead_cipher{algorithm, lux::move(*ctx)};
+}
+
+} // namespace lux::crypto
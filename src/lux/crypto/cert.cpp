@@ -8,10 +8,15 @@
 #include <openssl/pem.h>
 #include <openssl/bio.h>
 #include <openssl/asn1.h>
+#include <openssl/bn.h>
+#include <openssl/err.h>
+#include <openssl/rand.h>
 
+#include <array>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <utility>
 
 namespace lux::crypto {
 
@@ -99,6 +104,267 @@ lux::result<X509_NAME*> create_subject_name(const subject_info& subject)
     return name.release();
 }
 
+lux::result<GENERAL_NAME*> create_general_name(const std::string& san)
+{
+    detail::general_name_ptr gen{GENERAL_NAME_new()};
+    if (!gen)
+    {
+        return lux::err("Failed to create GENERAL_NAME (err={})", detail::get_openssl_error());
+    }
+
+    // Names that parse as an IP address are added as such, so certificates for local endpoints verify
+    if (ASN1_OCTET_STRING* ip{a2i_IPADDRESS(san.c_str())})
+    {
+        gen->type = GEN_IPADD;
+        gen->d.iPAddress = ip;
+        return gen.release();
+    }
+    ERR_clear_error();
+
+    ASN1_IA5STRING* ia5{ASN1_IA5STRING_new()};
+    if (!ia5)
+    {
+        return lux::err("Failed to create ASN1_IA5STRING (err={})", detail::get_openssl_error());
+    }
+
+    if (ASN1_STRING_set(ia5, san.c_str(), static_cast<int>(san.length())) != 1)
+    {
+        ASN1_IA5STRING_free(ia5);
+        return lux::err("Failed to set ASN1_IA5STRING (err={})", detail::get_openssl_error());
+    }
+
+    gen->type = GEN_DNS;
+    gen->d.dNSName = ia5;
+    return gen.release();
+}
+
+lux::result<X509_EXTENSION*> create_san_extension(const std::vector<std::string>& subject_alt_names)
+{
+    GENERAL_NAMES* gens{sk_GENERAL_NAME_new_null()};
+    if (!gens)
+    {
+        return lux::err("Failed to create GENERAL_NAMES (err={})", detail::get_openssl_error());
+    }
+
+    for (const auto& san : subject_alt_names)
+    {
+        auto gen = create_general_name(san);
+        if (!gen)
+        {
+            sk_GENERAL_NAME_pop_free(gens, GENERAL_NAME_free);
+            return lux::err(lux::move(gen.error()));
+        }
+
+        if (sk_GENERAL_NAME_push(gens, *gen) == 0)
+        {
+            GENERAL_NAME_free(*gen);
+            sk_GENERAL_NAME_pop_free(gens, GENERAL_NAME_free);
+            return lux::err("Failed to add GENERAL_NAME (err={})", detail::get_openssl_error());
+        }
+    }
+
+    X509_EXTENSION* ext{X509V3_EXT_i2d(NID_subject_alt_name, 0, gens)};
+    sk_GENERAL_NAME_pop_free(gens, GENERAL_NAME_free);
+
+    if (!ext)
+    {
+        return lux::err("Failed to create SAN extension (err={})", detail::get_openssl_error());
+    }
+
+    return ext;
+}
+
+detail::evp_pkey_ptr make_private_pkey(const ed25519_private_key& private_key)
+{
+    return detail::evp_pkey_ptr{EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519,
+                                                             nullptr,
+                                                             detail::as_uint8_ptr(private_key.data.data()),
+                                                             private_key.data.size())};
+}
+
+detail::evp_pkey_ptr make_public_pkey(const ed25519_public_key& public_key)
+{
+    return detail::evp_pkey_ptr{EVP_PKEY_new_raw_public_key(EVP_PKEY_ED25519,
+                                                            nullptr,
+                                                            detail::as_uint8_ptr(public_key.data.data()),
+                                                            public_key.data.size())};
+}
+
+lux::status add_extension(X509* cert, X509V3_CTX* ctx, int nid, const char* value)
+{
+    X509_EXTENSION* ext{X509V3_EXT_conf_nid(nullptr, ctx, nid, value)};
+    if (!ext)
+    {
+        return lux::err("Failed to create {} extension (err={})", OBJ_nid2sn(nid), detail::get_openssl_error());
+    }
+
+    const int added{X509_add_ext(cert, ext, -1)};
+    X509_EXTENSION_free(ext);
+    if (added != 1)
+    {
+        return lux::err("Failed to add {} extension (err={})", OBJ_nid2sn(nid), detail::get_openssl_error());
+    }
+
+    return lux::ok();
+}
+
+lux::status set_random_serial(X509* cert)
+{
+    // 16 random bytes with the top bit cleared, a positive serial as required by RFC 5280
+    std::array<unsigned char, 16> serial{};
+    if (RAND_bytes(serial.data(), static_cast<int>(serial.size())) != 1)
+    {
+        return lux::err("Failed to generate serial number (err={})", detail::get_openssl_error());
+    }
+    serial[0] &= 0x7F;
+
+    BIGNUM* bn{BN_bin2bn(serial.data(), static_cast<int>(serial.size()), nullptr)};
+    if (!bn)
+    {
+        return lux::err("Failed to create serial number (err={})", detail::get_openssl_error());
+    }
+
+    const bool set{BN_to_ASN1_INTEGER(bn, X509_get_serialNumber(cert)) != nullptr};
+    BN_free(bn);
+    if (!set)
+    {
+        return lux::err("Failed to set serial number (err={})", detail::get_openssl_error());
+    }
+
+    return lux::ok();
+}
+
+/**
+ * Builds and signs a certificate for the subject key. Without an issuer certificate the certificate is self-signed.
+ */
+lux::result<detail::x509_ptr> build_cert(EVP_PKEY* subject_key,
+                                         const subject_info& subject,
+                                         EVP_PKEY* issuer_key,
+                                         X509* issuer_cert,
+                                         const cert_options& options)
+{
+    detail::x509_ptr cert{X509_new()};
+    if (!cert)
+    {
+        return lux::err("Failed to create X509 (err={})", detail::get_openssl_error());
+    }
+
+    if (X509_set_version(cert.get(), 2) != 1)
+    {
+        return lux::err("Failed to set X509 version (err={})", detail::get_openssl_error());
+    }
+
+    if (auto res = set_random_serial(cert.get()); !res)
+    {
+        return lux::err(lux::move(res.error()));
+    }
+
+    // Backdated slightly to tolerate clock skew between the peers
+    const long not_before_offset{-60};
+    const long valid_for{static_cast<long>(options.valid_for.count())};
+    if (!X509_gmtime_adj(X509_getm_notBefore(cert.get()), not_before_offset) ||
+        !X509_gmtime_adj(X509_getm_notAfter(cert.get()), valid_for))
+    {
+        return lux::err("Failed to set validity period (err={})", detail::get_openssl_error());
+    }
+
+    auto name_result = create_subject_name(subject);
+    if (!name_result)
+    {
+        return lux::err(lux::move(name_result.error()));
+    }
+
+    detail::x509_name_ptr name{*name_result};
+    if (X509_set_subject_name(cert.get(), name.get()) != 1)
+    {
+        return lux::err("Failed to set subject name (err={})", detail::get_openssl_error());
+    }
+
+    X509_NAME* issuer_name{issuer_cert ? X509_get_subject_name(issuer_cert) : name.get()};
+    if (X509_set_issuer_name(cert.get(), issuer_name) != 1)
+    {
+        return lux::err("Failed to set issuer name (err={})", detail::get_openssl_error());
+    }
+
+    if (X509_set_pubkey(cert.get(), subject_key) != 1)
+    {
+        return lux::err("Failed to set public key (err={})", detail::get_openssl_error());
+    }
+
+    X509V3_CTX ctx;
+    X509V3_set_ctx(&ctx, issuer_cert ? issuer_cert : cert.get(), cert.get(), nullptr, nullptr, 0);
+
+    const auto* basic_constraints = options.is_ca ? "critical,CA:TRUE" : "critical,CA:FALSE";
+    const auto* key_usage =
+        options.is_ca ? "critical,keyCertSign,cRLSign,digitalSignature" : "critical,digitalSignature";
+
+    for (const auto& [nid, value] : {std::pair{NID_basic_constraints, basic_constraints},
+                                     std::pair{NID_key_usage, key_usage},
+                                     std::pair{NID_subject_key_identifier, "hash"},
+                                     std::pair{NID_authority_key_identifier, "keyid:always"}})
+    {
+        if (auto res = add_extension(cert.get(), &ctx, nid, value); !res)
+        {
+            return lux::err(lux::move(res.error()));
+        }
+    }
+
+    if (!options.is_ca)
+    {
+        if (auto res = add_extension(cert.get(), &ctx, NID_ext_key_usage, "serverAuth,clientAuth"); !res)
+        {
+            return lux::err(lux::move(res.error()));
+        }
+    }
+
+    if (!subject.subject_alt_names.empty())
+    {
+        auto ext_result = create_san_extension(subject.subject_alt_names);
+        if (!ext_result)
+        {
+            return lux::err(lux::move(ext_result.error()));
+        }
+
+        const int added{X509_add_ext(cert.get(), *ext_result, -1)};
+        X509_EXTENSION_free(*ext_result);
+        if (added != 1)
+        {
+            return lux::err("Failed to add SAN extension (err={})", detail::get_openssl_error());
+        }
+    }
+
+    // Ed25519 signatures don't use a separate digest
+    if (X509_sign(cert.get(), issuer_key, nullptr) <= 0)
+    {
+        return lux::err("Failed to sign certificate (err={})", detail::get_openssl_error());
+    }
+
+    return cert;
+}
+
+lux::result<cert_der> to_der(X509* cert)
+{
+    unsigned char* der_data{nullptr};
+    int der_len{i2d_X509(cert, &der_data)};
+    if (der_len < 0)
+    {
+        return lux::err("Failed to encode certificate to DER (err={})", detail::get_openssl_error());
+    }
+
+    const std::byte* der_data_as_bytes = reinterpret_cast<std::byte*>(der_data);
+    std::vector<std::byte> der_vec{der_data_as_bytes, der_data_as_bytes + der_len};
+    OPENSSL_free(der_data);
+
+    return cert_der{lux::move(der_vec)};
+}
+
+std::shared_ptr<X509> parse_cert(const cert_der& der)
+{
+    const unsigned char* der_ptr{detail::as_uint8_ptr(der.get().data())};
+    X509* cert{d2i_X509(nullptr, &der_ptr, static_cast<long>(der.get().size()))};
+    return std::shared_ptr<X509>{cert, detail::x509_deleter{}};
+}
+
 } // anonymous namespace
 
 lux::result<csr_der> generate_csr(const lux::crypto::ed25519_private_key& private_key, const subject_info& subject)
@@ -144,67 +410,22 @@ lux::result<csr_der> generate_csr(const lux::crypto::ed25519_private_key& privat
 
     if (!subject.subject_alt_names.empty())
     {
-        GENERAL_NAMES* gens{sk_GENERAL_NAME_new_null()};
-        if (!gens)
+        auto ext_result = create_san_extension(subject.subject_alt_names);
+        if (!ext_result)
         {
-            return lux::err("Failed to create GENERAL_NAMES (err={})", detail::get_openssl_error());
-        }
-
-        for (const auto& san : subject.subject_alt_names)
-        {
-            GENERAL_NAME* gen{GENERAL_NAME_new()};
-            if (!gen)
-            {
-                sk_GENERAL_NAME_pop_free(gens, GENERAL_NAME_free);
-                return lux::err("Failed to create GENERAL_NAME (err={})", detail::get_openssl_error());
-            }
-
-            ASN1_IA5STRING* ia5{ASN1_IA5STRING_new()};
-            if (!ia5)
-            {
-                GENERAL_NAME_free(gen);
-                sk_GENERAL_NAME_pop_free(gens, GENERAL_NAME_free);
-                return lux::err("Failed to create ASN1_IA5STRING (err={})", detail::get_openssl_error());
-            }
-
-            if (ASN1_STRING_set(ia5, san.c_str(), static_cast<int>(san.length())) != 1)
-            {
-                ASN1_IA5STRING_free(ia5);
-                GENERAL_NAME_free(gen);
-                sk_GENERAL_NAME_pop_free(gens, GENERAL_NAME_free);
-                return lux::err("Failed to set ASN1_IA5STRING (err={})", detail::get_openssl_error());
-            }
-
-            gen->type = GEN_DNS;
-            gen->d.dNSName = ia5;
-
-            if (sk_GENERAL_NAME_push(gens, gen) == 0)
-            {
-                GENERAL_NAME_free(gen);
-                sk_GENERAL_NAME_pop_free(gens, GENERAL_NAME_free);
-                return lux::err("Failed to add GENERAL_NAME (err={})", detail::get_openssl_error());
-            }
+            return lux::err(lux::move(ext_result.error()));
         }
 
         X509_EXTENSIONS* exts{sk_X509_EXTENSION_new_null()};
         if (!exts)
         {
-            sk_GENERAL_NAME_pop_free(gens, GENERAL_NAME_free);
+            X509_EXTENSION_free(*ext_result);
             return lux::err("Failed to create X509_EXTENSIONS (err={})", detail::get_openssl_error());
         }
 
-        X509_EXTENSION* ext{X509V3_EXT_i2d(NID_subject_alt_name, 0, gens)};
-        sk_GENERAL_NAME_pop_free(gens, GENERAL_NAME_free);
-
-        if (!ext)
-        {
-            sk_X509_EXTENSION_pop_free(exts, X509_EXTENSION_free);
-            return lux::err("Failed to create SAN extension (err={})", detail::get_openssl_error());
-        }
-
-        if (sk_X509_EXTENSION_push(exts, ext) == 0)
+        if (sk_X509_EXTENSION_push(exts, *ext_result) == 0)
         {
-            X509_EXTENSION_free(ext);
+            X509_EXTENSION_free(*ext_result);
             sk_X509_EXTENSION_pop_free(exts, X509_EXTENSION_free);
             return lux::err("Failed to add SAN extension (err={})", detail::get_openssl_error());
         }
@@ -268,4 +489,147 @@ lux::result<csr_pem> to_pem(const csr_der& der_csr)
     return csr_pem{std::string{data, static_cast<std::size_t>(len)}};
 }
 
-} // namespace lux::crypto
+lux::result<cert_der> generate_self_signed_cert(const ed25519_private_key& private_key,
+                                                const subject_info& subject,
+                                                const cert_options& options)
+{
+    detail::evp_pkey_ptr pkey{make_private_pkey(private_key)};
+    if (!pkey)
+    {
+        return lux::err("Failed to create EVP_PKEY from private key (err={})", detail::get_openssl_error());
+    }
+
+    auto cert = build_cert(pkey.get(), subject, pkey.get(), nullptr, options);
+    if (!cert)
+    {
+        return lux::err(lux::move(cert.error()));
+    }
+
+    return to_der(cert->get());
+}
+
+lux::result<cert_der> issue_cert(const ed25519_public_key& subject_key,
+                                 const subject_info& subject,
+                                 const ed25519_private_key& issuer_key,
+                                 const cert_der& issuer_cert,
+                                 const cert_options& options)
+{
+    detail::evp_pkey_ptr subject_pkey{make_public_pkey(subject_key)};
+    if (!subject_pkey)
+    {
+        return lux::err("Failed to create EVP_PKEY from public key (err={})", detail::get_openssl_error());
+    }
+
+    detail::evp_pkey_ptr issuer_pkey{make_private_pkey(issuer_key)};
+    if (!issuer_pkey)
+    {
+        return lux::err("Failed to create EVP_PKEY from private key (err={})", detail::get_openssl_error());
+    }
+
+    const auto issuer_x509 = parse_cert(issuer_cert);
+    if (!issuer_x509)
+    {
+        return lux::err("Failed to decode DER certificate (err={})", detail::get_openssl_error());
+    }
+
+    auto cert = build_cert(subject_pkey.get(), subject, issuer_pkey.get(), issuer_x509.get(), options);
+    if (!cert)
+    {
+        return lux::err(lux::move(cert.error()));
+    }
+
+    return to_der(cert->get());
+}
+
+lux::result<cert_pem> to_pem(const cert_der& der_cert)
+{
+    const auto cert = parse_cert(der_cert);
+    if (!cert)
+    {
+        return lux::err("Failed to decode DER certificate (err={})", detail::get_openssl_error());
+    }
+
+    detail::bio_ptr bio{BIO_new(BIO_s_mem())};
+    if (!bio)
+    {
+        return lux::err("Failed to create memory BIO (err={})", detail::get_openssl_error());
+    }
+
+    if (PEM_write_bio_X509(bio.get(), cert.get()) != 1)
+    {
+        return lux::err("Failed to write certificate to PEM (err={})", detail::get_openssl_error());
+    }
+
+    char* data{nullptr};
+    long len{BIO_get_mem_data(bio.get(), &data)};
+    if (len <= 0)
+    {
+        return lux::err("Failed to get PEM data from BIO");
+    }
+
+    return cert_pem{std::string{data, static_cast<std::size_t>(len)}};
+}
+
+// lux::crypto::certificate_authority implementation
+
+lux::result<issued_cert> certificate_authority::issue(const subject_info& subject, const cert_options& options) const
+{
+    auto private_key = generate_ed25519_private_key();
+    if (!private_key)
+    {
+        return lux::err(lux::move(private_key.error()));
+    }
+
+    detail::evp_pkey_ptr subject_pkey{make_private_pkey(*private_key)};
+    if (!subject_pkey)
+    {
+        return lux::err("Failed to create EVP_PKEY from private key (err={})", detail::get_openssl_error());
+    }
+
+    auto cert = build_cert(subject_pkey.get(), subject, key_.get(), x509_.get(), options);
+    if (!cert)
+    {
+        return lux::err(lux::move(cert.error()));
+    }
+
+    auto der = to_der(cert->get());
+    if (!der)
+    {
+        return lux::err(lux::move(der.error()));
+    }
+
+    return issued_cert{.private_key = lux::move(*private_key), .cert = lux::move(*der)};
+}
+
+lux::result<certificate_authority> make_certificate_authority(const subject_info& subject,
+                                                              std::chrono::seconds valid_for)
+{
+    auto private_key = generate_ed25519_private_key();
+    if (!private_key)
+    {
+        return lux::err(lux::move(private_key.error()));
+    }
+
+    auto cert = generate_self_signed_cert(*private_key, subject, {.valid_for = valid_for, .is_ca = true});
+    if (!cert)
+    {
+        return lux::err(lux::move(cert.error()));
+    }
+
+    // Parsed once here, so issuing doesn't decode the CA key and certificate again
+    std::shared_ptr<EVP_PKEY> key{make_private_pkey(*private_key).release(), detail::evp_pkey_deleter{}};
+    if (!key)
+    {
+        return lux::err("Failed to create EVP_PKEY from private key (err={})", detail::get_openssl_error());
+    }
+
+    auto x509 = parse_cert(*cert);
+    if (!x509)
+    {
+        return lux::err("Failed to decode DER certificate (err={})", detail::get_openssl_error());
+    }
+
+    return certificate_authority{lux::move(*private_key), lux::move(*cert), lux::move(key), lux::move(x509)};
+}
+
+} // namespace lux::crypto
\ No newline at end of file
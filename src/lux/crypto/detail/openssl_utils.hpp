@@ -3,6 +3,7 @@
 #include <openssl/bio.h>
 #include <openssl/evp.h>
 #include <openssl/x509.h>
+#include <openssl/x509v3.h>
 
 #include <cstddef>
 #include <cstdint>
@@ -49,6 +50,19 @@ struct evp_pkey_ctx_deleter
 
 using evp_pkey_ctx_ptr = std::unique_ptr<EVP_PKEY_CTX, evp_pkey_ctx_deleter>;
 
+struct evp_md_ctx_deleter
+{
+    void operator()(EVP_MD_CTX* ctx) const
+    {
+        if (ctx)
+        {
+            EVP_MD_CTX_free(ctx);
+        }
+    }
+};
+
+using evp_md_ctx_ptr = std::unique_ptr<EVP_MD_CTX, evp_md_ctx_deleter>;
+
 struct bio_deleter
 {
     void operator()(BIO* bio) const
@@ -62,6 +76,19 @@ struct bio_deleter
 
 using bio_ptr = std::unique_ptr<BIO, bio_deleter>;
 
+struct x509_deleter
+{
+    void operator()(X509* x509) const
+    {
+        if (x509)
+        {
+            X509_free(x509);
+        }
+    }
+};
+
+using x509_ptr = std::unique_ptr<X509, x509_deleter>;
+
 struct x509_req_deleter
 {
     void operator()(X509_REQ* req) const
@@ -88,4 +115,17 @@ struct x509_name_deleter
 
 using x509_name_ptr = std::unique_ptr<X509_NAME, x509_name_deleter>;
 
+struct general_name_deleter
+{
+    void operator()(GENERAL_NAME* name) const
+    {
+        if (name)
+        {
+            GENERAL_NAME_free(name);
+        }
+    }
+};
+
+using general_name_ptr = std::unique_ptr<GENERAL_NAME, general_name_deleter>;
+
 } // namespace lux::crypto::detail
\ No newline at end of file
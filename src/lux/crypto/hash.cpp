@@ -0,0 +1,417 @@
+// HMAC_CTX is the HMAC API OpenSSL and BoringSSL have in common; OpenSSL 3 deprecates it in favor of EVP_MAC
+#define OPENSSL_SUPPRESS_DEPRECATED
+
+#include <lux/crypto/hash.hpp>
+
+#include <lux/crypto/detail/openssl_utils.hpp>
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+
+#include <openssl/crypto.h>
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/opensslv.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace lux::crypto {
+
+namespace {
+
+constexpr std::array<const char*, 5> digest_names{"SHA256", "SHA512", "BLAKE2S-256", "BLAKE2B-256", "BLAKE2B-512"};
+
+const char* digest_name(hash_algorithm algorithm)
+{
+    return digest_names[static_cast<std::size_t>(algorithm)];
+}
+
+#if !defined(OPENSSL_IS_BORINGSSL) && OPENSSL_VERSION_NUMBER >= 0x30000000L
+struct evp_md_deleter
+{
+    void operator()(EVP_MD* md) const
+    {
+        if (md)
+        {
+            EVP_MD_free(md);
+        }
+    }
+};
+
+/**
+ * Fetching an algorithm from the provider is relatively expensive, and the legacy EVP_sha256() style digests are
+ * fetched implicitly on every initialization. Algorithms are fetched once and kept for the lifetime of the process.
+ */
+const EVP_MD* get_md(hash_algorithm algorithm)
+{
+    static const auto mds = [] {
+        std::array<std::unique_ptr<EVP_MD, evp_md_deleter>, digest_names.size()> result;
+        for (std::size_t i = 0; i < digest_names.size(); ++i)
+        {
+            result[i].reset(EVP_MD_fetch(nullptr, digest_names[i], nullptr));
+        }
+
+        // Algorithms the provider doesn't implement are reported when they're used
+        ERR_clear_error();
+        return result;
+    }();
+    return mds[static_cast<std::size_t>(algorithm)].get();
+}
+#else
+const EVP_MD* get_md(hash_algorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case hash_algorithm::sha256:
+        return EVP_sha256();
+    case hash_algorithm::sha512:
+        return EVP_sha512();
+#ifdef OPENSSL_IS_BORINGSSL
+    case hash_algorithm::blake2b256:
+        return EVP_blake2b256();
+#else
+    case hash_algorithm::blake2s256:
+        return EVP_blake2s256();
+    case hash_algorithm::blake2b512:
+        return EVP_blake2b512();
+#endif
+    default:
+        return nullptr;
+    }
+}
+#endif
+
+lux::result<const EVP_MD*> find_md(hash_algorithm algorithm)
+{
+    const auto* md = get_md(algorithm);
+    if (!md)
+    {
+        return lux::err("{} digest is not supported by the crypto library", digest_name(algorithm));
+    }
+    return md;
+}
+
+struct md_ctx_traits
+{
+    static EVP_MD_CTX* create() noexcept
+    {
+        return EVP_MD_CTX_new();
+    }
+
+    static void reset(EVP_MD_CTX* ctx) noexcept
+    {
+        EVP_MD_CTX_reset(ctx);
+    }
+
+    static void destroy(EVP_MD_CTX* ctx) noexcept
+    {
+        EVP_MD_CTX_free(ctx);
+    }
+};
+
+struct hmac_ctx_traits
+{
+    static HMAC_CTX* create() noexcept
+    {
+        return HMAC_CTX_new();
+    }
+
+    static void reset(HMAC_CTX* ctx) noexcept
+    {
+        // Also wipes the key
+        HMAC_CTX_reset(ctx);
+    }
+
+    static void destroy(HMAC_CTX* ctx) noexcept
+    {
+        HMAC_CTX_free(ctx);
+    }
+};
+
+/**
+ * Per-thread pool of digest or HMAC contexts. A context returned on a thread other than the one it was taken on
+ * simply moves to the pool of that thread.
+ */
+template <typename Ctx, typename Traits>
+class ctx_pool
+{
+public:
+    ~ctx_pool()
+    {
+        for (auto* ctx : free_)
+        {
+            Traits::destroy(ctx);
+        }
+    }
+
+    Ctx* acquire()
+    {
+        if (free_.empty())
+        {
+            return Traits::create();
+        }
+
+        auto* ctx = free_.back();
+        free_.pop_back();
+        return ctx;
+    }
+
+    void release(Ctx* ctx) noexcept
+    {
+        Traits::reset(ctx);
+        if (free_.size() < max_pooled)
+        {
+            try
+            {
+                free_.push_back(ctx);
+                return;
+            }
+            catch (...)
+            {
+            }
+        }
+        Traits::destroy(ctx);
+    }
+
+private:
+    static constexpr std::size_t max_pooled = 16;
+
+    std::vector<Ctx*> free_;
+};
+
+ctx_pool<EVP_MD_CTX, md_ctx_traits>& thread_md_ctx_pool()
+{
+    thread_local ctx_pool<EVP_MD_CTX, md_ctx_traits> pool;
+    return pool;
+}
+
+ctx_pool<HMAC_CTX, hmac_ctx_traits>& thread_hmac_ctx_pool()
+{
+    thread_local ctx_pool<HMAC_CTX, hmac_ctx_traits> pool;
+    return pool;
+}
+
+using pooled_md_ctx_ptr = std::unique_ptr<EVP_MD_CTX, detail::pooled_md_ctx_deleter>;
+
+lux::status init_digest(EVP_MD_CTX* ctx, hash_algorithm algorithm)
+{
+    auto md = find_md(algorithm);
+    if (!md)
+    {
+        return lux::err(lux::move(md.error()));
+    }
+
+    if (EVP_DigestInit_ex(ctx, *md, nullptr) <= 0)
+    {
+        return lux::err("Failed to initialize {} digest (err={})", digest_name(algorithm), detail::get_openssl_error());
+    }
+    return lux::ok();
+}
+
+lux::result<pooled_md_ctx_ptr> acquire_initialized_ctx(hash_algorithm algorithm)
+{
+    pooled_md_ctx_ptr ctx{thread_md_ctx_pool().acquire()};
+    if (!ctx)
+    {
+        return lux::err("Failed to create EVP_MD_CTX (err={})", detail::get_openssl_error());
+    }
+
+    if (auto status = init_digest(ctx.get(), algorithm); !status)
+    {
+        return lux::err(lux::move(status.error()));
+    }
+
+    return ctx;
+}
+
+lux::result<digest> final_digest(EVP_MD_CTX* ctx)
+{
+    digest result{};
+    unsigned int len{0};
+    if (EVP_DigestFinal_ex(ctx, detail::as_uint8_ptr(result.data.data()), &len) <= 0)
+    {
+        return lux::err("Failed to finalize digest (err={})", detail::get_openssl_error());
+    }
+
+    result.size = len;
+    return result;
+}
+
+} // namespace
+
+namespace detail {
+
+void pooled_md_ctx_deleter::operator()(EVP_MD_CTX* ctx) const noexcept
+{
+    if (ctx)
+    {
+        thread_md_ctx_pool().release(ctx);
+    }
+}
+
+void pooled_hmac_ctx_deleter::operator()(HMAC_CTX* ctx) const noexcept
+{
+    if (ctx)
+    {
+        thread_hmac_ctx_pool().release(ctx);
+    }
+}
+
+} // namespace detail
+
+// lux::crypto::hasher implementation
+
+lux::status hasher::update(std::span<const std::byte> data)
+{
+    if (EVP_DigestUpdate(ctx_.get(), data.data(), data.size()) <= 0)
+    {
+        return lux::err("Failed to update digest (err={})", detail::get_openssl_error());
+    }
+    return lux::ok();
+}
+
+lux::result<digest> hasher::final()
+{
+    auto result = final_digest(ctx_.get());
+    if (!result)
+    {
+        return result;
+    }
+
+    if (auto status = init_digest(ctx_.get(), algorithm_); !status)
+    {
+        return lux::err(lux::move(status.error()));
+    }
+
+    return result;
+}
+
+// lux::crypto::hmac implementation
+
+lux::status hmac::update(std::span<const std::byte> data)
+{
+    if (HMAC_Update(ctx_.get(), detail::as_uint8_ptr(data.data()), data.size()) <= 0)
+    {
+        return lux::err("Failed to update HMAC (err={})", detail::get_openssl_error());
+    }
+    return lux::ok();
+}
+
+lux::result<digest> hmac::final()
+{
+    digest result{};
+    unsigned int len{0};
+    if (HMAC_Final(ctx_.get(), detail::as_uint8_ptr(result.data.data()), &len) <= 0)
+    {
+        return lux::err("Failed to finalize HMAC (err={})", detail::get_openssl_error());
+    }
+    result.size = len;
+
+    // Passing no key and no digest reinitializes the context with the key it already has
+    if (HMAC_Init_ex(ctx_.get(), nullptr, 0, nullptr, nullptr) <= 0)
+    {
+        return lux::err("Failed to reinitialize HMAC (err={})", detail::get_openssl_error());
+    }
+
+    return result;
+}
+
+// Free functions implementation
+
+lux::result<hasher> make_hasher(hash_algorithm algorithm)
+{
+    auto ctx = acquire_initialized_ctx(algorithm);
+    if (!ctx)
+    {
+        return lux::err(lux::move(ctx.error()));
+    }
+
+    return hasher{algorithm, lux::move(*ctx)};
+}
+
+lux::result<hmac> make_hmac(hash_algorithm algorithm, std::span<const std::byte> key)
+{
+    auto md = find_md(algorithm);
+    if (!md)
+    {
+        return lux::err(lux::move(md.error()));
+    }
+
+    hmac::ctx_ptr ctx{thread_hmac_ctx_pool().acquire()};
+    if (!ctx)
+    {
+        return lux::err("Failed to create HMAC_CTX (err={})", detail::get_openssl_error());
+    }
+
+    if (HMAC_Init_ex(ctx.get(), key.data(), key.size(), *md, nullptr) <= 0)
+    {
+        return lux::err("Failed to initialize HMAC with {} (err={})",
+                        digest_name(algorithm),
+                        detail::get_openssl_error());
+    }
+
+    return hmac{algorithm, lux::move(ctx)};
+}
+
+lux::result<digest> hash(hash_algorithm algorithm, std::span<const std::byte> data)
+{
+    auto ctx = acquire_initialized_ctx(algorithm);
+    if (!ctx)
+    {
+        return lux::err(lux::move(ctx.error()));
+    }
+
+    if (EVP_DigestUpdate(ctx->get(), data.data(), data.size()) <= 0)
+    {
+        return lux::err("Failed to update digest (err={})", detail::get_openssl_error());
+    }
+
+    return final_digest(ctx->get());
+}
+
+lux::status hash_many(hash_algorithm algorithm,
+                      std::span<const std::span<const std::byte>> messages,
+                      std::span<digest> digests)
+{
+    LUX_ASSERT(messages.size() == digests.size(), "Digests must have the same size as messages");
+
+    auto ctx = acquire_initialized_ctx(algorithm);
+    if (!ctx)
+    {
+        return lux::err(lux::move(ctx.error()));
+    }
+
+    for (std::size_t i = 0; i < messages.size(); ++i)
+    {
+        if (i > 0)
+        {
+            if (auto status = init_digest(ctx->get(), algorithm); !status)
+            {
+                return lux::err(lux::move(status.error()));
+            }
+        }
+
+        if (EVP_DigestUpdate(ctx->get(), messages[i].data(), messages[i].size()) <= 0)
+        {
+            return lux::err("Failed to update digest (err={})", detail::get_openssl_error());
+        }
+
+        auto result = final_digest(ctx->get());
+        if (!result)
+        {
+            return lux::err(lux::move(result.error()));
+        }
+        digests[i] = *result;
+    }
+
+    return lux::ok();
+}
+
+bool constant_time_equal(std::span<const std::byte> lhs, std::span<const std::byte> rhs) noexcept
+{
+    return lhs.size() == rhs.size() && CRYPTO_memcmp(lhs.data(), rhs.data(), lhs.size()) == 0;
+}
+
+} // namespace lux::crypto
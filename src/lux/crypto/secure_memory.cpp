@@ -0,0 +1,272 @@
+#include <lux/crypto/secure_memory.hpp>
+
+#include <lux/crypto/detail/openssl_utils.hpp>
+#include <lux/support/assert.hpp>
+
+#include <openssl/crypto.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <tuple>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace lux::crypto {
+
+namespace {
+
+constexpr std::size_t min_slot_size = 16;
+
+// Power-of-two slot sizes from min_slot_size up to secure_arena_max_slot_size
+constexpr std::size_t slot_class_count = std::bit_width(secure_arena_max_slot_size / min_slot_size);
+
+static_assert(std::has_single_bit(secure_arena_max_slot_size) && secure_arena_max_slot_size >= min_slot_size);
+
+std::size_t slot_class(std::size_t size) noexcept
+{
+    return std::bit_width((std::max(size, min_slot_size) - 1) / min_slot_size);
+}
+
+constexpr std::size_t slot_size(std::size_t slot_class) noexcept
+{
+    return min_slot_size << slot_class;
+}
+
+std::size_t page_size() noexcept
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+/**
+ * Maps zeroed memory locked in RAM and excluded from core dumps where supported. Locking may fail once the limit
+ * of locked memory is reached; the memory is still used then, as it's cleansed on release either way.
+ */
+void* map_locked(std::size_t size) noexcept
+{
+#ifdef _WIN32
+    void* ptr{VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)};
+    if (ptr)
+    {
+        VirtualLock(ptr, size);
+    }
+    return ptr;
+#else
+    void* ptr{mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+    if (ptr == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    mlock(ptr, size);
+#ifdef MADV_DONTDUMP
+    madvise(ptr, size, MADV_DONTDUMP);
+#endif
+    return ptr;
+#endif
+}
+
+struct free_slot
+{
+    free_slot* next;
+};
+
+class secure_arena
+{
+public:
+    lux::status init(const secure_memory_config& config)
+    {
+        std::lock_guard lock{mutex_};
+        if (initialized_)
+        {
+            return lux::err("Secure memory is already initialized");
+        }
+
+        return init_locked(config);
+    }
+
+    void ensure_initialized()
+    {
+        std::lock_guard lock{mutex_};
+        ensure_initialized_locked();
+    }
+
+    void* allocate(std::size_t size)
+    {
+        const auto cls = slot_class(size);
+
+        std::lock_guard lock{mutex_};
+        ensure_initialized_locked();
+
+        if (!free_[cls] && !refill(cls))
+        {
+            throw std::bad_alloc{};
+        }
+
+        free_slot* slot{free_[cls]};
+        free_[cls] = slot->next;
+        slot->next = nullptr; // Slots are handed out zeroed
+        ++allocated_slots_;
+        return slot;
+    }
+
+    void deallocate(void* ptr, std::size_t size) noexcept
+    {
+        const auto cls = slot_class(size);
+        OPENSSL_cleanse(ptr, slot_size(cls));
+
+        std::lock_guard lock{mutex_};
+        auto* slot = static_cast<free_slot*>(ptr);
+        slot->next = free_[cls];
+        free_[cls] = slot;
+        --allocated_slots_;
+    }
+
+    secure_arena_stats stats()
+    {
+        std::lock_guard lock{mutex_};
+        return {.reserved_bytes = reserved_bytes_, .allocated_slots = allocated_slots_};
+    }
+
+private:
+    void ensure_initialized_locked()
+    {
+        if (!initialized_)
+        {
+            // Without a secure heap OpenSSL falls back to the regular heap, the arena works either way
+            std::ignore = init_locked({});
+        }
+    }
+
+    lux::status init_locked(const secure_memory_config& config)
+    {
+        LUX_ASSERT(config.arena_chunk_size >= secure_arena_max_slot_size,
+                   "Secure arena chunk must be able to hold the largest slot");
+
+        // Rounded up to whole pages, which also keeps every slot aligned to its size
+        const auto page = page_size();
+        chunk_size_ = (config.arena_chunk_size + page - 1) / page * page;
+        initialized_ = true;
+
+#ifndef OPENSSL_IS_BORINGSSL
+        // BoringSSL has no secure heap, its secure allocations always come from the regular heap
+        if (config.heap_size != 0 && !CRYPTO_secure_malloc_initialized() &&
+            CRYPTO_secure_malloc_init(config.heap_size, config.heap_min_allocation) == 0)
+        {
+            return lux::err("Failed to initialize OpenSSL secure heap (size={}, min_allocation={}, err={})",
+                            config.heap_size,
+                            config.heap_min_allocation,
+                            detail::get_openssl_error());
+        }
+#endif
+
+        return lux::ok();
+    }
+
+    bool refill(std::size_t cls)
+    {
+        auto* chunk = static_cast<std::byte*>(map_locked(chunk_size_));
+        if (!chunk)
+        {
+            return false;
+        }
+
+        reserved_bytes_ += chunk_size_;
+
+        const auto size = slot_size(cls);
+        for (std::size_t offset = chunk_size_; offset >= size; offset -= size)
+        {
+            auto* slot = reinterpret_cast<free_slot*>(chunk + offset - size);
+            slot->next = free_[cls];
+            free_[cls] = slot;
+        }
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    bool initialized_{false};
+    std::size_t chunk_size_{0};
+    std::array<free_slot*, slot_class_count> free_{};
+    std::size_t reserved_bytes_{0};
+    std::size_t allocated_slots_{0};
+};
+
+secure_arena& get_arena()
+{
+    // Never destroyed, secure containers may still be released during static destruction
+    static auto* arena = new secure_arena{};
+    return *arena;
+}
+
+} // namespace
+
+lux::status init_secure_memory(const secure_memory_config& config)
+{
+    return get_arena().init(config);
+}
+
+void* secure_allocate(std::size_t size)
+{
+    if (size <= secure_arena_max_slot_size)
+    {
+        return get_arena().allocate(size);
+    }
+
+    get_arena().ensure_initialized();
+
+    // Once the secure heap is exhausted OpenSSL fails instead of falling back, the regular heap is used then;
+    // OPENSSL_secure_clear_free releases memory of either heap
+    void* ptr{OPENSSL_secure_malloc(size)};
+    if (!ptr)
+    {
+        ptr = OPENSSL_malloc(size);
+    }
+
+    if (!ptr)
+    {
+        throw std::bad_alloc{};
+    }
+
+    // BoringSSL has no OPENSSL_secure_zalloc
+    std::memset(ptr, 0, size);
+    return ptr;
+}
+
+void secure_deallocate(void* ptr, std::size_t size) noexcept
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    if (size <= secure_arena_max_slot_size)
+    {
+        get_arena().deallocate(ptr, size);
+    }
+    else
+    {
+        OPENSSL_secure_clear_free(ptr, size);
+    }
+}
+
+secure_arena_stats get_secure_arena_stats()
+{
+    return get_arena().stats();
+}
+
+} // namespace lux::crypto
@@ -0,0 +1,178 @@
+#include <lux/crypto/signature.hpp>
+
+#include <lux/crypto/detail/openssl_utils.hpp>
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+
+#include <openssl/err.h>
+#include <openssl/evp.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace lux::crypto {
+
+namespace {
+
+// Entries verified by a single task of a parallel batch, so the scheduling cost is spread over several of them
+constexpr std::size_t batch_chunk_size = 16;
+
+bool verify_range(std::span<const ed25519_verify_item> items, std::span<std::uint8_t> results)
+{
+    bool valid{true};
+    for (std::size_t i = 0; i < items.size(); ++i)
+    {
+        const auto& item = items[i];
+        const bool item_valid = item.key && item.key->verify(item.message, item.signature);
+        results[i] = item_valid ? 1 : 0;
+        valid = valid && item_valid;
+    }
+    return valid;
+}
+
+// Reusing a digest context per thread saves its allocation on every operation; it's reset first, as reinitializing
+// a used context may keep the key of the previous operation
+EVP_MD_CTX* thread_md_ctx()
+{
+    thread_local detail::evp_md_ctx_ptr ctx{EVP_MD_CTX_new()};
+    if (ctx)
+    {
+        EVP_MD_CTX_reset(ctx.get());
+    }
+    return ctx.get();
+}
+
+std::shared_ptr<EVP_PKEY> share_pkey(EVP_PKEY* pkey)
+{
+    return std::shared_ptr<EVP_PKEY>{pkey, detail::evp_pkey_deleter{}};
+}
+
+} // namespace
+
+lux::result<ed25519_signature> ed25519_signing_key::sign(std::span<const std::byte> message) const
+{
+    EVP_MD_CTX* ctx{thread_md_ctx()};
+    if (!ctx)
+    {
+        return lux::err("Failed to create EVP_MD_CTX (err={})", detail::get_openssl_error());
+    }
+
+    if (EVP_DigestSignInit(ctx, nullptr, nullptr, nullptr, pkey_.get()) <= 0)
+    {
+        return lux::err("Failed to initialize signing (err={})", detail::get_openssl_error());
+    }
+
+    ed25519_signature signature{};
+    std::size_t signature_len{ed25519_signature::size};
+
+    if (EVP_DigestSign(ctx,
+                       detail::as_uint8_ptr(signature.data.data()),
+                       &signature_len,
+                       detail::as_uint8_ptr(message.data()),
+                       message.size()) <= 0)
+    {
+        return lux::err("Failed to sign message (err={})", detail::get_openssl_error());
+    }
+
+    if (signature_len != ed25519_signature::size)
+    {
+        return lux::err("Invalid Ed25519 signature size (expected={}, actual={})",
+                        ed25519_signature::size,
+                        signature_len);
+    }
+
+    return signature;
+}
+
+bool ed25519_verifying_key::verify(std::span<const std::byte> message,
+                                   std::span<const std::byte> signature) const noexcept
+{
+    if (signature.size() != ed25519_signature::size)
+    {
+        return false;
+    }
+
+    EVP_MD_CTX* ctx{thread_md_ctx()};
+    const bool valid = ctx && EVP_DigestVerifyInit(ctx, nullptr, nullptr, nullptr, pkey_.get()) > 0 &&
+                       EVP_DigestVerify(ctx,
+                                        detail::as_uint8_ptr(signature.data()),
+                                        signature.size(),
+                                        detail::as_uint8_ptr(message.data()),
+                                        message.size()) == 1;
+    if (!valid)
+    {
+        // Invalid signatures are expected here, don't let them pile up in the error queue of the thread
+        ERR_clear_error();
+    }
+    return valid;
+}
+
+lux::result<ed25519_signing_key> make_signing_key(const ed25519_private_key& private_key)
+{
+    auto pkey = share_pkey(EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519,
+                                                        nullptr,
+                                                        detail::as_uint8_ptr(private_key.data.data()),
+                                                        private_key.data.size()));
+    if (!pkey)
+    {
+        return lux::err("Failed to create EVP_PKEY from private key (err={})", detail::get_openssl_error());
+    }
+
+    ed25519_public_key public_key{};
+    std::size_t key_len{ed25519_public_key::size};
+
+    if (EVP_PKEY_get_raw_public_key(pkey.get(), detail::as_uint8_ptr(public_key.data.data()), &key_len) <= 0)
+    {
+        return lux::err("Failed to derive Ed25519 public key (err={})", detail::get_openssl_error());
+    }
+
+    return ed25519_signing_key{lux::move(pkey), public_key};
+}
+
+lux::result<ed25519_verifying_key> make_verifying_key(const ed25519_public_key& public_key)
+{
+    auto pkey = share_pkey(EVP_PKEY_new_raw_public_key(EVP_PKEY_ED25519,
+                                                       nullptr,
+                                                       detail::as_uint8_ptr(public_key.data.data()),
+                                                       public_key.data.size()));
+    if (!pkey)
+    {
+        return lux::err("Failed to create EVP_PKEY from public key (err={})", detail::get_openssl_error());
+    }
+
+    return ed25519_verifying_key{lux::move(pkey)};
+}
+
+bool verify_batch(std::span<const ed25519_verify_item> items, std::span<std::uint8_t> results)
+{
+    LUX_ASSERT(items.size() == results.size(), "Results must have the same size as items");
+
+    return verify_range(items, results);
+}
+
+bool verify_batch(std::span<const ed25519_verify_item> items,
+                  std::span<std::uint8_t> results,
+                  const parallel_for& run_parallel)
+{
+    LUX_ASSERT(items.size() == results.size(), "Results must have the same size as items");
+
+    const auto chunk_count = (items.size() + batch_chunk_size - 1) / batch_chunk_size;
+    if (chunk_count <= 1 || !run_parallel)
+    {
+        return verify_range(items, results);
+    }
+
+    std::atomic<bool> all_valid{true};
+    run_parallel(chunk_count, [&](std::size_t chunk) {
+        const auto begin = chunk * batch_chunk_size;
+        const auto size = std::min(batch_chunk_size, items.size() - begin);
+        if (!verify_range(items.subspan(begin, size), results.subspan(begin, size)))
+        {
+            all_valid.store(false, std::memory_order_relaxed);
+        }
+    });
+
+    return all_valid.load(std::memory_order_relaxed);
+}
+
+} // namespace lux::crypto
@@ -0,0 +1,150 @@
+#include <lux/crypto/ssl_context.hpp>
+
+#include <lux/crypto/detail/openssl_utils.hpp>
+#include <lux/support/move.hpp>
+
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+namespace lux::crypto {
+
+namespace {
+
+detail::x509_ptr parse_cert(const cert_der& der)
+{
+    const unsigned char* der_ptr{detail::as_uint8_ptr(der.get().data())};
+    return detail::x509_ptr{d2i_X509(nullptr, &der_ptr, static_cast<long>(der.get().size()))};
+}
+
+lux::status set_options(lux::net::base::ssl_context& ctx, lux::net::base::ssl_context::options options)
+{
+    boost::system::error_code ec;
+    ctx.set_options(options, ec);
+    if (ec)
+    {
+        return lux::err("Failed to set SSL context options (err={})", ec.message());
+    }
+    return lux::ok();
+}
+
+constexpr lux::net::base::ssl_context::options tls12_and_later = lux::net::base::ssl_context::default_workarounds |
+                                                                 lux::net::base::ssl_context::no_sslv2 |
+                                                                 lux::net::base::ssl_context::no_sslv3 |
+                                                                 lux::net::base::ssl_context::no_tlsv1 |
+                                                                 lux::net::base::ssl_context::no_tlsv1_1;
+
+} // namespace
+
+lux::status use_certificate(lux::net::base::ssl_context& ctx,
+                            const lux::crypto::ed25519_private_key& private_key,
+                            const cert_der& cert,
+                            std::span<const cert_der> chain)
+{
+    const auto x509 = parse_cert(cert);
+    if (!x509)
+    {
+        return lux::err("Failed to decode DER certificate (err={})", detail::get_openssl_error());
+    }
+
+    detail::evp_pkey_ptr pkey{EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519,
+                                                           nullptr,
+                                                           detail::as_uint8_ptr(private_key.data.data()),
+                                                           private_key.data.size())};
+    if (!pkey)
+    {
+        return lux::err("Failed to create EVP_PKEY from private key (err={})", detail::get_openssl_error());
+    }
+
+    // The context takes its own references, the objects here can be released right away
+    SSL_CTX* ssl_ctx{ctx.native_handle()};
+    if (SSL_CTX_use_certificate(ssl_ctx, x509.get()) != 1)
+    {
+        return lux::err("Failed to use certificate (err={})", detail::get_openssl_error());
+    }
+
+    if (SSL_CTX_use_PrivateKey(ssl_ctx, pkey.get()) != 1)
+    {
+        return lux::err("Failed to use private key (err={})", detail::get_openssl_error());
+    }
+
+    if (SSL_CTX_check_private_key(ssl_ctx) != 1)
+    {
+        return lux::err("Private key does not match the certificate (err={})", detail::get_openssl_error());
+    }
+
+    for (const auto& chain_cert : chain)
+    {
+        const auto chain_x509 = parse_cert(chain_cert);
+        if (!chain_x509)
+        {
+            return lux::err("Failed to decode DER chain certificate (err={})", detail::get_openssl_error());
+        }
+
+        if (SSL_CTX_add1_chain_cert(ssl_ctx, chain_x509.get()) != 1)
+        {
+            return lux::err("Failed to add chain certificate (err={})", detail::get_openssl_error());
+        }
+    }
+
+    return lux::ok();
+}
+
+lux::status add_trusted_certificate(lux::net::base::ssl_context& ctx, const cert_der& cert)
+{
+    const auto x509 = parse_cert(cert);
+    if (!x509)
+    {
+        return lux::err("Failed to decode DER certificate (err={})", detail::get_openssl_error());
+    }
+
+    X509_STORE* store{SSL_CTX_get_cert_store(ctx.native_handle())};
+    if (!store || X509_STORE_add_cert(store, x509.get()) != 1)
+    {
+        return lux::err("Failed to add trusted certificate (err={})", detail::get_openssl_error());
+    }
+
+    return lux::ok();
+}
+
+lux::result<lux::net::base::ssl_context> make_server_ssl_context(const lux::crypto::ed25519_private_key& private_key,
+                                                                 const cert_der& cert,
+                                                                 std::span<const cert_der> chain)
+{
+    lux::net::base::ssl_context ctx{lux::net::base::ssl_context::tls_server};
+    if (auto res = set_options(ctx, tls12_and_later); !res)
+    {
+        return lux::err(lux::move(res.error()));
+    }
+
+    if (auto res = use_certificate(ctx, private_key, cert, chain); !res)
+    {
+        return lux::err(lux::move(res.error()));
+    }
+
+    return ctx;
+}
+
+lux::result<lux::net::base::ssl_context> make_client_ssl_context(const cert_der& trusted_cert)
+{
+    lux::net::base::ssl_context ctx{lux::net::base::ssl_context::tls_client};
+    if (auto res = set_options(ctx, tls12_and_later); !res)
+    {
+        return lux::err(lux::move(res.error()));
+    }
+
+    if (auto res = add_trusted_certificate(ctx, trusted_cert); !res)
+    {
+        return lux::err(lux::move(res.error()));
+    }
+
+    boost::system::error_code ec;
+    ctx.set_verify_mode(boost::asio::ssl::verify_peer, ec);
+    if (ec)
+    {
+        return lux::err("Failed to set SSL verify mode (err={})", ec.message());
+    }
+
+    return ctx;
+}
+
+} // namespace lux::crypto
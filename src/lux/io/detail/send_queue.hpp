@@ -0,0 +1,194 @@
+#pragma once
+
+#include <lux/io/net/base/file_region.hpp>
+
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+#include <lux/support/overload.hpp>
+#include <lux/utils/memory_arena.hpp>
+
+#include <boost/asio/buffer.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <optional>
+#include <span>
+#include <variant>
+#include <vector>
+
+namespace lux::detail {
+
+/**
+ * Queue of data waiting to be written to a stream, e.g. a socket or the standard input of a process, one write
+ * operation at a time.
+ * Plain buffers are copied into chunks of a memory arena, vectors and buffer chains are queued as they are, a chain is
+ * written with a single scatter/gather operation. File regions are written from memory if the file is loaded into
+ * memory; other file regions are sent by the socket itself, see start_next_file.
+ */
+class send_queue
+{
+public:
+    send_queue(std::size_t initial_chunk_count, std::size_t initial_chunk_size)
+        : memory_arena_{lux::make_growable_memory_arena(initial_chunk_count, initial_chunk_size)}
+    {
+    }
+
+public:
+    /**
+     * Checks if there is neither a write in progress nor data waiting to be written.
+     */
+    bool empty() const
+    {
+        return !in_flight_ && pending_.empty();
+    }
+
+    bool is_sending() const
+    {
+        return in_flight_.has_value();
+    }
+
+    bool has_pending() const
+    {
+        return !pending_.empty();
+    }
+
+    void push(std::span<const std::byte> data)
+    {
+        auto buffer = memory_arena_->get(data.size());
+        std::memcpy(buffer->data(), data.data(), data.size());
+        pending_.emplace_back(lux::move(buffer));
+    }
+
+    void push(std::vector<std::byte>&& data)
+    {
+        pending_.emplace_back(lux::move(data));
+    }
+
+    void push(lux::buffer_chain&& chain)
+    {
+        pending_.emplace_back(lux::move(chain));
+    }
+
+    void push(lux::net::base::file_region&& region)
+    {
+        pending_.emplace_back(lux::move(region));
+    }
+
+    /**
+     * Checks if the next queued entry is a file region to be sent from the file instead of from memory.
+     */
+    bool next_is_file_on_disk() const
+    {
+        LUX_ASSERT(!pending_.empty(), "No data to send");
+
+        const auto* region = std::get_if<lux::net::base::file_region>(&pending_.front());
+        return region && region->source->loaded().empty();
+    }
+
+    /**
+     * Drops the queued data, including the data of the write in progress.
+     */
+    void clear()
+    {
+        pending_.clear();
+        in_flight_.reset();
+    }
+
+    /**
+     * Moves the next queued entry in flight.
+     * @return Buffer sequence to write; valid until the write is completed or the queue is cleared.
+     */
+    std::span<const boost::asio::const_buffer> start_next()
+    {
+        LUX_ASSERT(!in_flight_, "Write is already in progress");
+        LUX_ASSERT(!pending_.empty(), "No data to send");
+        LUX_ASSERT(!next_is_file_on_disk(), "File regions not loaded into memory are started with start_next_file");
+
+        in_flight_.emplace(lux::move(pending_.front()));
+        pending_.pop_front();
+
+        // The vector keeps its capacity, so only the first write of a larger chain allocates
+        buffers_.clear();
+        for_each_chunk(*in_flight_,
+                       [this](std::span<const std::byte> chunk) { buffers_.emplace_back(chunk.data(), chunk.size()); });
+        return buffers_;
+    }
+
+    /**
+     * Moves the next queued entry, a file region not loaded into memory, in flight.
+     * The socket sends it on its own and calls complete once it's sent.
+     * @return The region to send.
+     */
+    lux::net::base::file_region start_next_file()
+    {
+        LUX_ASSERT(!in_flight_, "Write is already in progress");
+        LUX_ASSERT(next_is_file_on_disk(), "Next entry is not a file region to be sent from the file");
+
+        in_flight_.emplace(lux::move(pending_.front()));
+        pending_.pop_front();
+        return std::get<lux::net::base::file_region>(*in_flight_);
+    }
+
+    /**
+     * Finishes the write in progress and invokes the callback with each contiguous chunk of the written data.
+     * The callback may push, start or clear the queue.
+     */
+    template <typename Callback>
+    void complete(Callback&& callback)
+    {
+        if (!in_flight_)
+        {
+            return; // Cleared in the meantime
+        }
+
+        const auto sent = lux::move(*in_flight_);
+        in_flight_.reset();
+        for_each_chunk(sent, callback);
+    }
+
+private:
+    using arena_element = lux::growable_memory_arena_ptr<>::element_type::element_type;
+    using entry = std::variant<arena_element, std::vector<std::byte>, lux::buffer_chain, lux::net::base::file_region>;
+
+    template <typename Callback>
+    static void for_each_chunk(const entry& e, Callback&& callback)
+    {
+        std::visit(lux::overload{[&](const arena_element& buffer) { callback(std::span<const std::byte>{*buffer}); },
+                                 [&](const std::vector<std::byte>& data) {
+                                     callback(std::span<const std::byte>{data});
+                                 },
+                                 [&](const lux::buffer_chain& chain) {
+                                     for (const auto& chunk : chain)
+                                     {
+                                         if (!chunk->empty())
+                                         {
+                                             callback(std::span<const std::byte>{*chunk});
+                                         }
+                                     }
+                                 },
+                                 [&](const lux::net::base::file_region& region) {
+                                     // Called even for a file that isn't loaded, the write is completed either way
+                                     callback(loaded_data(region));
+                                 }},
+                   e);
+    }
+
+    static std::span<const std::byte> loaded_data(const lux::net::base::file_region& region)
+    {
+        const auto loaded = region.source->loaded();
+        if (loaded.empty())
+        {
+            return {};
+        }
+        return loaded.subspan(static_cast<std::size_t>(region.offset), static_cast<std::size_t>(region.size));
+    }
+
+private:
+    lux::growable_memory_arena_ptr<> memory_arena_;
+    std::deque<entry> pending_;
+    std::optional<entry> in_flight_;
+    std::vector<boost::asio::const_buffer> buffers_;
+};
+
+} // namespace lux::detail
@@ -0,0 +1,256 @@
+#include <lux/io/net/async_tcp_socket.hpp>
+#include <lux/io/net/base/socket_factory.hpp>
+
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+
+#include <boost/asio/append.hpp>
+#include <boost/asio/post.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+namespace lux::net {
+
+namespace {
+
+template <typename Handler, typename... Args>
+void post_completion(const boost::asio::any_io_executor& exe, Handler handler, Args... args)
+{
+    // Never complete inline - the caller might still be inside the initiating function
+    boost::asio::post(exe, boost::asio::append(lux::move(handler), lux::move(args)...));
+}
+
+} // namespace
+
+async_tcp_socket::async_tcp_socket(boost::asio::any_io_executor exe,
+                                   lux::net::base::socket_factory& socket_factory,
+                                   const lux::net::base::tcp_socket_config& config)
+    : exe_{lux::move(exe)},
+      socket_{socket_factory.create_tcp_socket(config, *this)},
+      max_unread_size_{config.buffer.max_unread_size}
+{
+}
+
+async_tcp_socket::async_tcp_socket(boost::asio::any_io_executor exe,
+                                   lux::net::base::socket_factory& socket_factory,
+                                   const lux::net::base::tcp_socket_config& config,
+                                   lux::net::base::ssl_context& ssl_context)
+    : exe_{lux::move(exe)},
+      socket_{socket_factory.create_ssl_tcp_socket(config, ssl_context, *this)},
+      max_unread_size_{config.buffer.max_unread_size}
+{
+}
+
+async_tcp_socket::~async_tcp_socket()
+{
+    // The socket detaches its handler on destruction, so no callbacks reach this object afterwards
+    socket_.reset();
+    fail_pending_operations(std::make_error_code(std::errc::operation_canceled), true);
+}
+
+std::error_code async_tcp_socket::disconnect(bool send_pending)
+{
+    return socket_->disconnect(send_pending);
+}
+
+bool async_tcp_socket::is_connected() const
+{
+    return socket_->is_connected();
+}
+
+void async_tcp_socket::start_connect(const lux::net::base::endpoint& endpoint, connect_handler handler)
+{
+    if (connect_handler_)
+    {
+        post_completion(exe_, lux::move(handler), std::make_error_code(std::errc::operation_in_progress));
+        return;
+    }
+
+    on_connect_started(socket_->connect(endpoint), lux::move(handler));
+}
+
+void async_tcp_socket::start_connect(const lux::net::base::hostname_endpoint& endpoint, connect_handler handler)
+{
+    if (connect_handler_)
+    {
+        post_completion(exe_, lux::move(handler), std::make_error_code(std::errc::operation_in_progress));
+        return;
+    }
+
+    on_connect_started(socket_->connect(endpoint), lux::move(handler));
+}
+
+void async_tcp_socket::on_connect_started(const std::error_code& ec, connect_handler handler)
+{
+    if (ec)
+    {
+        post_completion(exe_, lux::move(handler), ec);
+        return;
+    }
+
+    // A fresh connection starts with an empty receive buffer
+    received_data_.clear();
+    received_offset_ = 0;
+    read_error_.clear();
+    connect_handler_ = lux::move(handler);
+}
+
+void async_tcp_socket::start_read(std::span<std::byte> buffer, read_handler handler)
+{
+    if (read_handler_)
+    {
+        post_completion(exe_, lux::move(handler), std::make_error_code(std::errc::operation_in_progress), 0uz);
+        return;
+    }
+
+    if (buffer.empty())
+    {
+        post_completion(exe_, lux::move(handler), std::error_code{}, 0uz);
+        return;
+    }
+
+    if (received_offset_ < received_data_.size())
+    {
+        const auto size = consume_received_data(buffer);
+        post_completion(exe_, lux::move(handler), std::error_code{}, size);
+        return;
+    }
+
+    if (read_error_)
+    {
+        post_completion(exe_, lux::move(handler), read_error_, 0uz);
+        return;
+    }
+
+    if (!socket_->is_connected())
+    {
+        post_completion(exe_, lux::move(handler), std::make_error_code(std::errc::not_connected), 0uz);
+        return;
+    }
+
+    read_buffer_ = buffer;
+    read_handler_ = lux::move(handler);
+}
+
+void async_tcp_socket::start_send(std::span<const std::byte> data, send_handler handler)
+{
+    if (const auto ec = socket_->send(data); ec)
+    {
+        post_completion(exe_, lux::move(handler), ec);
+        return;
+    }
+
+    // The socket reports sent data in the order of send() calls
+    send_handlers_.push_back(lux::move(handler));
+}
+
+std::size_t async_tcp_socket::consume_received_data(std::span<std::byte> buffer)
+{
+    const auto size = std::min(buffer.size(), received_data_.size() - received_offset_);
+    std::memcpy(buffer.data(), received_data_.data() + received_offset_, size);
+    received_offset_ += size;
+
+    if (received_offset_ == received_data_.size())
+    {
+        received_data_.clear();
+        received_offset_ = 0;
+    }
+
+    return size;
+}
+
+void async_tcp_socket::fail_pending_operations(const std::error_code& ec, bool include_connect)
+{
+    if (include_connect && connect_handler_)
+    {
+        post_completion(exe_, lux::move(connect_handler_), ec);
+    }
+
+    if (read_handler_)
+    {
+        read_buffer_ = {};
+        post_completion(exe_, lux::move(read_handler_), ec, 0uz);
+    }
+
+    while (!send_handlers_.empty())
+    {
+        post_completion(exe_, lux::move(send_handlers_.front()), ec);
+        send_handlers_.pop_front();
+    }
+}
+
+void async_tcp_socket::on_connected(lux::net::base::tcp_socket& socket)
+{
+    std::ignore = socket;
+
+    if (connect_handler_)
+    {
+        post_completion(exe_, lux::move(connect_handler_), std::error_code{});
+    }
+}
+
+void async_tcp_socket::on_disconnected(lux::net::base::tcp_socket& socket,
+                                       const std::error_code& ec,
+                                       bool will_reconnect)
+{
+    std::ignore = socket;
+
+    // A local disconnect is reported without an error, but the pending operations did not succeed
+    const auto error = ec ? ec : std::make_error_code(std::errc::not_connected);
+
+    // A pending connect keeps waiting while the socket is reconnecting
+    fail_pending_operations(error, !will_reconnect);
+}
+
+void async_tcp_socket::on_data_read(lux::net::base::tcp_socket& socket, const std::span<const std::byte>& data)
+{
+    std::ignore = socket;
+
+    auto unread = data;
+    if (read_handler_)
+    {
+        LUX_ASSERT(received_offset_ == received_data_.size(), "Reads are started only once the buffer is consumed");
+
+        // Only what doesn't fit the pending read is buffered
+        const auto size = std::min(read_buffer_.size(), unread.size());
+        std::memcpy(read_buffer_.data(), unread.data(), size);
+        unread = unread.subspan(size);
+
+        read_buffer_ = {};
+        post_completion(exe_, lux::move(read_handler_), std::error_code{}, size);
+    }
+
+    if (unread.empty())
+    {
+        return;
+    }
+
+    if (max_unread_size_ > 0 && received_data_.size() - received_offset_ + unread.size() > max_unread_size_)
+    {
+        // The peer sends faster than it's read; the socket keeps reading, so the buffer would grow without bound
+        read_error_ = std::make_error_code(std::errc::no_buffer_space);
+        socket_->disconnect(false);
+        return;
+    }
+
+    // The data that has been read already is dropped, so the buffer doesn't grow while it's read in parts
+    received_data_.erase(received_data_.begin(), received_data_.begin() + received_offset_);
+    received_offset_ = 0;
+    received_data_.insert(received_data_.end(), unread.begin(), unread.end());
+}
+
+void async_tcp_socket::on_data_sent(lux::net::base::tcp_socket& socket, const std::span<const std::byte>& data)
+{
+    std::ignore = socket;
+    std::ignore = data;
+
+    if (!send_handlers_.empty())
+    {
+        post_completion(exe_, lux::move(send_handlers_.front()), std::error_code{});
+        send_handlers_.pop_front();
+    }
+}
+
+} // namespace lux::net
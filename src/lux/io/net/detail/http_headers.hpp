@@ -0,0 +1,62 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+namespace lux::net::detail {
+
+inline char to_lower(char c) noexcept
+{
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+inline bool iequals(std::string_view lhs, std::string_view rhs) noexcept
+{
+    return std::ranges::equal(lhs, rhs, [](char l, char r) { return to_lower(l) == to_lower(r); });
+}
+
+inline bool icontains(std::string_view value, std::string_view token) noexcept
+{
+    return !std::ranges::search(value, token, [](char l, char r) { return to_lower(l) == to_lower(r); }).empty();
+}
+
+inline std::string_view trim(std::string_view value) noexcept
+{
+    const auto first = value.find_first_not_of(" \t");
+    if (first == std::string_view::npos)
+    {
+        return {};
+    }
+    return value.substr(first, value.find_last_not_of(" \t") - first + 1);
+}
+
+/**
+ * Finds the key of a header regardless of its case; the header maps keep the names as they were received or set.
+ * @return The key as stored in the message, or nullptr if the message has no such header.
+ */
+template <typename Message>
+const std::string* find_header_key(const Message& message, std::string_view name)
+{
+    for (const auto& [key, value] : message.headers())
+    {
+        if (iequals(key, name))
+        {
+            return &key;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Gets the value of a header regardless of the case of its name.
+ * @return The header value, or an empty string if the message has no such header.
+ */
+template <typename Message>
+std::string_view find_header(const Message& message, std::string_view name)
+{
+    const auto* key = find_header_key(message, name);
+    return key ? message.header(*key) : std::string_view{};
+}
+
+} // namespace lux::net::detail
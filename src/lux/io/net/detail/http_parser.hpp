@@ -78,6 +78,12 @@ public:
         }
     }
 
+    // True when the header of the message currently being parsed has been received completely
+    bool is_header_done() const
+    {
+        return parser_ && parser_->is_header_done();
+    }
+
 private:
     http_parser_handler<boost_message_type>& handler_;
 
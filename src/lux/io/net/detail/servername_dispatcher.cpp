@@ -0,0 +1,50 @@
+#include <lux/io/net/detail/servername_dispatcher.hpp>
+
+#include <lux/support/move.hpp>
+
+#include <openssl/ssl.h>
+
+namespace lux::net::detail {
+
+namespace {
+
+// Called during every handshake, also when the client sends no server name
+int on_server_name(SSL* ssl, int* alert, void* arg)
+{
+    const char* server_name{SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name)};
+
+    const auto& lookup = *static_cast<const servername_dispatcher::lookup_function*>(arg);
+    const auto ctx = lookup(server_name ? server_name : "");
+    if (!ctx)
+    {
+        *alert = SSL_AD_UNRECOGNIZED_NAME;
+        return SSL_TLSEXT_ERR_ALERT_FATAL;
+    }
+
+    // The connection takes its own reference to the context
+    if (!SSL_set_SSL_CTX(ssl, ctx->native_handle()))
+    {
+        *alert = SSL_AD_INTERNAL_ERROR;
+        return SSL_TLSEXT_ERR_ALERT_FATAL;
+    }
+
+    return SSL_TLSEXT_ERR_OK;
+}
+
+} // namespace
+
+servername_dispatcher::servername_dispatcher(lux::net::base::ssl_context& context, lookup_function lookup)
+    : context_{context}, lookup_{lux::move(lookup)}
+{
+    SSL_CTX_set_tlsext_servername_callback(context_.native_handle(), &on_server_name);
+    SSL_CTX_set_tlsext_servername_arg(context_.native_handle(), &lookup_);
+}
+
+servername_dispatcher::~servername_dispatcher()
+{
+    // Connections may outlive this object, make sure they never call back into it
+    SSL_CTX_set_tlsext_servername_callback(context_.native_handle(), nullptr);
+    SSL_CTX_set_tlsext_servername_arg(context_.native_handle(), nullptr);
+}
+
+} // namespace lux::net::detail
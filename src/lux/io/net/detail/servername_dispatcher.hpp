@@ -0,0 +1,39 @@
+#pragma once
+
+#include <lux/io/net/base/ssl.hpp>
+
+#include <functional>
+#include <memory>
+#include <string_view>
+
+namespace lux::net::detail {
+
+/**
+ * Switches every handshake of a server SSL context to the context a lookup picks by the server name (SNI).
+ *
+ * Protocol versions, options and peer verification are those of the dispatching context; the picked contexts provide
+ * the certificate, its chain and the private key. Each connection takes its own reference to the context it was
+ * switched to, so that context may be released while the connection is still open.
+ */
+class servername_dispatcher
+{
+public:
+    /**
+     * Picks the context for the server name sent by the client, empty if none was sent.
+     * Returning nullptr fails the handshake with an unrecognized_name alert.
+     */
+    using lookup_function = std::function<std::shared_ptr<lux::net::base::ssl_context>(std::string_view)>;
+
+public:
+    servername_dispatcher(lux::net::base::ssl_context& context, lookup_function lookup);
+    ~servername_dispatcher();
+
+    servername_dispatcher(const servername_dispatcher&) = delete;
+    servername_dispatcher& operator=(const servername_dispatcher&) = delete;
+
+private:
+    lux::net::base::ssl_context& context_;
+    lookup_function lookup_;
+};
+
+} // namespace lux::net::detail
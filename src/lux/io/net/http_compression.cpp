@@ -0,0 +1,339 @@
+#include <lux/io/net/http_compression.hpp>
+#include <lux/io/net/base/http_status.hpp>
+#include <lux/io/net/detail/http_headers.hpp>
+
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+
+#include <boost/beast/zlib/deflate_stream.hpp>
+#include <boost/crc.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace lux::net {
+
+namespace {
+
+using detail::find_header;
+using detail::find_header_key;
+using detail::icontains;
+using detail::iequals;
+using detail::trim;
+
+// Output of the compressor grows by this much at a time instead of being sized for the worst case upfront
+constexpr std::size_t compress_step = 64 * 1024;
+
+constexpr int window_bits = 15;
+constexpr int mem_level = 8;
+
+// Fixed gzip member header: deflate, no flags, no modification time, unknown OS (RFC 1952)
+constexpr std::array<unsigned char, 10> gzip_header{0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff};
+
+// zlib header: deflate with a 32 KiB window and the default compression level (RFC 1950)
+constexpr std::array<unsigned char, 2> zlib_header{0x78, 0x9c};
+
+// Quality value in thousandths (RFC 9110, section 12.4.2)
+std::optional<int> parse_qvalue(std::string_view value) noexcept
+{
+    if (value.empty() || value.size() > 5 || (value[0] != '0' && value[0] != '1'))
+    {
+        return std::nullopt;
+    }
+
+    int result{(value[0] - '0') * 1000};
+    if (value.size() > 1)
+    {
+        if (value[1] != '.')
+        {
+            return std::nullopt;
+        }
+
+        int scale{100};
+        for (const char c : value.substr(2))
+        {
+            if (c < '0' || c > '9')
+            {
+                return std::nullopt;
+            }
+            result += (c - '0') * scale;
+            scale /= 10;
+        }
+    }
+
+    return result <= 1000 ? std::optional{result} : std::nullopt;
+}
+
+std::uint32_t adler32(std::string_view data) noexcept
+{
+    constexpr std::uint32_t modulus = 65521;
+
+    // Longest run after which the sums still fit 32 bits before being reduced
+    constexpr std::size_t max_run = 5552;
+
+    std::uint32_t a{1};
+    std::uint32_t b{0};
+    while (!data.empty())
+    {
+        const auto run = data.substr(0, max_run);
+        for (const char c : run)
+        {
+            a += static_cast<unsigned char>(c);
+            b += a;
+        }
+        a %= modulus;
+        b %= modulus;
+        data.remove_prefix(run.size());
+    }
+    return (b << 16) | a;
+}
+
+void append_le32(std::string& out, std::uint32_t value)
+{
+    for (int shift = 0; shift < 32; shift += 8)
+    {
+        out.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+void append_be32(std::string& out, std::uint32_t value)
+{
+    for (int shift = 24; shift >= 0; shift -= 8)
+    {
+        out.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+template <std::size_t N>
+void append_bytes(std::string& out, const std::array<unsigned char, N>& bytes)
+{
+    for (const auto byte : bytes)
+    {
+        out.push_back(static_cast<char>(byte));
+    }
+}
+
+/**
+ * The compression context keeps its window and hash tables (~256 KiB) allocated between resets, so every thread
+ * allocates them only once.
+ */
+boost::beast::zlib::deflate_stream& thread_deflate_stream()
+{
+    thread_local boost::beast::zlib::deflate_stream stream;
+    return stream;
+}
+
+bool deflate_raw(std::string_view data, int level, std::string& out)
+{
+    auto& stream = thread_deflate_stream();
+    stream.reset(level, window_bits, mem_level, boost::beast::zlib::Strategy::normal);
+
+    boost::beast::zlib::z_params params;
+    params.next_in = data.data();
+    params.avail_in = data.size();
+
+    for (;;)
+    {
+        const auto offset = out.size();
+        out.resize(offset + compress_step);
+        params.next_out = out.data() + offset;
+        params.avail_out = compress_step;
+
+        boost::beast::error_code ec;
+        stream.write(params, boost::beast::zlib::Flush::finish, ec);
+        out.resize(out.size() - params.avail_out);
+
+        if (ec == boost::beast::zlib::error::end_of_stream)
+        {
+            return true;
+        }
+
+        // Without an error the output space ran out, anything else is a failure
+        if (ec && (ec != boost::beast::zlib::error::need_buffers || params.avail_out != 0))
+        {
+            return false;
+        }
+    }
+}
+
+bool is_compressible_type(std::string_view content_type, const std::vector<std::string>& content_types)
+{
+    const auto media_type = trim(content_type.substr(0, content_type.find(';')));
+    if (media_type.empty())
+    {
+        return false;
+    }
+
+    return std::ranges::any_of(content_types, [media_type](std::string_view rule) {
+        return rule.ends_with('/') ? media_type.size() > rule.size() && iequals(media_type.substr(0, rule.size()), rule)
+                                   : iequals(media_type, rule);
+    });
+}
+
+void add_vary_accept_encoding(lux::net::base::http_response& response)
+{
+    const auto* key = find_header_key(response, "Vary");
+    if (!key)
+    {
+        response.set_header("Vary", "Accept-Encoding");
+        return;
+    }
+
+    const auto value = response.header(*key);
+    if (trim(value) != "*" && !icontains(value, "accept-encoding"))
+    {
+        response.set_header(*key, std::string{value} + ", Accept-Encoding");
+    }
+}
+
+// A strong ETag promises byte-identical content, which the compressed body isn't (RFC 9110, section 8.8.3)
+void weaken_etag(lux::net::base::http_response& response)
+{
+    const auto* key = find_header_key(response, "ETag");
+    if (!key)
+    {
+        return;
+    }
+
+    const auto value = trim(response.header(*key));
+    if (value.starts_with('"'))
+    {
+        response.set_header(*key, "W/" + std::string{value});
+    }
+}
+
+} // namespace
+
+http_content_coding negotiate_content_coding(std::string_view accept_encoding)
+{
+    // -1 marks a coding the client didn't mention
+    int gzip_q{-1};
+    int deflate_q{-1};
+    int wildcard_q{-1};
+
+    while (!accept_encoding.empty())
+    {
+        const auto comma = accept_encoding.find(',');
+        const auto item = accept_encoding.substr(0, comma);
+        accept_encoding.remove_prefix(comma == std::string_view::npos ? accept_encoding.size() : comma + 1);
+
+        const auto semicolon = item.find(';');
+        const auto coding = trim(item.substr(0, semicolon));
+
+        std::optional<int> q{1000};
+        if (semicolon != std::string_view::npos)
+        {
+            const auto param = trim(item.substr(semicolon + 1));
+            q = param.size() > 2 && iequals(param.substr(0, 2), "q=") ? parse_qvalue(param.substr(2)) : std::nullopt;
+        }
+
+        if (coding.empty() || !q)
+        {
+            continue; // Malformed entries are ignored
+        }
+
+        if (iequals(coding, "gzip") || iequals(coding, "x-gzip"))
+        {
+            gzip_q = *q;
+        }
+        else if (iequals(coding, "deflate"))
+        {
+            deflate_q = *q;
+        }
+        else if (coding == "*")
+        {
+            wildcard_q = *q;
+        }
+    }
+
+    gzip_q = gzip_q < 0 ? wildcard_q : gzip_q;
+    deflate_q = deflate_q < 0 ? wildcard_q : deflate_q;
+
+    if (gzip_q <= 0 && deflate_q <= 0)
+    {
+        return http_content_coding::identity;
+    }
+
+    return gzip_q >= deflate_q ? http_content_coding::gzip : http_content_coding::deflate;
+}
+
+std::optional<std::string> compress(http_content_coding coding, std::string_view data, int level)
+{
+    LUX_ASSERT(level >= 1 && level <= 9, "Compression level must be between 1 and 9");
+
+    std::string out;
+    switch (coding)
+    {
+    case http_content_coding::identity:
+        return std::string{data};
+
+    case http_content_coding::gzip:
+    {
+        append_bytes(out, gzip_header);
+        if (!deflate_raw(data, level, out))
+        {
+            return std::nullopt;
+        }
+
+        boost::crc_32_type crc;
+        crc.process_bytes(data.data(), data.size());
+        append_le32(out, crc.checksum());
+        append_le32(out, static_cast<std::uint32_t>(data.size())); // Size modulo 2^32
+        return out;
+    }
+
+    case http_content_coding::deflate:
+    {
+        append_bytes(out, zlib_header);
+        if (!deflate_raw(data, level, out))
+        {
+            return std::nullopt;
+        }
+
+        append_be32(out, adler32(data));
+        return out;
+    }
+    }
+
+    return std::nullopt;
+}
+
+bool compress_response(const lux::net::base::http_request& request,
+                       lux::net::base::http_response& response,
+                       const http_compression_config& config)
+{
+    // Ranges refer to the uncompressed representation; file bodies are sent as they are stored
+    if (response.body().size() < config.min_size || response.status() == lux::net::base::http_status::partial_content ||
+        response.file_body() || find_header_key(response, "Content-Encoding"))
+    {
+        return false;
+    }
+
+    if (!is_compressible_type(find_header(response, "Content-Type"), config.content_types))
+    {
+        return false;
+    }
+
+    // The response depends on Accept-Encoding from here on, also when it's sent uncompressed
+    add_vary_accept_encoding(response);
+
+    const auto coding = negotiate_content_coding(find_header(request, "Accept-Encoding"));
+    if (coding == http_content_coding::identity)
+    {
+        return false;
+    }
+
+    auto compressed = compress(coding, response.body(), config.level);
+    if (!compressed || compressed->size() >= response.body().size())
+    {
+        return false;
+    }
+
+    response.set_body(lux::move(*compressed));
+    response.set_header("Content-Encoding", coding == http_content_coding::gzip ? "gzip" : "deflate");
+    weaken_etag(response);
+    return true;
+}
+
+} // namespace lux::net
@@ -6,6 +6,8 @@
 
 #include <boost/url/parse.hpp>
 
+#include <algorithm>
+
 namespace lux::net {
 
 void http_router::add_route(lux::net::base::http_method method, std::string_view target, handler_type handler)
@@ -16,6 +18,32 @@ void http_router::add_route(lux::net::base::http_method method, std::string_view
     routes_[key] = lux::move(handler);
 }
 
+void http_router::add_static_route(std::string_view prefix, const lux::net::static_file_handler_config& config)
+{
+    while (prefix.ends_with('/'))
+    {
+        prefix.remove_suffix(1);
+    }
+
+    LUX_ASSERT(std::ranges::none_of(static_routes_, [prefix](const auto& route) { return route.prefix == prefix; }),
+               "Static route for prefix already exists");
+
+    const auto it = std::ranges::upper_bound(
+        static_routes_, prefix.size(), std::greater<>{}, [](const static_route& route) { return route.prefix.size(); });
+    static_routes_.insert(it,
+                          static_route{.prefix = std::string{prefix},
+                                       .handler = std::make_unique<lux::net::static_file_handler>(config)});
+}
+
+const http_router::static_route* http_router::find_static_route(std::string_view path) const
+{
+    const auto it = std::ranges::find_if(static_routes_, [path](const static_route& route) {
+        return path.starts_with(route.prefix) &&
+               (path.size() == route.prefix.size() || path[route.prefix.size()] == '/');
+    });
+    return it != static_routes_.end() ? &*it : nullptr;
+}
+
 void http_router::route(const lux::net::base::http_request& request, lux::net::base::http_response& response) const
 {
     const auto result = boost::urls::parse_origin_form(request.target());
@@ -32,12 +60,38 @@ void http_router::route(const lux::net::base::http_request& request, lux::net::b
     if (it != routes_.end())
     {
         it->second(request, response);
+        return;
+    }
+
+    if (request.method() == lux::net::base::http_method::get)
+    {
+        if (const auto* static_route = find_static_route(key.target))
+        {
+            const auto path = std::string_view{key.target}.substr(static_route->prefix.size());
+            static_route->handler->serve(request, path, response);
+            return;
+        }
     }
-    else
+
+    response.set_status(lux::net::base::http_status::not_found);
+    response.set_body("404 Not Found");
+}
+
+bool http_router::serves_file(const lux::net::base::http_request& request) const
+{
+    if (request.method() != lux::net::base::http_method::get || static_routes_.empty())
     {
-        response.set_status(lux::net::base::http_status::not_found);
-        response.set_body("404 Not Found");
+        return false;
     }
+
+    const auto result = boost::urls::parse_origin_form(request.target());
+    if (!result)
+    {
+        return false;
+    }
+
+    route_key key{request.method(), std::string{result->segments().buffer()}};
+    return !routes_.contains(key) && find_static_route(key.target) != nullptr;
 }
 
 } // namespace lux::net
\ No newline at end of file
@@ -9,6 +9,8 @@
 
 #include <lux/io/net/detail/http_parser.hpp>
 
+#include <lux/io/time/base/timer.hpp>
+
 #include <lux/support/assert.hpp>
 #include <lux/support/move.hpp>
 #include <lux/support/expiring_ref.hpp>
@@ -19,8 +21,10 @@
 #include <boost/beast/http/string_body.hpp>
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <mutex>
 #include <optional>
@@ -169,12 +173,42 @@ boost_http_response_type from_lux_http_response(lux::net::base::http_response&&
         boost_response.set(key, value);
     }
 
-    boost_response.body() = lux::move(response.body());
-    boost_response.prepare_payload();
+    if (const auto& file_body = response.file_body())
+    {
+        // Only the header is serialized, the body is sent from the file after it
+        boost_response.content_length(file_body->size);
+    }
+    else
+    {
+        boost_response.body() = lux::move(response.body());
+        boost_response.prepare_payload();
+    }
 
     return boost_response;
 }
 
+lux::net::base::tcp_acceptor_config create_acceptor_config(const lux::net::base::http_server_config& config)
+{
+    auto acceptor_config = config.acceptor_config;
+    if (config.write_timeout.count() > 0)
+    {
+        acceptor_config.socket_timeout.write = config.write_timeout;
+    }
+    return acceptor_config;
+}
+
+struct session_timeouts
+{
+    std::chrono::milliseconds idle{0};
+    std::chrono::milliseconds header_read{0};
+    std::chrono::milliseconds body_read{0};
+
+    bool enabled() const
+    {
+        return idle.count() > 0 || header_read.count() > 0 || body_read.count() > 0;
+    }
+};
+
 using expiring_handler = lux::expiring_ref<lux::net::base::http_server_handler>;
 
 class http_session;
@@ -187,14 +221,24 @@ class http_session : public std::enable_shared_from_this<http_session>,
 public:
     http_session(lux::net::base::tcp_inbound_socket_ptr&& socket_ptr,
                  const expiring_handler& handler,
-                 session_unregister_callback unregister_callback)
+                 session_unregister_callback unregister_callback,
+                 lux::time::base::interval_timer_ptr timer,
+                 const session_timeouts& timeouts)
         : socket_ptr_{lux::move(socket_ptr)},
           handler_{handler},
           parser_{*this},
+          timer_{lux::move(timer)},
+          timeouts_{timeouts},
           unregister_callback_{lux::move(unregister_callback)}
     {
         LUX_ASSERT(socket_ptr_, "TCP inbound socket must not be null");
         socket_ptr_->set_handler(*this);
+
+        if (timer_)
+        {
+            // The timer is owned by the session, so capturing `this` is safe
+            timer_->set_handler([this] { on_timeout(); });
+        }
     }
 
 public:
@@ -202,6 +246,7 @@ public:
     {
         LUX_ASSERT(socket_ptr_, "TCP inbound socket must not be null");
         self_ = shared_from_this();
+        arm_timeout(timeout_phase::idle);
         socket_ptr_->read();
     }
 
@@ -212,7 +257,7 @@ public:
             return;
         }
 
-        if (state_ == state::responding)
+        if (state_ == state::responding || awaiting_response_)
         {
             set_state(state::closing);
             return;
@@ -231,6 +276,7 @@ private:
     void on_disconnected(lux::net::base::tcp_inbound_socket& socket, const std::error_code& ec) override
     {
         set_state(state::closed);
+        arm_timeout(timeout_phase::none);
 
         std::ignore = socket;
         std::ignore = ec;
@@ -247,8 +293,14 @@ private:
     {
         std::ignore = socket;
 
+        if (state_ == state::closing)
+        {
+            return; // Closed while a response is being prepared, no further requests are handled
+        }
+
         set_state(state::parsing);
         parser_.parse(data);
+        update_read_timeout();
     }
 
     void on_data_sent(lux::net::base::tcp_inbound_socket& socket, const std::span<const std::byte>& data) override
@@ -256,7 +308,15 @@ private:
         std::ignore = socket;
         std::ignore = data;
 
+        if (awaiting_response_)
+        {
+            return; // The connection isn't idle while the next response is being prepared
+        }
+
         set_state(state::idle);
+
+        // Restarted on every sent chunk, so a long response doesn't count towards the wait for the next request
+        arm_timeout(timeout_phase::idle);
     }
 
 private:
@@ -268,9 +328,78 @@ private:
             return; // Handler is no longer valid, do not process the request
         }
 
+        if (awaiting_response_)
+        {
+            // Responses are sent in request order, so pipelined requests wait for the one handled on the pool
+            queued_requests_.push_back(request);
+            return;
+        }
+
+        handle(request);
+    }
+
+    void on_parse_error(const std::error_code& ec) override
+    {
+        if (!handler_.is_valid())
+        {
+            return; // Handler is no longer valid, do not process the error
+        }
+
+        set_state(state::idle);
+        handler_.get().on_server_error(ec);
+    }
+
+private:
+    void handle(const lux::net::base::http_request& request)
+    {
         set_state(state::responding);
 
-        auto response = handler_.get().handle_request(request);
+        if (!handler_.get().may_block(request))
+        {
+            send_response(handler_.get().handle_request(request));
+            return;
+        }
+
+        awaiting_response_ = true;
+        arm_timeout(timeout_phase::none);
+
+        auto response = std::make_shared<lux::net::base::http_response>();
+        socket_ptr_->run_blocking(
+            [self = shared_from_this(), request, response] {
+                if (self->handler_.is_valid())
+                {
+                    *response = self->handler_.get().handle_request(request);
+                }
+            },
+            [self = shared_from_this(), response] { self->on_blocking_request_handled(lux::move(*response)); });
+    }
+
+    void on_blocking_request_handled(lux::net::base::http_response&& response)
+    {
+        awaiting_response_ = false;
+        if (state_ == state::closed || !handler_.is_valid())
+        {
+            return;
+        }
+
+        if (state_ != state::closing)
+        {
+            set_state(state::responding); // Requests may have been received in the meantime
+        }
+
+        send_response(lux::move(response));
+
+        while (!awaiting_response_ && !queued_requests_.empty() && state_ == state::responding)
+        {
+            const auto request = lux::move(queued_requests_.front());
+            queued_requests_.pop_front();
+            handle(request);
+        }
+    }
+
+    void send_response(lux::net::base::http_response&& response)
+    {
+        auto file_body = response.file_body();
         auto boost_response = from_lux_http_response(lux::move(response));
 
         using serializer_type = boost::beast::http::response_serializer<boost::beast::http::string_body>;
@@ -300,6 +429,14 @@ private:
                 handler_.get().on_server_error(ec);
             }
         }
+        else if (file_body && file_body->size > 0)
+        {
+            // Queued after the header, the socket sends it once the header is written
+            if (const auto err = socket_ptr_->send_file(lux::move(*file_body)); err && handler_.is_valid())
+            {
+                handler_.get().on_server_error(err);
+            }
+        }
 
         if (state_ == state::closing)
         {
@@ -307,15 +444,93 @@ private:
         }
     }
 
-    void on_parse_error(const std::error_code& ec) override
+private:
+    enum class timeout_phase
     {
-        if (!handler_.is_valid())
+        none,
+        idle,
+        header,
+        body
+    };
+
+    void update_read_timeout()
+    {
+        if (awaiting_response_)
         {
-            return; // Handler is no longer valid, do not process the error
+            // The client is waiting for the response being prepared, not the other way round
+            arm_timeout(timeout_phase::none);
+            return;
         }
 
-        set_state(state::idle);
-        handler_.get().on_server_error(ec);
+        switch (state_)
+        {
+        case state::parsing: {
+            // Header and body deadlines are absolute - they are not extended by every received chunk
+            const auto phase = parser_.is_header_done() ? timeout_phase::body : timeout_phase::header;
+            if (phase != timeout_phase_)
+            {
+                arm_timeout(phase);
+            }
+            break;
+        }
+        case state::idle:
+            if (timeout_phase_ != timeout_phase::idle)
+            {
+                arm_timeout(timeout_phase::idle);
+            }
+            break;
+        case state::responding:
+        case state::closing:
+        case state::closed:
+            // Writes are guarded by the socket write timeout
+            arm_timeout(timeout_phase::none);
+            break;
+        }
+    }
+
+    void arm_timeout(timeout_phase phase)
+    {
+        timeout_phase_ = phase;
+        if (!timer_)
+        {
+            return;
+        }
+
+        const auto timeout = [&] {
+            switch (phase)
+            {
+            case timeout_phase::idle:
+                return timeouts_.idle;
+            case timeout_phase::header:
+                return timeouts_.header_read;
+            case timeout_phase::body:
+                return timeouts_.body_read;
+            case timeout_phase::none:
+                return std::chrono::milliseconds::zero();
+            }
+            LUX_UNREACHABLE();
+        }();
+
+        if (timeout.count() > 0)
+        {
+            timer_->schedule(timeout);
+        }
+        else
+        {
+            timer_->cancel();
+        }
+    }
+
+    void on_timeout()
+    {
+        // Keep the session alive - disconnecting releases the last reference in on_disconnected
+        const auto self = shared_from_this();
+
+        set_state(state::closing);
+        if (socket_ptr_)
+        {
+            socket_ptr_->disconnect(false);
+        }
     }
 
 private:
@@ -338,9 +553,17 @@ private:
     lux::net::base::tcp_inbound_socket_ptr socket_ptr_{nullptr};
     expiring_handler handler_;
 
+    bool awaiting_response_{false}; // A request is being handled on the blocking pool
+    std::deque<lux::net::base::http_request> queued_requests_; // Pipelined behind it
+
 private:
     detail::http_request_parser parser_;
 
+private:
+    lux::time::base::interval_timer_ptr timer_;
+    session_timeouts timeouts_;
+    timeout_phase timeout_phase_{timeout_phase::none};
+
 private:
     session_unregister_callback unregister_callback_;
     std::shared_ptr<http_session> self_; // To keep the session alive during async operations
@@ -355,7 +578,10 @@ public:
     impl(const lux::net::base::http_server_config& config,
          lux::net::base::http_server_handler& handler,
          lux::net::base::socket_factory& socket_factory)
-        : handler_{handler}, acceptor_{socket_factory.create_tcp_acceptor(config.acceptor_config, *this)}
+        : handler_{handler},
+          timer_factory_{socket_factory.timer_factory()},
+          timeouts_{create_session_timeouts(config)},
+          acceptor_{socket_factory.create_tcp_acceptor(create_acceptor_config(config), *this)}
     {
     }
 
@@ -364,7 +590,9 @@ public:
          lux::net::base::socket_factory& socket_factory,
          lux::net::base::ssl_context& ssl_context)
         : handler_{handler},
-          acceptor_{socket_factory.create_ssl_tcp_acceptor(config.acceptor_config, ssl_context, *this)}
+          timer_factory_{socket_factory.timer_factory()},
+          timeouts_{create_session_timeouts(config)},
+          acceptor_{socket_factory.create_ssl_tcp_acceptor(create_acceptor_config(config), ssl_context, *this)}
     {
     }
 
@@ -430,9 +658,13 @@ private:
             return;
         }
 
-        auto session = std::make_shared<http_session>(lux::move(socket_ptr), handler_, [this](http_session* addr) {
-            unregister_session(addr);
-        });
+        auto timer = timeouts_.enabled() ? timer_factory_.create_interval_timer() : nullptr;
+        auto session = std::make_shared<http_session>(
+            lux::move(socket_ptr),
+            handler_,
+            [this](http_session* addr) { unregister_session(addr); },
+            lux::move(timer),
+            timeouts_);
 
         {
             std::lock_guard lock{sessions_mutex_};
@@ -452,8 +684,20 @@ private:
         handler_.get().on_server_error(ec);
     }
 
+private:
+    static session_timeouts create_session_timeouts(const lux::net::base::http_server_config& config)
+    {
+        return session_timeouts{
+            .idle = config.idle_timeout,
+            .header_read = config.header_read_timeout,
+            .body_read = config.body_read_timeout,
+        };
+    }
+
 private:
     expiring_handler handler_;
+    lux::time::base::timer_factory& timer_factory_;
+    session_timeouts timeouts_;
     lux::net::base::tcp_acceptor_ptr acceptor_{nullptr};
 
     std::recursive_mutex sessions_mutex_;
@@ -55,6 +55,11 @@ void http_server_app::del(std::string_view target, handler_type handler)
     router_.add_route(lux::net::base::http_method::delete_, target, lux::move(handler));
 }
 
+void http_server_app::serve_static(std::string_view prefix, const lux::net::static_file_handler_config& config)
+{
+    router_.add_static_route(prefix, config);
+}
+
 void http_server_app::set_on_error_handler(error_handler_type handler)
 {
     on_error_handler_ = lux::move(handler);
@@ -93,7 +98,17 @@ lux::net::base::http_response http_server_app::handle_request(const lux::net::ba
     response.set_header("Server", config_.server_name);
 
     router_.route(request, response);
+
+    if (config_.compression.enabled)
+    {
+        compress_response(request, response, config_.compression);
+    }
     return response;
 }
 
+bool http_server_app::may_block(const lux::net::base::http_request& request)
+{
+    return router_.serves_file(request);
+}
+
 } // namespace lux::net
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include <lux/io/net/reloadable_ssl_context.hpp>
+#include <lux/io/net/detail/servername_dispatcher.hpp>
+
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+
+#include <string_view>
+
+namespace lux::net {
+
+reloadable_ssl_context::reloadable_ssl_context(std::shared_ptr<lux::net::base::ssl_context> initial,
+                                               lux::net::base::ssl_context::method method)
+    : context_{method}, current_{lux::move(initial)}
+{
+    LUX_ASSERT(current_, "Initial SSL context must not be null");
+
+    dispatcher_ = std::make_unique<lux::net::detail::servername_dispatcher>(
+        context_, [this](std::string_view) { return current(); });
+}
+
+reloadable_ssl_context::~reloadable_ssl_context() = default;
+
+void reloadable_ssl_context::reload(std::shared_ptr<lux::net::base::ssl_context> ctx)
+{
+    LUX_ASSERT(ctx, "SSL context must not be null");
+
+    std::lock_guard lock{mutex_};
+    current_ = lux::move(ctx);
+}
+
+std::shared_ptr<lux::net::base::ssl_context> reloadable_ssl_context::current() const
+{
+    std::lock_guard lock{mutex_};
+    return current_;
+}
+
+} // namespace lux::net
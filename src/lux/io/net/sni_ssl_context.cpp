@@ -0,0 +1,81 @@
+#include <lux/io/net/sni_ssl_context.hpp>
+#include <lux/io/net/detail/servername_dispatcher.hpp>
+
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+namespace lux::net {
+
+namespace {
+
+// Longest host name allowed by DNS
+constexpr std::size_t max_host_name_size = 253;
+
+char to_lower(char c) noexcept
+{
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+} // namespace
+
+sni_ssl_context::sni_ssl_context(const lux::string_unordered_map<context_ptr>& contexts,
+                                 context_ptr default_context,
+                                 lux::net::base::ssl_context::method method)
+    : context_{method}, default_context_{lux::move(default_context)}
+{
+    contexts_.reserve(contexts.size());
+    for (const auto& [host_name, ctx] : contexts)
+    {
+        LUX_ASSERT(ctx, "SSL context must not be null");
+        LUX_ASSERT(!host_name.empty() && host_name.size() <= max_host_name_size, "Invalid SNI host name");
+
+        std::string normalized{host_name};
+        std::ranges::transform(normalized, normalized.begin(), to_lower);
+
+        const bool inserted = contexts_.emplace(lux::move(normalized), ctx).second;
+        LUX_ASSERT(inserted, "Host names must be unique regardless of case");
+    }
+
+    dispatcher_ = std::make_unique<lux::net::detail::servername_dispatcher>(
+        context_, [this](std::string_view server_name) -> std::shared_ptr<lux::net::base::ssl_context> {
+            const auto* entry = find(server_name);
+            return entry ? entry->current() : nullptr;
+        });
+}
+
+sni_ssl_context::~sni_ssl_context() = default;
+
+lux::net::reloadable_ssl_context* sni_ssl_context::find(std::string_view server_name) const noexcept
+{
+    if (server_name.empty() || server_name.size() > max_host_name_size)
+    {
+        return default_context_.get();
+    }
+
+    std::array<char, max_host_name_size> buffer;
+    std::ranges::transform(server_name, buffer.begin(), to_lower);
+    const std::string_view host_name{buffer.data(), server_name.size()};
+
+    if (const auto it = contexts_.find(host_name); it != contexts_.end())
+    {
+        return it->second.get();
+    }
+
+    // The first label is replaced in place, so "www.example.com" is looked up as "*.example.com"
+    if (const auto dot = host_name.find('.'); dot != std::string_view::npos && dot > 0)
+    {
+        buffer[dot - 1] = '*';
+        if (const auto it = contexts_.find(host_name.substr(dot - 1)); it != contexts_.end())
+        {
+            return it->second.get();
+        }
+    }
+
+    return default_context_.get();
+}
+
+} // namespace lux::net
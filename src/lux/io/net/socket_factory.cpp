@@ -6,7 +6,13 @@
 
 namespace lux::net {
 
-net::socket_factory::socket_factory(boost::asio::any_io_executor exe) : executor_{exe}, timer_factory_{exe}
+net::socket_factory::socket_factory(boost::asio::any_io_executor exe)
+    : executor_{exe}, default_timer_factory_{exe}, timer_factory_{default_timer_factory_}
+{
+}
+
+net::socket_factory::socket_factory(boost::asio::any_io_executor exe, lux::time::base::timer_factory& timer_factory)
+    : executor_{exe}, default_timer_factory_{exe}, timer_factory_{timer_factory}
 {
 }
 
@@ -32,7 +38,7 @@ lux::net::base::tcp_socket_ptr socket_factory::create_ssl_tcp_socket(const lux::
 lux::net::base::tcp_acceptor_ptr socket_factory::create_tcp_acceptor(const lux::net::base::tcp_acceptor_config& config,
                                                                      lux::net::base::tcp_acceptor_handler& handler)
 {
-    return std::make_unique<lux::net::tcp_acceptor>(executor_, handler, config);
+    return std::make_unique<lux::net::tcp_acceptor>(executor_, handler, config, timer_factory_);
 }
 
 lux::net::base::tcp_acceptor_ptr
@@ -40,7 +46,12 @@ lux::net::base::tcp_acceptor_ptr
                                             lux::net::base::ssl_context& ssl_context,
                                             lux::net::base::tcp_acceptor_handler& handler)
 {
-    return std::make_unique<lux::net::ssl_tcp_acceptor>(executor_, handler, config, ssl_context);
+    return std::make_unique<lux::net::ssl_tcp_acceptor>(executor_, handler, config, timer_factory_, ssl_context);
+}
+
+lux::time::base::timer_factory& socket_factory::timer_factory()
+{
+    return timer_factory_;
 }
 
 } // namespace lux::net
\ No newline at end of file
@@ -0,0 +1,901 @@
+#include <lux/io/net/static_file_handler.hpp>
+#include <lux/io/net/base/file_region.hpp>
+#include <lux/io/net/base/http_status.hpp>
+#include <lux/io/net/detail/http_headers.hpp>
+
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+
+#include <boost/url/pct_string_view.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace lux::net {
+
+namespace {
+
+using detail::find_header;
+using detail::iequals;
+using detail::trim;
+
+struct file_info
+{
+    std::uint64_t size{0};
+
+    // Whole seconds, the resolution of Last-Modified
+    std::chrono::sys_seconds modified{};
+
+    // Identity of the file where the platform provides one cheaply, tells apart a file replaced within a second
+    std::uint64_t id{0};
+
+    bool operator==(const file_info&) const noexcept = default;
+};
+
+enum class file_type
+{
+    none,
+    regular,
+    directory,
+};
+
+struct file_status
+{
+    file_type type{file_type::none};
+    file_info info{};
+};
+
+#ifdef _WIN32
+std::chrono::sys_seconds from_file_time(const FILETIME& time) noexcept
+{
+    // FILETIME counts 100 ns intervals since 1601-01-01
+    constexpr std::int64_t unix_epoch = 116444736000000000;
+    const auto ticks = static_cast<std::int64_t>((std::uint64_t{time.dwHighDateTime} << 32) | time.dwLowDateTime);
+    return std::chrono::sys_seconds{std::chrono::seconds{(ticks - unix_epoch) / 10'000'000}};
+}
+#endif
+
+file_status stat_file(const std::filesystem::path& path)
+{
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data))
+    {
+        return {};
+    }
+
+    if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+    {
+        return {.type = file_type::directory};
+    }
+
+    return {.type = file_type::regular,
+            .info = {.size = (std::uint64_t{data.nFileSizeHigh} << 32) | data.nFileSizeLow,
+                     .modified = from_file_time(data.ftLastWriteTime)}};
+#else
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0)
+    {
+        return {};
+    }
+
+    if (S_ISDIR(st.st_mode))
+    {
+        return {.type = file_type::directory};
+    }
+
+    if (!S_ISREG(st.st_mode))
+    {
+        return {};
+    }
+
+    return {.type = file_type::regular,
+            .info = {.size = static_cast<std::uint64_t>(st.st_size),
+                     .modified = std::chrono::sys_seconds{std::chrono::seconds{st.st_mtime}},
+                     .id = static_cast<std::uint64_t>(st.st_ino)}};
+#endif
+}
+
+// Resolved once, so the paths of opened files can be compared to it
+std::filesystem::path canonical_root(const std::filesystem::path& root)
+{
+    std::error_code ec;
+    auto result = std::filesystem::weakly_canonical(root, ec);
+    if (ec)
+    {
+        return root.lexically_normal();
+    }
+
+    return result.has_filename() ? result : result.parent_path();
+}
+
+// Path of the open file with all symbolic links resolved, taken from the file itself where the platform allows
+std::optional<std::filesystem::path> final_path(lux::net::base::file_source::native_handle_type handle,
+                                                const std::filesystem::path& path)
+{
+#ifdef _WIN32
+    std::ignore = path;
+
+    std::wstring buffer(MAX_PATH, L'\0');
+    for (;;)
+    {
+        const auto size = GetFinalPathNameByHandleW(
+            handle, buffer.data(), static_cast<DWORD>(buffer.size()), FILE_NAME_NORMALIZED | VOLUME_NAME_DOS);
+        if (size == 0)
+        {
+            return std::nullopt;
+        }
+
+        if (size < buffer.size())
+        {
+            buffer.resize(size);
+            break;
+        }
+        buffer.resize(size);
+    }
+
+    // Returned with the \\?\ prefix, which std::filesystem::canonical strips
+    if (buffer.starts_with(LR"(\\?\UNC\)"))
+    {
+        buffer.replace(0, 8, LR"(\\)");
+    }
+    else if (buffer.starts_with(LR"(\\?\)"))
+    {
+        buffer.erase(0, 4);
+    }
+    return std::filesystem::path{lux::move(buffer)};
+#else
+    std::error_code ec;
+#if defined(__linux__)
+    if (auto result = std::filesystem::read_symlink("/proc/self/fd/" + std::to_string(handle), ec); !ec)
+    {
+        return result;
+    }
+#elif defined(F_GETPATH)
+    std::array<char, PATH_MAX> buffer;
+    if (::fcntl(handle, F_GETPATH, buffer.data()) != -1)
+    {
+        return std::filesystem::path{buffer.data()};
+    }
+#endif
+
+    // Without a path of the open file the path is resolved again, which misses links replaced in the meantime
+    auto result = std::filesystem::canonical(path, ec);
+    if (ec)
+    {
+        return std::nullopt;
+    }
+    return result;
+#endif
+}
+
+bool is_beneath(const std::filesystem::path& root, const std::filesystem::path& path)
+{
+    const auto [root_end, path_end] = std::mismatch(root.begin(), root.end(), path.begin(), path.end());
+    return root_end == root.end();
+}
+
+class open_file final : public lux::net::base::file_source
+{
+public:
+    ~open_file() override
+    {
+#ifdef _WIN32
+        CloseHandle(handle_);
+#else
+        ::close(handle_);
+#endif
+    }
+
+    open_file(const open_file&) = delete;
+    open_file& operator=(const open_file&) = delete;
+
+public:
+    /**
+     * Opens a regular file below the root directory and optionally reads it into memory; files that can't be read are
+     * used unloaded. The contents are a copy rather than a mapping, which would fault on access once the file is
+     * truncated.
+     * @return The open file, or nullptr if it can't be opened, is not a regular file, or symbolic links lead it out of
+     * the root directory.
+     */
+    static std::shared_ptr<open_file>
+    open(const std::filesystem::path& root, const std::filesystem::path& path, bool load)
+    {
+#ifdef _WIN32
+        const HANDLE handle{CreateFileW(path.c_str(),
+                                        GENERIC_READ,
+                                        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                        nullptr,
+                                        OPEN_EXISTING,
+                                        FILE_ATTRIBUTE_NORMAL,
+                                        nullptr)};
+        if (handle == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<open_file> file{new open_file{handle}};
+
+        BY_HANDLE_FILE_INFORMATION info;
+        if (!GetFileInformationByHandle(handle, &info) || (info.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+        {
+            return nullptr;
+        }
+
+        file->info_ = {.size = (std::uint64_t{info.nFileSizeHigh} << 32) | info.nFileSizeLow,
+                       .modified = from_file_time(info.ftLastWriteTime)};
+#else
+        const int fd{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+
+        std::shared_ptr<open_file> file{new open_file{fd}};
+
+        // Taken from the open file, the path may have been replaced since it was checked
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+        {
+            return nullptr;
+        }
+
+        file->info_ = {.size = static_cast<std::uint64_t>(st.st_size),
+                       .modified = std::chrono::sys_seconds{std::chrono::seconds{st.st_mtime}},
+                       .id = static_cast<std::uint64_t>(st.st_ino)};
+#endif
+
+        // Checked on the open file, so a link swapped in after the check can't redirect the open
+        if (const auto resolved = final_path(file->handle_, path); !resolved || !is_beneath(root, *resolved))
+        {
+            return nullptr;
+        }
+
+        if (load && file->info_.size > 0)
+        {
+            file->loaded_.resize(static_cast<std::size_t>(file->info_.size));
+            if (file->read(0, file->loaded_))
+            {
+                // Truncated while it was read; the response fails the same way as one sent from the open file
+                file->loaded_ = {};
+            }
+        }
+
+        return file;
+    }
+
+public:
+    const file_info& info() const noexcept
+    {
+        return info_;
+    }
+
+    // lux::net::base::file_source implementation
+    native_handle_type native_handle() const noexcept override
+    {
+        return handle_;
+    }
+
+    std::span<const std::byte> loaded() const noexcept override
+    {
+        return loaded_;
+    }
+
+    std::uint64_t size() const noexcept override
+    {
+        return info_.size;
+    }
+
+    std::error_code read(std::uint64_t offset, std::span<std::byte> buffer) const override
+    {
+        while (!buffer.empty())
+        {
+#ifdef _WIN32
+            OVERLAPPED overlapped{};
+            overlapped.Offset = static_cast<DWORD>(offset);
+            overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+            DWORD bytes_read{0};
+            const auto count = static_cast<DWORD>(std::min<std::size_t>(buffer.size(), MAXDWORD));
+            if (!ReadFile(handle_, buffer.data(), count, &bytes_read, &overlapped))
+            {
+                return {static_cast<int>(GetLastError()), std::system_category()};
+            }
+#else
+            const auto bytes_read = ::pread(handle_, buffer.data(), buffer.size(), static_cast<off_t>(offset));
+            if (bytes_read < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return {errno, std::system_category()};
+            }
+#endif
+
+            if (bytes_read == 0)
+            {
+                // The file was truncated after it had been opened
+                return std::make_error_code(std::errc::io_error);
+            }
+
+            offset += static_cast<std::uint64_t>(bytes_read);
+            buffer = buffer.subspan(static_cast<std::size_t>(bytes_read));
+        }
+
+        return {};
+    }
+
+private:
+    explicit open_file(native_handle_type handle) noexcept : handle_{handle}
+    {
+    }
+
+private:
+    native_handle_type handle_;
+    file_info info_{};
+    std::vector<std::byte> loaded_;
+};
+
+constexpr std::array<std::string_view, 7> weekday_names{"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+constexpr std::array<std::string_view, 12> month_names{
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+void append_two_digits(std::string& out, unsigned value)
+{
+    out.push_back(static_cast<char>('0' + value / 10 % 10));
+    out.push_back(static_cast<char>('0' + value % 10));
+}
+
+// IMF-fixdate, e.g. "Sun, 06 Nov 1994 08:49:37 GMT" (RFC 9110, section 5.6.7)
+std::string format_http_date(std::chrono::sys_seconds time)
+{
+    const auto days = std::chrono::floor<std::chrono::days>(time);
+    const std::chrono::year_month_day date{days};
+    const std::chrono::hh_mm_ss clock{time - days};
+
+    std::string out;
+    out.reserve(29);
+    out += weekday_names[std::chrono::weekday{days}.c_encoding()];
+    out += ", ";
+    append_two_digits(out, static_cast<unsigned>(date.day()));
+    out += ' ';
+    out += month_names[static_cast<unsigned>(date.month()) - 1];
+    out += ' ';
+    append_two_digits(out, static_cast<unsigned>(static_cast<int>(date.year()) / 100));
+    append_two_digits(out, static_cast<unsigned>(static_cast<int>(date.year()) % 100));
+    out += ' ';
+    append_two_digits(out, static_cast<unsigned>(clock.hours().count()));
+    out += ':';
+    append_two_digits(out, static_cast<unsigned>(clock.minutes().count()));
+    out += ':';
+    append_two_digits(out, static_cast<unsigned>(clock.seconds().count()));
+    out += " GMT";
+    return out;
+}
+
+std::optional<unsigned> parse_digits(std::string_view value)
+{
+    unsigned result{0};
+    const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+    if (ec != std::errc{} || end != value.data() + value.size())
+    {
+        return std::nullopt;
+    }
+    return result;
+}
+
+// Only IMF-fixdate is accepted; a date in an obsolete format makes the conditional header be ignored
+std::optional<std::chrono::sys_seconds> parse_http_date(std::string_view value)
+{
+    value = trim(value);
+    if (value.size() != 29 || value.substr(3, 2) != ", " || value[7] != ' ' || value[11] != ' ' || value[16] != ' ' ||
+        value[19] != ':' || value[22] != ':' || value.substr(25) != " GMT")
+    {
+        return std::nullopt;
+    }
+
+    const auto month_it = std::ranges::find(month_names, value.substr(8, 3));
+    const auto day = parse_digits(value.substr(5, 2));
+    const auto year = parse_digits(value.substr(12, 4));
+    const auto hours = parse_digits(value.substr(17, 2));
+    const auto minutes = parse_digits(value.substr(20, 2));
+    const auto seconds = parse_digits(value.substr(23, 2));
+
+    if (month_it == month_names.end() || !day || !year || !hours || !minutes || !seconds || *hours > 23 ||
+        *minutes > 59 || *seconds > 60)
+    {
+        return std::nullopt;
+    }
+
+    const std::chrono::year_month_day date{
+        std::chrono::year{static_cast<int>(*year)},
+        std::chrono::month{static_cast<unsigned>(month_it - month_names.begin()) + 1},
+        std::chrono::day{*day}};
+    if (!date.ok())
+    {
+        return std::nullopt;
+    }
+
+    return std::chrono::sys_days{date} + std::chrono::hours{*hours} + std::chrono::minutes{*minutes} +
+           std::chrono::seconds{*seconds};
+}
+
+void append_hex(std::string& out, std::uint64_t value)
+{
+    std::array<char, 16> buffer;
+    const auto [end, ec] = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, 16);
+    out.append(buffer.data(), end);
+}
+
+std::string make_etag(const file_info& info)
+{
+    std::string etag{"\""};
+    append_hex(etag, static_cast<std::uint64_t>(info.modified.time_since_epoch().count()));
+    etag += '-';
+    append_hex(etag, info.size);
+    if (info.id != 0)
+    {
+        // Tells apart a file replaced by one of the same size within the same second
+        etag += '-';
+        append_hex(etag, info.id);
+    }
+    etag += '"';
+    return etag;
+}
+
+// Weak comparison of the entity tags in the If-None-Match list to the ETag of the file (RFC 9110, section 8.8.3.2)
+bool matches_any_etag(std::string_view list, std::string_view etag)
+{
+    if (trim(list) == "*")
+    {
+        return true;
+    }
+
+    while (!list.empty())
+    {
+        const auto comma = list.find(',');
+        auto tag = trim(list.substr(0, comma));
+        list.remove_prefix(comma == std::string_view::npos ? list.size() : comma + 1);
+
+        if (tag.starts_with("W/"))
+        {
+            tag.remove_prefix(2);
+        }
+
+        if (tag == etag)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool is_not_modified(const lux::net::base::http_request& request, std::string_view etag, const file_info& info)
+{
+    // If-Modified-Since is only evaluated without If-None-Match (RFC 9110, section 13.2.2)
+    if (const auto if_none_match = find_header(request, "If-None-Match"); !if_none_match.empty())
+    {
+        return matches_any_etag(if_none_match, etag);
+    }
+
+    const auto if_modified_since = parse_http_date(find_header(request, "If-Modified-Since"));
+    return if_modified_since && info.modified <= *if_modified_since;
+}
+
+// A range is served only if the representation the client has a part of is still current
+bool if_range_matches(std::string_view if_range, std::string_view etag, const file_info& info)
+{
+    if_range = trim(if_range);
+    if (if_range.empty())
+    {
+        return true;
+    }
+
+    if (if_range.starts_with("W/") || if_range.starts_with('"'))
+    {
+        // Strong comparison, a weak tag never matches
+        return if_range == etag;
+    }
+
+    const auto date = parse_http_date(if_range);
+    return date && *date == info.modified;
+}
+
+struct byte_range
+{
+    enum class kind
+    {
+        ignored,
+        unsatisfiable,
+        satisfiable,
+    };
+
+    kind type{kind::ignored};
+    std::uint64_t offset{0};
+    std::uint64_t size{0};
+};
+
+std::optional<std::uint64_t> parse_position(std::string_view value)
+{
+    std::uint64_t result{0};
+    const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), result);
+    if (value.empty() || ec != std::errc{} || end != value.data() + value.size())
+    {
+        return std::nullopt;
+    }
+    return result;
+}
+
+// A single range of the bytes unit (RFC 9110, section 14.1.2); anything else is ignored and the whole file is served
+byte_range parse_range(std::string_view value, std::uint64_t file_size)
+{
+    constexpr std::string_view unit{"bytes="};
+
+    value = trim(value);
+    if (value.size() <= unit.size() || !iequals(value.substr(0, unit.size()), unit))
+    {
+        return {};
+    }
+
+    const auto spec = trim(value.substr(unit.size()));
+    const auto dash = spec.find('-');
+    if (dash == std::string_view::npos || spec.find(',') != std::string_view::npos)
+    {
+        return {};
+    }
+
+    const auto first = trim(spec.substr(0, dash));
+    const auto last = trim(spec.substr(dash + 1));
+
+    if (first.empty())
+    {
+        // Suffix range, the last N bytes
+        const auto suffix = parse_position(last);
+        if (!suffix)
+        {
+            return {};
+        }
+
+        if (*suffix == 0 || file_size == 0)
+        {
+            return {.type = byte_range::kind::unsatisfiable};
+        }
+
+        const auto size = std::min(*suffix, file_size);
+        return {.type = byte_range::kind::satisfiable, .offset = file_size - size, .size = size};
+    }
+
+    const auto first_pos = parse_position(first);
+    // An open range extends to the end of the file
+    const auto last_pos = last.empty() ? std::optional{std::numeric_limits<std::uint64_t>::max()}
+                                       : parse_position(last);
+    if (!first_pos || !last_pos || *last_pos < *first_pos)
+    {
+        return {};
+    }
+
+    if (*first_pos >= file_size)
+    {
+        return {.type = byte_range::kind::unsatisfiable};
+    }
+
+    const auto end = std::min(*last_pos, file_size - 1);
+    return {.type = byte_range::kind::satisfiable, .offset = *first_pos, .size = end - *first_pos + 1};
+}
+
+constexpr std::array<std::pair<std::string_view, std::string_view>, 24> content_types{{
+    {".css", "text/css; charset=utf-8"},
+    {".csv", "text/csv; charset=utf-8"},
+    {".gif", "image/gif"},
+    {".htm", "text/html; charset=utf-8"},
+    {".html", "text/html; charset=utf-8"},
+    {".ico", "image/x-icon"},
+    {".jpeg", "image/jpeg"},
+    {".jpg", "image/jpeg"},
+    {".js", "text/javascript; charset=utf-8"},
+    {".json", "application/json"},
+    {".map", "application/json"},
+    {".mjs", "text/javascript; charset=utf-8"},
+    {".mp4", "video/mp4"},
+    {".pdf", "application/pdf"},
+    {".png", "image/png"},
+    {".svg", "image/svg+xml"},
+    {".txt", "text/plain; charset=utf-8"},
+    {".wasm", "application/wasm"},
+    {".webm", "video/webm"},
+    {".webp", "image/webp"},
+    {".woff", "font/woff"},
+    {".woff2", "font/woff2"},
+    {".xml", "application/xml"},
+    {".zip", "application/zip"},
+}};
+
+std::string_view content_type(const std::filesystem::path& path)
+{
+    const auto extension = path.extension().u8string();
+    const std::string_view ext{reinterpret_cast<const char*>(extension.data()), extension.size()};
+
+    const auto it = std::ranges::find_if(content_types, [ext](const auto& entry) { return iequals(entry.first, ext); });
+    return it != content_types.end() ? it->second : "application/octet-stream";
+}
+
+void not_found(lux::net::base::http_response& response)
+{
+    response.set_status(lux::net::base::http_status::not_found);
+    response.set_body("404 Not Found");
+}
+
+} // namespace
+
+// lux::net::static_file_handler::impl implementation
+
+class static_file_handler::impl
+{
+public:
+    explicit impl(const lux::net::static_file_handler_config& config) : config_{config}
+    {
+        LUX_ASSERT(!config_.root.empty(), "Static file root directory must not be empty");
+        root_ = canonical_root(config_.root);
+    }
+
+public:
+    void serve(const lux::net::base::http_request& request,
+               std::string_view path,
+               lux::net::base::http_response& response)
+    {
+        auto file_path = resolve(path);
+        if (!file_path)
+        {
+            not_found(response);
+            return;
+        }
+
+        auto status = stat_file(*file_path);
+        if (status.type == file_type::directory && !config_.index_file.empty())
+        {
+            *file_path /= config_.index_file;
+            status = stat_file(*file_path);
+        }
+
+        if (status.type != file_type::regular)
+        {
+            not_found(response);
+            return;
+        }
+
+        const auto file = open(*file_path, status.info);
+        if (!file)
+        {
+            not_found(response);
+            return;
+        }
+
+        const auto& info = file->info();
+        const auto etag = make_etag(info);
+
+        // Validators and caching headers are sent with 304 as well (RFC 9110, section 15.4.5)
+        response.set_header("ETag", etag);
+        response.set_header("Last-Modified", format_http_date(info.modified));
+        if (!config_.cache_control.empty())
+        {
+            response.set_header("Cache-Control", config_.cache_control);
+        }
+
+        if (is_not_modified(request, etag, info))
+        {
+            response.set_status(lux::net::base::http_status::not_modified);
+            return;
+        }
+
+        response.set_status(lux::net::base::http_status::ok);
+        response.set_header("Content-Type", std::string{content_type(*file_path)});
+        response.set_header("Accept-Ranges", "bytes");
+
+        byte_range range{.type = byte_range::kind::ignored};
+        if (const auto value = find_header(request, "Range");
+            !value.empty() && if_range_matches(find_header(request, "If-Range"), etag, info))
+        {
+            range = parse_range(value, info.size);
+        }
+
+        switch (range.type)
+        {
+        case byte_range::kind::ignored:
+            range.offset = 0;
+            range.size = info.size;
+            break;
+
+        case byte_range::kind::unsatisfiable:
+            response.set_status(lux::net::base::http_status::range_not_satisfiable);
+            response.set_header("Content-Range", "bytes */" + std::to_string(info.size));
+            return;
+
+        case byte_range::kind::satisfiable:
+            response.set_status(lux::net::base::http_status::partial_content);
+            response.set_header("Content-Range",
+                                "bytes " + std::to_string(range.offset) + "-" +
+                                    std::to_string(range.offset + range.size - 1) + "/" + std::to_string(info.size));
+            break;
+        }
+
+        if (range.size > 0)
+        {
+            response.set_file_body({.source = file, .offset = range.offset, .size = range.size});
+        }
+    }
+
+    lux::net::static_file_cache_stats cache_stats()
+    {
+        std::lock_guard lock{cache_mutex_};
+        return {.files = cache_.size(), .bytes = cached_bytes_};
+    }
+
+private:
+    using path_string = std::filesystem::path::string_type;
+
+    struct cache_entry
+    {
+        std::shared_ptr<const open_file> file;
+        std::list<path_string>::iterator lru_position;
+    };
+
+    using cache_iterator = std::unordered_map<path_string, cache_entry>::iterator;
+
+private:
+    /**
+     * Maps the percent-encoded request path to a path below the root directory.
+     * Symbolic links are resolved when the file is opened, which rejects files they lead out of the root directory.
+     * @return The path, or std::nullopt if the request path is malformed or would escape the root directory.
+     */
+    std::optional<std::filesystem::path> resolve(std::string_view path) const
+    {
+        auto result = root_;
+        while (!path.empty())
+        {
+            const auto slash = path.find('/');
+            const auto segment = path.substr(0, slash);
+            path.remove_prefix(slash == std::string_view::npos ? path.size() : slash + 1);
+
+            if (segment.empty())
+            {
+                continue;
+            }
+
+            const auto encoded = boost::urls::make_pct_string_view(segment);
+            if (!encoded)
+            {
+                return std::nullopt;
+            }
+
+            // Decoded segments must not be able to add path components of their own
+            const auto decoded = encoded->decode();
+            if (decoded == "." || decoded == ".." ||
+                decoded.find_first_of(std::string_view{"/\\:\0", 4}) != std::string::npos)
+            {
+                return std::nullopt;
+            }
+
+            result /= std::u8string_view{reinterpret_cast<const char8_t*>(decoded.data()), decoded.size()};
+        }
+        return result;
+    }
+
+    bool is_cacheable(std::uint64_t size) const
+    {
+        return size > 0 && size <= config_.cache_max_file_size && size <= config_.cache_max_size;
+    }
+
+    std::shared_ptr<const open_file> open(const std::filesystem::path& path, const file_info& info)
+    {
+        if (!is_cacheable(info.size))
+        {
+            return open_file::open(root_, path, false);
+        }
+
+        {
+            std::lock_guard lock{cache_mutex_};
+            if (const auto it = cache_.find(path.native()); it != cache_.end())
+            {
+                if (it->second.file->info() == info)
+                {
+                    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+                    return it->second.file;
+                }
+
+                // Changed since it was cached; responses still sending it keep the old file alive
+                erase(it);
+            }
+        }
+
+        // Opened outside the lock, so a slow file system doesn't hold up the requests served from the cache
+        auto file = open_file::open(root_, path, true);
+        if (!file || file->loaded().empty() || !is_cacheable(file->size()))
+        {
+            return file;
+        }
+
+        std::lock_guard lock{cache_mutex_};
+        if (const auto it = cache_.find(path.native()); it != cache_.end())
+        {
+            erase(it); // Cached by a concurrent request in the meantime
+        }
+
+        lru_.push_front(path.native());
+        cache_.emplace(path.native(), cache_entry{.file = file, .lru_position = lru_.begin()});
+        cached_bytes_ += static_cast<std::size_t>(file->size());
+
+        while (cached_bytes_ > config_.cache_max_size)
+        {
+            LUX_ASSERT(!lru_.empty(), "Cached files must be tracked by the LRU list");
+            erase(cache_.find(lru_.back()));
+        }
+
+        return file;
+    }
+
+    void erase(cache_iterator it)
+    {
+        LUX_ASSERT(it != cache_.end(), "Cached file must be in the cache");
+
+        cached_bytes_ -= static_cast<std::size_t>(it->second.file->size());
+        lru_.erase(it->second.lru_position);
+        cache_.erase(it);
+    }
+
+private:
+    lux::net::static_file_handler_config config_;
+    std::filesystem::path root_;
+
+    std::mutex cache_mutex_;
+    std::unordered_map<path_string, cache_entry> cache_;
+    std::list<path_string> lru_; // Most recently used first
+    std::size_t cached_bytes_{0};
+};
+
+// lux::net::static_file_handler implementation
+
+static_file_handler::static_file_handler(const lux::net::static_file_handler_config& config)
+    : impl_{std::make_unique<impl>(config)}
+{
+}
+
+static_file_handler::~static_file_handler() = default;
+
+void static_file_handler::serve(const lux::net::base::http_request& request,
+                                std::string_view path,
+                                lux::net::base::http_response& response) const
+{
+    LUX_ASSERT(impl_, "Static file handler implementation must not be null");
+    impl_->serve(request, path, response);
+}
+
+lux::net::static_file_cache_stats static_file_handler::cache_stats() const
+{
+    LUX_ASSERT(impl_, "Static file handler implementation must not be null");
+    return impl_->cache_stats();
+}
+
+} // namespace lux::net
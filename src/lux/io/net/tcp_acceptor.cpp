@@ -115,8 +115,9 @@ protected:
 private:
     explicit base_tcp_acceptor(boost::asio::any_io_executor exe,
                                lux::net::base::tcp_acceptor_handler& handler,
-                               const lux::net::base::tcp_acceptor_config& config)
-        : handler_{&handler}, config_{config}, acceptor_{exe}
+                               const lux::net::base::tcp_acceptor_config& config,
+                               lux::time::base::timer_factory& timer_factory)
+        : handler_{&handler}, config_{config}, timer_factory_{timer_factory}, acceptor_{exe}
     {
     }
 
@@ -154,6 +155,7 @@ private:
 protected:
     lux::net::base::tcp_acceptor_handler* handler_{nullptr};
     lux::net::base::tcp_acceptor_config config_{};
+    lux::time::base::timer_factory& timer_factory_;
 
 private:
     boost::asio::ip::tcp::acceptor acceptor_;
@@ -164,8 +166,9 @@ class tcp_acceptor::impl : public base_tcp_acceptor<tcp_acceptor::impl>
 public:
     impl(boost::asio::any_io_executor exe,
          lux::net::base::tcp_acceptor_handler& handler,
-         const lux::net::base::tcp_acceptor_config& config)
-        : base_tcp_acceptor<tcp_acceptor::impl>(exe, handler, config)
+         const lux::net::base::tcp_acceptor_config& config,
+         lux::time::base::timer_factory& timer_factory)
+        : base_tcp_acceptor<tcp_acceptor::impl>(exe, handler, config, timer_factory)
     {
     }
 
@@ -176,9 +179,11 @@ public:
         {
             const auto socket_config = lux::net::base::tcp_inbound_socket_config{
                 .buffer = config_.socket_buffer,
+                .timeout = config_.socket_timeout,
             };
 
-            handler_->on_accepted(std::make_unique<lux::net::tcp_inbound_socket>(lux::move(socket), socket_config));
+            handler_->on_accepted(
+                std::make_unique<lux::net::tcp_inbound_socket>(lux::move(socket), socket_config, timer_factory_));
         }
 
         // Continue accepting new connections
@@ -188,8 +193,9 @@ public:
 
 tcp_acceptor::tcp_acceptor(boost::asio::any_io_executor exe,
                            lux::net::base::tcp_acceptor_handler& handler,
-                           const lux::net::base::tcp_acceptor_config& config)
-    : impl_{std::make_shared<impl>(exe, handler, config)}
+                           const lux::net::base::tcp_acceptor_config& config,
+                           lux::time::base::timer_factory& timer_factory)
+    : impl_{std::make_shared<impl>(exe, handler, config, timer_factory)}
 {
 }
 
@@ -223,8 +229,9 @@ public:
     impl(boost::asio::any_io_executor exe,
          lux::net::base::tcp_acceptor_handler& handler,
          const lux::net::base::tcp_acceptor_config& config,
+         lux::time::base::timer_factory& timer_factory,
          lux::net::base::ssl_context& ssl_context)
-        : base_tcp_acceptor<ssl_tcp_acceptor::impl>(exe, handler, config), ssl_context_{ssl_context}
+        : base_tcp_acceptor<ssl_tcp_acceptor::impl>(exe, handler, config, timer_factory), ssl_context_{ssl_context}
     {
     }
 
@@ -271,10 +278,12 @@ private:
 
             const lux::net::base::tcp_inbound_socket_config socket_config = {
                 .buffer = config_.socket_buffer,
+                .timeout = config_.socket_timeout,
             };
 
             auto ssl_socket = std::make_unique<lux::net::ssl_tcp_inbound_socket>(lux::move(*temp_stream_),
-                                                                                 socket_config);
+                                                                                 socket_config,
+                                                                                 timer_factory_);
             
             // Reset the temporary stream optional after moving it to the inbound socket
             temp_stream_.reset();
@@ -296,8 +305,9 @@ private:
 ssl_tcp_acceptor::ssl_tcp_acceptor(boost::asio::any_io_executor exe,
                                    lux::net::base::tcp_acceptor_handler& handler,
                                    const lux::net::base::tcp_acceptor_config& config,
+                                   lux::time::base::timer_factory& timer_factory,
                                    lux::net::base::ssl_context& ssl_context)
-    : impl_{std::make_shared<impl>(exe, handler, config, ssl_context)}
+    : impl_{std::make_shared<impl>(exe, handler, config, timer_factory, ssl_context)}
 {
 }
 
@@ -1,27 +1,59 @@
 #include <lux/io/net/tcp_inbound_socket.hpp>
+#include <lux/io/detail/send_queue.hpp>
 #include <lux/io/net/detail/utils.hpp>
+#include <lux/io/time/base/timer.hpp>
 
 #include <lux/support/assert.hpp>
 #include <lux/support/move.hpp>
 #include <lux/utils/memory_arena.hpp>
 
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/beast/core/stream_traits.hpp>
 
 #include <boost/asio/ssl/error.hpp>
 #include <boost/asio/ssl/stream.hpp>
 
-#include <cstring>
-#include <deque>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <span>
 #include <system_error>
 #include <vector>
 
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+
 namespace lux::net {
 
+namespace {
+
+// Files that aren't sent by the kernel are read and written in chunks of this size
+constexpr std::size_t file_chunk_size = 64 * 1024;
+
+// Threads reading those chunks, and running the blocking work of run_blocking, for all sockets
+constexpr std::size_t file_read_threads = 2;
+
+boost::asio::thread_pool& file_read_pool()
+{
+    // Never destroyed, so work still queued at exit doesn't outlive the executors of its sockets
+    static auto* pool = new boost::asio::thread_pool{file_read_threads};
+    return *pool;
+}
+
+#ifdef __linux__
+// Largest transfer of a single sendfile(2) call
+constexpr std::uint64_t max_sendfile_size = 0x7ffff000;
+#endif
+
+} // namespace
+
 template <typename Derived>
 class base_tcp_inbound_socket : public std::enable_shared_from_this<base_tcp_inbound_socket<Derived>>
 {
@@ -69,13 +101,52 @@ public:
             return std::make_error_code(std::errc::invalid_argument);
         }
 
-        auto buffer = memory_arena_->get(data.size());
-        std::memcpy(buffer->data(), data.data(), data.size());
+        send_queue_.push(data);
+        if (!send_queue_.is_sending())
+        {
+            send_next_data();
+        }
+
+        return {};
+    }
+
+    std::error_code send(lux::buffer_chain&& chain)
+    {
+        if (!is_connected())
+        {
+            return std::make_error_code(std::errc::not_connected);
+        }
+
+        if (std::ranges::all_of(chain, [](const auto& chunk) { return chunk->empty(); }))
+        {
+            return std::make_error_code(std::errc::invalid_argument);
+        }
+
+        send_queue_.push(lux::move(chain));
+        if (!send_queue_.is_sending())
+        {
+            send_next_data();
+        }
 
-        const bool can_send = pending_data_to_send_.empty();
-        pending_data_to_send_.emplace_back(lux::move(buffer));
+        return {};
+    }
 
-        if (can_send)
+    std::error_code send_file(lux::net::base::file_region&& region)
+    {
+        if (!is_connected())
+        {
+            return std::make_error_code(std::errc::not_connected);
+        }
+
+        if (!region.source || region.size == 0)
+        {
+            return std::make_error_code(std::errc::invalid_argument);
+        }
+
+        LUX_ASSERT(region.offset + region.size <= region.source->size(), "File region must be within the file");
+
+        send_queue_.push(lux::move(region));
+        if (!send_queue_.is_sending())
         {
             send_next_data();
         }
@@ -83,6 +154,22 @@ public:
         return {};
     }
 
+    void run_blocking(std::function<void()>&& work, std::function<void()>&& completion)
+    {
+        auto executor = stream().get_executor();
+        boost::asio::post(file_read_pool(),
+                          [self = this->shared_from_this(),
+                           executor,
+                           work = lux::move(work),
+                           completion = lux::move(completion)]() mutable {
+                              work();
+                              boost::asio::post(executor,
+                                                [self = lux::move(self), completion = lux::move(completion)] {
+                                                    completion();
+                                                });
+                          });
+    }
+
     void read()
     {
         if (!is_connected())
@@ -151,12 +238,27 @@ protected:
 
 private:
     base_tcp_inbound_socket(lux::net::base::tcp_inbound_socket& parent,
-                            const lux::net::base::tcp_inbound_socket_config& config)
+                            const lux::net::base::tcp_inbound_socket_config& config,
+                            lux::time::base::timer_factory& timer_factory)
         : parent_{&parent},
-          memory_arena_{lux::make_growable_memory_arena(config.buffer.initial_send_chunk_size,
-                                                        config.buffer.initial_send_chunk_count)},
+          timeout_{config.timeout},
+          send_queue_{config.buffer.initial_send_chunk_count, config.buffer.initial_send_chunk_size},
           read_buffer_{config.buffer.read_buffer_size}
     {
+        // Timers are owned by this object, so capturing `this` in their handlers is safe
+        if (timeout_.idle.count() > 0)
+        {
+            idle_timer_ = timer_factory.create_interval_timer();
+            idle_timer_->set_handler([this] { on_idle_timer_expired(); });
+            idle_timer_->schedule(timeout_.idle);
+            last_activity_ = std::chrono::steady_clock::now();
+        }
+
+        if (timeout_.write.count() > 0)
+        {
+            write_timer_ = timer_factory.create_interval_timer();
+            write_timer_->set_handler([this] { on_timeout(); });
+        }
     }
 
 private:
@@ -195,10 +297,54 @@ private:
 private:
     std::error_code close_socket()
     {
-        pending_data_to_send_.clear();
+        cancel_timers();
+        send_queue_.clear();
         return derived().close();
     }
 
+    void note_activity()
+    {
+        // Only the time is taken here; re-arming the timer on every read and write would cost far more
+        if (idle_timer_)
+        {
+            last_activity_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    void cancel_timers()
+    {
+        if (idle_timer_)
+        {
+            idle_timer_->cancel();
+        }
+
+        if (write_timer_)
+        {
+            write_timer_->cancel();
+        }
+    }
+
+    void on_idle_timer_expired()
+    {
+        const auto idle = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                                last_activity_);
+        if (idle < timeout_.idle)
+        {
+            // There was activity since the timer was armed, so it only waits for the rest of the timeout
+            idle_timer_->schedule(timeout_.idle - idle);
+            return;
+        }
+
+        on_timeout();
+    }
+
+    void on_timeout()
+    {
+        // The handler may release the parent (and the last external reference) in on_disconnected
+        const auto self = this->shared_from_this();
+        disconnect_immediately(std::make_error_code(std::errc::timed_out));
+    }
+
     std::error_code shutdown_receive()
     {
         boost::system::error_code ec;
@@ -214,7 +360,7 @@ private:
         case state::disconnecting:
             return {};
         case state::connected:
-            if (pending_data_to_send_.empty())
+            if (send_queue_.empty())
             {
                 return disconnect_immediately();
             }
@@ -251,13 +397,159 @@ private:
             return;
         }
 
-        LUX_ASSERT(!pending_data_to_send_.empty(), "No data to send");
+        LUX_ASSERT(send_queue_.has_pending(), "No data to send");
+
+        if (write_timer_)
+        {
+            write_timer_->schedule(timeout_.write);
+        }
+
+        if (send_queue_.next_is_file_on_disk())
+        {
+            send_file_data(send_queue_.start_next_file());
+            return;
+        }
 
-        auto& data = pending_data_to_send_.front();
         boost::asio::async_write(
             stream(),
-            boost::asio::buffer(*data),
-            [self = this->shared_from_this()](const auto& ec, auto size) { self->on_sent(ec, size); });
+            send_queue_.start_next(),
+            [self = this->shared_from_this()](const auto& ec, auto) { self->on_sent(ec); });
+    }
+
+    void send_file_data(lux::net::base::file_region&& region)
+    {
+#ifdef __linux__
+        if constexpr (!Derived::encrypted)
+        {
+            send_file_natively(lux::move(region));
+            return;
+        }
+#endif
+
+        const auto size = static_cast<std::size_t>(std::min<std::uint64_t>(region.size, file_chunk_size));
+        file_buffer_.resize(file_chunk_size);
+
+        // Reading may block on the disk, so it's done on the file read pool; the buffer is left alone until it's done
+        auto executor = stream().get_executor();
+        boost::asio::post(file_read_pool(),
+                          [self = this->shared_from_this(), executor, region = lux::move(region), size]() mutable {
+                              const std::span buffer{self->file_buffer_.data(), size};
+                              const auto ec = region.source->read(region.offset, buffer);
+
+                              // The socket is only ever used, and released, on its own executor
+                              boost::asio::post(
+                                  executor,
+                                  [self = lux::move(self), region = lux::move(region), size, ec]() mutable {
+                                      self->on_file_data_read(ec, lux::move(region), size);
+                                  });
+                          });
+    }
+
+    void on_file_data_read(const std::error_code& read_ec, lux::net::base::file_region&& region, std::size_t size)
+    {
+        if (!is_connected() && !is_disconnecting())
+        {
+            return;
+        }
+
+        if (read_ec)
+        {
+            // The header has already been sent, so the connection can't be used for anything else
+            disconnect_immediately(read_ec);
+            return;
+        }
+
+        boost::asio::async_write(stream(),
+                                 boost::asio::const_buffer(file_buffer_.data(), size),
+                                 [self = this->shared_from_this(), region = lux::move(region)](
+                                     const auto& ec, auto sent) mutable {
+                                     region.offset += sent;
+                                     region.size -= sent;
+                                     self->on_file_data_sent(ec, lux::move(region));
+                                 });
+    }
+
+#ifdef __linux__
+    void send_file_natively(lux::net::base::file_region&& region)
+    {
+        auto& sock = socket();
+
+        // sendfile(2) must not block the thread; asio's own operations handle a non-blocking socket as well
+        boost::system::error_code ec;
+        sock.native_non_blocking(true, ec);
+        if (ec)
+        {
+            fail_file_transfer(ec);
+            return;
+        }
+
+        while (region.size > 0)
+        {
+            auto offset = static_cast<off_t>(region.offset);
+            const auto count = static_cast<std::size_t>(std::min(region.size, max_sendfile_size));
+            const auto sent = ::sendfile(sock.native_handle(), region.source->native_handle(), &offset, count);
+
+            if (sent > 0)
+            {
+                region.offset += static_cast<std::uint64_t>(sent);
+                region.size -= static_cast<std::uint64_t>(sent);
+                continue;
+            }
+
+            if (sent < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            {
+                sock.async_wait(boost::asio::socket_base::wait_write,
+                                [self = this->shared_from_this(), region = lux::move(region)](const auto& ec) mutable {
+                                    self->on_file_data_sent(ec, lux::move(region));
+                                });
+                return;
+            }
+
+            // Nothing sent means the file was truncated after the region was taken
+            fail_file_transfer(sent == 0 ? std::make_error_code(std::errc::io_error)
+                                         : std::error_code{errno, std::system_category()});
+            return;
+        }
+
+        // Completed without waiting; the handler is notified from the executor, not from within send_file
+        boost::asio::post(stream().get_executor(), [self = this->shared_from_this()] { self->on_sent({}); });
+    }
+#endif
+
+    void on_file_data_sent(const boost::system::error_code& ec, lux::net::base::file_region&& region)
+    {
+        if (ec || region.size == 0)
+        {
+            on_sent(ec);
+            return;
+        }
+
+        if (!is_connected() && !is_disconnecting())
+        {
+            return;
+        }
+
+        note_activity();
+
+        // The timeout applies to each part of the file, a large file may take a while as a whole
+        if (write_timer_)
+        {
+            write_timer_->schedule(timeout_.write);
+        }
+
+        send_file_data(lux::move(region));
+    }
+
+    void fail_file_transfer(const std::error_code& ec)
+    {
+        // The header has already been sent, so the connection can't be used for anything else
+        boost::asio::post(stream().get_executor(),
+                          [self = this->shared_from_this(), ec] { self->disconnect_immediately(ec); });
     }
 
     void on_read(const boost::system::error_code& ec, std::size_t size)
@@ -278,6 +570,8 @@ private:
             return;
         }
 
+        note_activity();
+
         if (size > 0 && handler_)
         {
             std::span<const std::byte> data{read_buffer_.data(), size};
@@ -289,7 +583,7 @@ private:
         read();
     }
 
-    void on_sent(const boost::system::error_code& ec, std::size_t size)
+    void on_sent(const boost::system::error_code& ec)
     {
         if (ec == boost::asio::error::operation_aborted)
         {
@@ -307,20 +601,34 @@ private:
             return;
         }
 
-        if (handler_)
+        // The handler may send more data or disconnect, so the write is completed before notifying it
+        send_queue_.complete([this](std::span<const std::byte> data) {
+            if (handler_)
+            {
+                LUX_ASSERT(parent_, "TCP inbound socket parent must not be null");
+                handler_->on_data_sent(*parent_, data);
+            }
+        });
+
+        note_activity();
+
+        if (send_queue_.is_sending())
         {
-            LUX_ASSERT(parent_, "TCP inbound socket parent must not be null");
-            const auto& last_data_sent = *pending_data_to_send_.front();
-            const auto& last_data_view = std::span<const std::byte>(last_data_sent.data(), size);
-            handler_->on_data_sent(*parent_, last_data_view);
+            return; // The handler has already started the next write
         }
 
-        pending_data_to_send_.pop_front();
-        if (!pending_data_to_send_.empty())
+        if (send_queue_.has_pending())
         {
             send_next_data();
+            return;
+        }
+
+        if (write_timer_)
+        {
+            write_timer_->cancel();
         }
-        else if (is_disconnecting())
+
+        if (is_disconnecting())
         {
             disconnect_immediately();
         }
@@ -331,11 +639,15 @@ private:
     lux::net::base::tcp_inbound_socket_handler* handler_{nullptr};
 
 private:
-    using arena_ptr = lux::growable_memory_arena_ptr<>;
-    using arena_element = arena_ptr::element_type::element_type;
-    arena_ptr memory_arena_;
-    std::deque<arena_element> pending_data_to_send_;
+    lux::net::base::socket_timeout_config timeout_;
+    lux::time::base::interval_timer_ptr idle_timer_;
+    lux::time::base::interval_timer_ptr write_timer_;
+    std::chrono::steady_clock::time_point last_activity_;
+
+private:
+    lux::detail::send_queue send_queue_;
     std::vector<std::byte> read_buffer_;
+    std::vector<std::byte> file_buffer_;
 };
 
 class tcp_inbound_socket::impl : public base_tcp_inbound_socket<tcp_inbound_socket::impl>
@@ -343,13 +655,17 @@ class tcp_inbound_socket::impl : public base_tcp_inbound_socket<tcp_inbound_sock
 public:
     impl(boost::asio::ip::tcp::socket&& socket,
          lux::net::tcp_inbound_socket& parent,
-         const lux::net::base::tcp_inbound_socket_config& config)
-        : base_tcp_inbound_socket<tcp_inbound_socket::impl>{parent, config}, socket_{lux::move(socket)}
+         const lux::net::base::tcp_inbound_socket_config& config,
+         lux::time::base::timer_factory& timer_factory)
+        : base_tcp_inbound_socket<tcp_inbound_socket::impl>{parent, config, timer_factory},
+          socket_{lux::move(socket)}
     {
         state_ = state::connected;
     }
 
 public:
+    static constexpr bool encrypted = false;
+
     auto& stream()
     {
         return socket_;
@@ -381,8 +697,9 @@ private:
 };
 
 tcp_inbound_socket::tcp_inbound_socket(boost::asio::ip::tcp::socket&& socket,
-                                       const lux::net::base::tcp_inbound_socket_config& config)
-    : impl_{std::make_shared<impl>(lux::move(socket), *this, config)}
+                                       const lux::net::base::tcp_inbound_socket_config& config,
+                                       lux::time::base::timer_factory& timer_factory)
+    : impl_{std::make_shared<impl>(lux::move(socket), *this, config, timer_factory)}
 {
 }
 
@@ -405,6 +722,24 @@ std::error_code tcp_inbound_socket::send(const std::span<const std::byte>& data)
     return impl_->send(data);
 }
 
+std::error_code tcp_inbound_socket::send(lux::buffer_chain&& chain)
+{
+    LUX_ASSERT(impl_, "TCP inbound socket implementation must not be null");
+    return impl_->send(lux::move(chain));
+}
+
+std::error_code tcp_inbound_socket::send_file(lux::net::base::file_region region)
+{
+    LUX_ASSERT(impl_, "TCP inbound socket implementation must not be null");
+    return impl_->send_file(lux::move(region));
+}
+
+void tcp_inbound_socket::run_blocking(std::function<void()> work, std::function<void()> completion)
+{
+    LUX_ASSERT(impl_, "TCP inbound socket implementation must not be null");
+    impl_->run_blocking(lux::move(work), lux::move(completion));
+}
+
 void tcp_inbound_socket::read()
 {
     LUX_ASSERT(impl_, "TCP inbound socket implementation must not be null");
@@ -440,13 +775,17 @@ class ssl_tcp_inbound_socket::impl : public base_tcp_inbound_socket<ssl_tcp_inbo
 public:
     impl(boost::asio::ssl::stream<boost::asio::ip::tcp::socket>&& stream,
          lux::net::base::tcp_inbound_socket& parent,
-         const lux::net::base::tcp_inbound_socket_config& config)
-        : base_tcp_inbound_socket<ssl_tcp_inbound_socket::impl>(parent, config), stream_{lux::move(stream)}
+         const lux::net::base::tcp_inbound_socket_config& config,
+         lux::time::base::timer_factory& timer_factory)
+        : base_tcp_inbound_socket<ssl_tcp_inbound_socket::impl>(parent, config, timer_factory),
+          stream_{lux::move(stream)}
     {
         state_ = state::connected;
     }
 
 public:
+    static constexpr bool encrypted = true;
+
     auto& stream()
     {
         return stream_;
@@ -487,8 +826,9 @@ private:
 };
 
 ssl_tcp_inbound_socket::ssl_tcp_inbound_socket(boost::asio::ssl::stream<boost::asio::ip::tcp::socket>&& stream,
-                                               const lux::net::base::tcp_inbound_socket_config& config)
-    : impl_{std::make_shared<impl>(lux::move(stream), *this, config)}
+                                               const lux::net::base::tcp_inbound_socket_config& config,
+                                               lux::time::base::timer_factory& timer_factory)
+    : impl_{std::make_shared<impl>(lux::move(stream), *this, config, timer_factory)}
 {
 }
 
@@ -511,6 +851,24 @@ std::error_code ssl_tcp_inbound_socket::send(const std::span<const std::byte>& d
     return impl_->send(data);
 }
 
+std::error_code ssl_tcp_inbound_socket::send(lux::buffer_chain&& chain)
+{
+    LUX_ASSERT(impl_, "TCP inbound socket implementation must not be null");
+    return impl_->send(lux::move(chain));
+}
+
+std::error_code ssl_tcp_inbound_socket::send_file(lux::net::base::file_region region)
+{
+    LUX_ASSERT(impl_, "TCP inbound socket implementation must not be null");
+    return impl_->send_file(lux::move(region));
+}
+
+void ssl_tcp_inbound_socket::run_blocking(std::function<void()> work, std::function<void()> completion)
+{
+    LUX_ASSERT(impl_, "TCP inbound socket implementation must not be null");
+    impl_->run_blocking(lux::move(work), lux::move(completion));
+}
+
 void ssl_tcp_inbound_socket::read()
 {
     LUX_ASSERT(impl_, "TCP inbound socket implementation must not be null");
@@ -1,4 +1,5 @@
 #include <lux/io/net/tcp_socket.hpp>
+#include <lux/io/detail/send_queue.hpp>
 #include <lux/io/net/detail/utils.hpp>
 
 #include <lux/io/net/base/endpoint.hpp>
@@ -19,8 +20,7 @@
 
 #include <boost/beast/core/stream_traits.hpp>
 
-#include <cstring>
-#include <deque>
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <span>
@@ -160,13 +160,29 @@ public:
             return std::make_error_code(std::errc::invalid_argument);
         }
 
-        auto buffer = memory_arena_->get(data.size());
-        std::memcpy(buffer->data(), data.data(), data.size());
+        send_queue_.push(data);
+        if (!send_queue_.is_sending())
+        {
+            send_next_data();
+        }
+
+        return {};
+    }
+
+    std::error_code send(lux::buffer_chain&& chain)
+    {
+        if (!is_connected())
+        {
+            return std::make_error_code(std::errc::not_connected);
+        }
 
-        const bool can_send = pending_data_to_send_.empty();
-        pending_data_to_send_.emplace_back(lux::move(buffer));
+        if (std::ranges::all_of(chain, [](const auto& chunk) { return chunk->empty(); }))
+        {
+            return std::make_error_code(std::errc::invalid_argument);
+        }
 
-        if (can_send)
+        send_queue_.push(lux::move(chain));
+        if (!send_queue_.is_sending())
         {
             send_next_data();
         }
@@ -228,8 +244,7 @@ private:
           parent_{&parent},
           handler_{&handler},
           config_{config},
-          memory_arena_{lux::make_growable_memory_arena(config_.buffer.initial_send_chunk_size,
-                                                        config_.buffer.initial_send_chunk_count)},
+          send_queue_{config_.buffer.initial_send_chunk_count, config_.buffer.initial_send_chunk_size},
           read_buffer_{config_.buffer.read_buffer_size},
           timer_factory_{timer_factory}
     {
@@ -280,7 +295,7 @@ private:
 private:
     std::error_code close_socket()
     {
-        pending_data_to_send_.clear();
+        send_queue_.clear();
         return derived().close();
     }
 
@@ -298,7 +313,7 @@ private:
         case state::disconnected:
             return {}; // No error, already disconnected or disconnecting
         case state::connected:
-            if (pending_data_to_send_.empty())
+            if (send_queue_.empty())
             {
                 return disconnect_immediately(); // No pending data, disconnect immediately
             }
@@ -393,13 +408,12 @@ private:
             return;
         }
 
-        LUX_ASSERT(!pending_data_to_send_.empty(), "No data to send");
+        LUX_ASSERT(send_queue_.has_pending(), "No data to send");
 
-        auto& data = pending_data_to_send_.front();
         boost::asio::async_write(
             stream(),
-            boost::asio::buffer(*data),
-            [self = this->shared_from_this()](const auto& ec, auto size) { self->on_sent(ec, size); });
+            send_queue_.start_next(),
+            [self = this->shared_from_this()](const auto& ec, auto) { self->on_sent(ec); });
     }
 
     void on_resolved(const boost::system::error_code& ec, const boost::asio::ip::tcp::resolver::results_type& results)
@@ -476,7 +490,7 @@ private:
         read();
     }
 
-    void on_sent(const boost::system::error_code& ec, std::size_t size)
+    void on_sent(const boost::system::error_code& ec)
     {
         if (ec == boost::asio::error::operation_aborted)
         {
@@ -495,16 +509,21 @@ private:
             return;
         }
 
-        if (handler_)
+        // The handler may send more data or disconnect, so the write is completed before notifying it
+        send_queue_.complete([this](std::span<const std::byte> data) {
+            if (handler_)
+            {
+                LUX_ASSERT(parent_, "TCP socket parent must not be null");
+                handler_->on_data_sent(*parent_, data);
+            }
+        });
+
+        if (send_queue_.is_sending())
         {
-            LUX_ASSERT(parent_, "TCP socket parent must not be null");
-            const auto& last_data_sent = *pending_data_to_send_.front();
-            const auto& last_data_view = std::span<const std::byte>(last_data_sent.data(), size);
-            handler_->on_data_sent(*parent_, last_data_view);
+            return; // The handler has already started the next write
         }
 
-        pending_data_to_send_.pop_front();
-        if (!pending_data_to_send_.empty())
+        if (send_queue_.has_pending())
         {
             send_next_data();
         }
@@ -528,10 +547,7 @@ private:
     std::optional<lux::net::base::endpoint> remote_endpoint_;
 
 private:
-    using arena_ptr = lux::growable_memory_arena_ptr<>;
-    using arena_element = arena_ptr::element_type::element_type;
-    arena_ptr memory_arena_;
-    std::deque<arena_element> pending_data_to_send_;
+    lux::detail::send_queue send_queue_;
     std::vector<std::byte> read_buffer_;
 
 private:
@@ -656,6 +672,12 @@ std::error_code tcp_socket::send(const std::span<const std::byte>& data)
     return impl_->send(data);
 }
 
+std::error_code tcp_socket::send(lux::buffer_chain&& chain)
+{
+    LUX_ASSERT(impl_, "TCP socket implementation must not be null");
+    return impl_->send(lux::move(chain));
+}
+
 bool tcp_socket::is_connected() const
 {
     LUX_ASSERT(impl_, "TCP socket implementation must not be null");
@@ -858,6 +880,12 @@ std::error_code ssl_tcp_socket::send(const std::span<const std::byte>& data)
     return impl_->send(data);
 }
 
+std::error_code ssl_tcp_socket::send(lux::buffer_chain&& chain)
+{
+    LUX_ASSERT(impl_, "TCP socket implementation must not be null");
+    return impl_->send(lux::move(chain));
+}
+
 bool ssl_tcp_socket::is_connected() const
 {
     LUX_ASSERT(impl_, "TCP socket implementation must not be null");
@@ -1,48 +1,197 @@
 #include <lux/io/proc/process.hpp>
+#include <lux/io/detail/send_queue.hpp>
 
 #include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
 
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/readable_pipe.hpp>
+#include <boost/asio/writable_pipe.hpp>
+#include <boost/asio/write.hpp>
 #include <boost/process/v2/process.hpp>
 #include <boost/process/v2/stdio.hpp>
 #include <boost/system/error_code.hpp>
 
 #if defined(BOOST_PROCESS_V2_WINDOWS)
 #include <boost/process/v2/windows/creation_flags.hpp>
+
+#include <windows.h>
+#include <psapi.h>
 #else
+#include <boost/asio/post.hpp>
+#include <boost/asio/signal_set.hpp>
 #include <boost/process.hpp>
+
+#include <cerrno>
+#include <csignal>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#if defined(__linux__)
+#include <boost/asio/posix/stream_descriptor.hpp>
+
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 #endif
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <format>
 #include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace lux::proc {
 
 namespace {
 
-constexpr std::size_t stdout_buffer_size = 8 * 1024; // 8 KB standard output read buffer size
-constexpr std::size_t stderr_buffer_size = 1024;     // 1 KB standard error read buffer size
-} // namespace
+#if !defined(BOOST_PROCESS_V2_WINDOWS)
 
-namespace lux::proc {
+/**
+ * Applies the resource limits in the child, between fork and exec.
+ */
+struct resource_limits_initializer
+{
+    const lux::proc::base::process_limits& limits;
+
+    template <typename Launcher, typename Path, typename CommandLine>
+    boost::system::error_code on_exec_setup(Launcher&, const Path&, CommandLine&) const
+    {
+        if (limits.cpu_time && !set_limit(RLIMIT_CPU, static_cast<rlim_t>(limits.cpu_time->count())))
+        {
+            return {errno, boost::system::system_category()};
+        }
+
+        if (limits.address_space && !set_limit(RLIMIT_AS, static_cast<rlim_t>(*limits.address_space)))
+        {
+            return {errno, boost::system::system_category()};
+        }
+
+        if (limits.open_files && !set_limit(RLIMIT_NOFILE, static_cast<rlim_t>(*limits.open_files)))
+        {
+            return {errno, boost::system::system_category()};
+        }
+
+        return {};
+    }
+
+    static bool set_limit(int resource, rlim_t value)
+    {
+        const rlimit limit{.rlim_cur = value, .rlim_max = value};
+        return ::setrlimit(resource, &limit) == 0;
+    }
+};
+
+std::chrono::microseconds to_microseconds(const timeval& tv)
+{
+    return std::chrono::seconds{tv.tv_sec} + std::chrono::microseconds{tv.tv_usec};
+}
+
+lux::proc::base::process_usage to_process_usage(const rusage& usage, std::chrono::nanoseconds wall_time)
+{
+#if defined(__APPLE__)
+    constexpr std::size_t max_rss_unit = 1; // Reported in bytes
+#else
+    constexpr std::size_t max_rss_unit = 1024; // Reported in kilobytes
+#endif
+
+    return lux::proc::base::process_usage{.wall_time = wall_time,
+                                          .user_cpu_time = to_microseconds(usage.ru_utime),
+                                          .system_cpu_time = to_microseconds(usage.ru_stime),
+                                          .max_rss = static_cast<std::size_t>(usage.ru_maxrss) * max_rss_unit,
+                                          .input_operations = static_cast<std::size_t>(usage.ru_inblock),
+                                          .output_operations = static_cast<std::size_t>(usage.ru_oublock)};
+}
+
+// Same as boost::process::v2::evaluate_exit_code
+int to_exit_code(int status)
+{
+    if (WIFEXITED(status))
+    {
+        return WEXITSTATUS(status);
+    }
+
+    if (WIFSIGNALED(status))
+    {
+        return WTERMSIG(status);
+    }
+
+    return status;
+}
+
+#else
+
+std::chrono::microseconds to_microseconds(const FILETIME& time)
+{
+    // FILETIME counts 100-nanosecond intervals
+    const auto ticks = (static_cast<std::uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    return std::chrono::microseconds{ticks / 10};
+}
+
+lux::proc::base::process_usage to_process_usage(HANDLE process, std::chrono::nanoseconds wall_time)
+{
+    lux::proc::base::process_usage usage{.wall_time = wall_time};
+
+    FILETIME creation_time{};
+    FILETIME exit_time{};
+    FILETIME kernel_time{};
+    FILETIME user_time{};
+    if (::GetProcessTimes(process, &creation_time, &exit_time, &kernel_time, &user_time))
+    {
+        usage.user_cpu_time = to_microseconds(user_time);
+        usage.system_cpu_time = to_microseconds(kernel_time);
+    }
+
+    PROCESS_MEMORY_COUNTERS memory_counters{};
+    if (::K32GetProcessMemoryInfo(process, &memory_counters, sizeof(memory_counters)))
+    {
+        usage.max_rss = memory_counters.PeakWorkingSetSize;
+    }
+
+    IO_COUNTERS io_counters{};
+    if (::GetProcessIoCounters(process, &io_counters))
+    {
+        usage.input_operations = static_cast<std::size_t>(io_counters.ReadOperationCount);
+        usage.output_operations = static_cast<std::size_t>(io_counters.WriteOperationCount);
+    }
+
+    return usage;
+}
+
+#endif
+
+} // namespace
 
 class process::impl : public std::enable_shared_from_this<impl>
 {
 public:
-    impl(boost::asio::any_io_executor executor, lux::proc::base::process_handler& handler, const std::string& exe_path)
-        : executor_{executor}, handler_{handler}, exe_path_{exe_path}, stdout_pipe_{executor}, stderr_pipe_{executor}
+    impl(boost::asio::any_io_executor executor,
+         lux::proc::base::process_handler& handler,
+         const std::string& exe_path,
+         const lux::proc::base::process_config& config)
+        : executor_{executor},
+          handler_{&handler},
+          exe_path_{exe_path},
+          limits_{config.limits},
+          stdin_{executor, config.in},
+          stdout_{executor, config.out, "stdout", &lux::proc::base::process_handler::on_process_stdout},
+          stderr_{executor, config.err, "stderr", &lux::proc::base::process_handler::on_process_stderr}
     {
-        stdout_read_buffer_.resize(stdout_buffer_size);
-        stderr_read_buffer_.resize(stderr_buffer_size);
     }
 
     ~impl()
     {
-        if (process_.has_value())
-        {
-            boost::system::error_code ignored_ec;
-            process_->terminate(ignored_ec);
-        }
+        // The exit watch keeps the implementation alive, so this is reached only with a child that was never
+        // reaped (e.g. the executor was shut down)
+        terminate_child();
     }
 
 public:
@@ -50,14 +199,28 @@ public:
     {
         namespace bp = boost::process::v2;
 
+        const auto make_stdio = [this] {
+            if (stdin_.enabled)
+            {
+                return bp::process_stdio{.in = stdin_.pipe, .out = stdout_.pipe, .err = stderr_.pipe};
+            }
+
+            return bp::process_stdio{.in = {}, .out = stdout_.pipe, .err = stderr_.pipe};
+        };
+
+        // Taken before spawning, the child may already be running when the spawn returns
+        started_at_ = std::chrono::steady_clock::now();
+
         try
         {
             process_.emplace(executor_,
                              exe_path_,
                              args,
-                             bp::process_stdio{.in = {}, .out = stdout_pipe_, .err = stderr_pipe_}
+                             make_stdio()
 #if defined(BOOST_PROCESS_V2_WINDOWS)
                              , bp::windows::create_new_process_group
+#else
+                             , resource_limits_initializer{limits_}
 #endif
             );
         }
@@ -66,153 +229,600 @@ public:
             return lux::err("Failed to start process (exe={}, err={})", exe_path_, ex.what());
         }
 
-        read_stdout();
-        read_stderr();
-
-        process_->async_wait([self = this->shared_from_this()](const auto& ec, int exit_code) {
-
-            boost::system::error_code ignored_ec;
-            self->stdout_pipe_.close(ignored_ec);
-            self->stderr_pipe_.close(ignored_ec);
+#if !defined(BOOST_PROCESS_V2_WINDOWS)
+        // The child is reaped here with wait4 to get its resource usage, so boost must not reap it
+        pid_ = static_cast<pid_t>(process_->id());
+        process_->detach();
+        process_.reset();
+#endif
 
-            if (ec == boost::asio::error::operation_aborted)
-            {
-                return;
-            }
-
-            if (ec)
-            {
-                self->handler_.on_process_error(std::format("Error waiting for process exit (err={})", ec.message()));
-            }
-            else
-            {
-                self->on_process_exit(exit_code);
-            }
-        });
+        read(stdout_);
+        read(stderr_);
+        wait_for_exit();
 
         return lux::ok();
     }
 
     void terminate()
     {
-        namespace bp = boost::process::v2;
-        
+        if (const auto ec = terminate_child(); ec)
+        {
+            notify(&lux::proc::base::process_handler::on_process_error,
+                   std::format("Error terminating process (err={})", ec.message()));
+        }
+    }
+
+    bool is_running() const
+    {
+#if defined(BOOST_PROCESS_V2_WINDOWS)
         if (!process_.has_value())
         {
-            return;
+            return false;
         }
 
         boost::system::error_code ec;
-        process_->terminate(ec);
+        return process_->running(ec);
+#else
+        if (pid_ <= 0)
+        {
+            return false;
+        }
 
-        if (ec)
+        // WNOWAIT leaves an exited child to be reaped (with its resource usage) by the exit watch
+        siginfo_t info{};
+        if (::waitid(P_PID, static_cast<id_t>(pid_), &info, WEXITED | WNOHANG | WNOWAIT) != 0)
         {
-            handler_.on_process_error(std::format("Error terminating process (err={})", ec.message()));
+            return false;
         }
+
+        return info.si_pid == 0;
+#endif
     }
 
-    bool is_running() const
+    void detach_external_references()
     {
-        if (!process_.has_value())
+        handler_ = nullptr;
+    }
+
+    void pause_output(lux::proc::base::output_stream stream)
+    {
+        channel_for(stream).paused = true;
+    }
+
+    void resume_output(lux::proc::base::output_stream stream)
+    {
+        auto& channel = channel_for(stream);
+        if (!channel.paused)
         {
-            return false;
+            return;
         }
 
-        boost::system::error_code ec;
-        return process_->running(ec);
+        channel.paused = false;
+
+        // Resumed from within the handler - the delivery loop in progress picks up the remaining data
+        if (channel.delivering)
+        {
+            return;
+        }
+
+        deliver(channel);
+        read(channel);
     }
 
-private:
-    void read_stdout()
+    std::error_code write_stdin(std::span<const std::byte> data)
     {
-        stdout_pipe_.async_read_some(
-            boost::asio::buffer(stdout_read_buffer_),
-            [self = this->shared_from_this()](const auto& ec, auto size) { self->on_stdout_read(ec, size); });
+        if (const auto ec = check_stdin_writable(data.size()); ec)
+        {
+            return ec;
+        }
+
+        stdin_.queue.push(data);
+        write_next_stdin();
+        return {};
     }
 
-    void read_stderr()
+    std::error_code write_stdin(std::vector<std::byte>&& data)
     {
-        stderr_pipe_.async_read_some(
-            boost::asio::buffer(stderr_read_buffer_),
-            [self = this->shared_from_this()](const auto& ec, auto size) { self->on_stderr_read(ec, size); });
+        if (const auto ec = check_stdin_writable(data.size()); ec)
+        {
+            return ec;
+        }
+
+        stdin_.queue.push(lux::move(data));
+        write_next_stdin();
+        return {};
+    }
+
+    std::error_code close_stdin(bool send_pending)
+    {
+        if (!stdin_.enabled)
+        {
+            return std::make_error_code(std::errc::operation_not_supported);
+        }
+
+        if (!stdin_.pipe.is_open())
+        {
+            return {}; // Already closed
+        }
+
+        if (send_pending && !stdin_.queue.empty())
+        {
+            // Closed once the last queued write completes
+            stdin_.closing = true;
+            return {};
+        }
+
+        return close_stdin_pipe();
     }
 
 private:
-    void on_stdout_read(const boost::system::error_code& ec, std::size_t bytes_transferred)
+    template <typename Callback, typename... Args>
+    void notify(Callback callback, Args&&... args)
+    {
+        // The process may outlive its owner while asynchronous operations complete
+        if (handler_)
+        {
+            (handler_->*callback)(std::forward<Args>(args)...);
+        }
+    }
+
+    struct input_channel
+    {
+        input_channel(boost::asio::any_io_executor executor, const lux::proc::base::process_input_config& config)
+            : pipe{executor},
+              enabled{config.enabled},
+              queue{config.initial_chunk_count, config.initial_chunk_size}
+        {
+        }
+
+        boost::asio::writable_pipe pipe;
+        const bool enabled;
+        lux::detail::send_queue queue;
+        bool closing{false};
+    };
+
+    std::error_code check_stdin_writable(std::size_t size) const
+    {
+        if (!stdin_.enabled)
+        {
+            return std::make_error_code(std::errc::operation_not_supported);
+        }
+
+        if (!stdin_.pipe.is_open() || stdin_.closing)
+        {
+            return std::make_error_code(std::errc::broken_pipe);
+        }
+
+        if (size == 0)
+        {
+            return std::make_error_code(std::errc::invalid_argument);
+        }
+
+        return {};
+    }
+
+    void write_next_stdin()
+    {
+        if (stdin_.queue.is_sending() || !stdin_.queue.has_pending())
+        {
+            return;
+        }
+
+        boost::asio::async_write(
+            stdin_.pipe,
+            stdin_.queue.start_next(),
+            [self = this->shared_from_this()](const auto& ec, auto) { self->on_stdin_written(ec); });
+    }
+
+    void on_stdin_written(const boost::system::error_code& ec)
     {
-        if (ec == boost::asio::error::operation_aborted || ec == boost::asio::error::broken_pipe ||
-            ec == boost::asio::error::eof)
+        if (ec == boost::asio::error::operation_aborted)
+        {
+            return;
+        }
+
+        // If in the meantime the pipe was closed, ignore the write
+        if (!stdin_.queue.is_sending())
         {
             return;
         }
 
         if (ec)
         {
-            handler_.on_process_error(std::format("Error reading from stdout (err={})", ec.message()));
+            close_stdin_pipe();
+            notify(&lux::proc::base::process_handler::on_process_error,
+                   std::format("Error writing to stdin (err={})", ec.message()));
+            return;
+        }
+
+        // The handler may write or close stdin from the callback
+        stdin_.queue.complete([this](std::span<const std::byte> data) {
+            notify(&lux::proc::base::process_handler::on_process_stdin_written, data);
+        });
+
+        if (stdin_.queue.has_pending())
+        {
+            write_next_stdin();
+        }
+        else if (stdin_.closing && stdin_.queue.empty())
+        {
+            close_stdin_pipe();
+        }
+    }
+
+    std::error_code close_stdin_pipe()
+    {
+        stdin_.queue.clear();
+        stdin_.closing = false;
+
+        boost::system::error_code ec;
+        stdin_.pipe.close(ec);
+        return ec;
+    }
+
+    struct output_channel
+    {
+        output_channel(boost::asio::any_io_executor executor,
+                       const lux::proc::base::process_output_config& config,
+                       std::string_view name,
+                       void (lux::proc::base::process_handler::*callback)(std::string_view))
+            : pipe{executor}, framing{config.framing}, name{name}, callback{callback}
+        {
+            LUX_ASSERT(config.buffer_size > 0, "Output buffer size must be greater than zero");
+            buffer.resize(config.buffer_size);
+        }
+
+        boost::asio::readable_pipe pipe;
+        const lux::proc::base::output_framing framing;
+        const std::string_view name;
+        void (lux::proc::base::process_handler::*const callback)(std::string_view);
+
+        std::vector<char> buffer;
+        std::size_t begin{0}; // Start of the data read but not yet delivered
+        std::size_t end{0};   // End of the data read
+
+        bool reading{false};
+        bool paused{false};
+        bool delivering{false};
+        bool finished{false};
+    };
+
+    output_channel& channel_for(lux::proc::base::output_stream stream)
+    {
+        return stream == lux::proc::base::output_stream::out ? stdout_ : stderr_;
+    }
+
+    void read(output_channel& channel)
+    {
+        if (channel.reading || channel.paused || channel.finished || !channel.pipe.is_open())
+        {
             return;
         }
 
-        if (bytes_transferred > 0)
+        if (channel.begin == channel.end)
+        {
+            channel.begin = channel.end = 0;
+        }
+        else if (channel.end == channel.buffer.size())
         {
-            handler_.on_process_stdout(std::string_view{stdout_read_buffer_.data(), bytes_transferred});
+            // Only the beginning of an unterminated line is left; move it to the front to make room
+            const auto size = channel.end - channel.begin;
+            std::memmove(channel.buffer.data(), channel.buffer.data() + channel.begin, size);
+            channel.begin = 0;
+            channel.end = size;
         }
 
-        read_stdout();
+        channel.reading = true;
+        channel.pipe.async_read_some(
+            boost::asio::buffer(channel.buffer.data() + channel.end, channel.buffer.size() - channel.end),
+            [self = this->shared_from_this(), &channel](const auto& ec, auto size) {
+                self->on_read(channel, ec, size);
+            });
     }
 
-    void on_stderr_read(const boost::system::error_code& ec, std::size_t bytes_transferred)
+    void on_read(output_channel& channel, const boost::system::error_code& ec, std::size_t bytes_transferred)
     {
-        if (ec == boost::asio::error::operation_aborted || ec == boost::asio::error::broken_pipe ||
-            ec == boost::asio::error::eof)
+        channel.reading = false;
+
+        if (ec == boost::asio::error::operation_aborted)
+        {
+            return;
+        }
+
+        if (ec == boost::asio::error::broken_pipe || ec == boost::asio::error::eof)
         {
+            channel.finished = true;
+            deliver(channel);
             return;
         }
 
         if (ec)
         {
-            handler_.on_process_error(std::format("Error reading from stderr (err={})", ec.message()));
+            // Nothing more is read from the stream, so it must not hold the exit back
+            channel.finished = true;
+            notify(&lux::proc::base::process_handler::on_process_error,
+                   std::format("Error reading from {} (err={})", channel.name, ec.message()));
+            deliver(channel);
             return;
         }
 
-        if (bytes_transferred > 0)
+        channel.end += bytes_transferred;
+        deliver(channel);
+        read(channel);
+    }
+
+    void deliver(output_channel& channel)
+    {
+        channel.delivering = true;
+
+        while (!channel.paused && channel.begin < channel.end)
         {
-            handler_.on_process_stderr(std::string_view{stderr_read_buffer_.data(), bytes_transferred});
+            const auto* data = channel.buffer.data();
+
+            if (channel.framing == lux::proc::base::output_framing::chunk)
+            {
+                const std::string_view chunk{data + channel.begin, channel.end - channel.begin};
+                channel.begin = channel.end;
+                notify(channel.callback, chunk);
+                continue;
+            }
+
+            const auto* line_end = std::find(data + channel.begin, data + channel.end, '\n');
+            if (line_end != data + channel.end)
+            {
+                const std::string_view line{data + channel.begin, static_cast<std::size_t>(line_end - data) -
+                                                                      channel.begin};
+                channel.begin += line.size() + 1;
+                notify(channel.callback, line);
+                continue;
+            }
+
+            // A line that fills the whole buffer or the unterminated last line of the stream
+            if ((channel.begin == 0 && channel.end == channel.buffer.size()) || channel.finished)
+            {
+                const std::string_view line{data + channel.begin, channel.end - channel.begin};
+                channel.begin = channel.end;
+                notify(channel.callback, line);
+                continue;
+            }
+
+            break;
+        }
+
+        channel.delivering = false;
+
+        if (channel.finished)
+        {
+            report_exit_once_drained();
+        }
+    }
+
+    static bool drained(const output_channel& channel)
+    {
+        return channel.finished && channel.begin == channel.end;
+    }
+
+    void report_exit_once_drained()
+    {
+        if (!exit_ || !drained(stdout_) || !drained(stderr_))
+        {
+            return;
         }
 
-        read_stderr();
+        const auto [exit_code, usage] = *exit_;
+        exit_.reset();
+        notify(&lux::proc::base::process_handler::on_process_exit, exit_code, usage);
     }
 
 private:
-    void on_process_exit(int exit_code)
+    boost::system::error_code terminate_child()
     {
-        process_.reset();
-        handler_.on_process_exit(exit_code);
+        boost::system::error_code ec;
+
+#if defined(BOOST_PROCESS_V2_WINDOWS)
+        if (process_.has_value())
+        {
+            process_->terminate(ec);
+        }
+#else
+        if (pid_ > 0 && ::kill(pid_, SIGKILL) != 0)
+        {
+            ec.assign(errno, boost::system::system_category());
+        }
+#endif
+
+        return ec;
+    }
+
+#if defined(BOOST_PROCESS_V2_WINDOWS)
+    void wait_for_exit()
+    {
+        process_->async_wait([self = this->shared_from_this()](const auto& ec, int exit_code) {
+            if (ec == boost::asio::error::operation_aborted)
+            {
+                return;
+            }
+
+            if (ec)
+            {
+                self->notify(&lux::proc::base::process_handler::on_process_error,
+                             std::format("Error waiting for process exit (err={})", ec.message()));
+                return;
+            }
+
+            // The process handle stays valid until the process object is destroyed
+            const auto usage = to_process_usage(self->process_->native_handle(),
+                                                std::chrono::steady_clock::now() - self->started_at_);
+            self->on_process_exit(exit_code, usage);
+        });
+    }
+#else
+    void wait_for_exit()
+    {
+#if defined(__linux__)
+        // A pidfd becomes readable once this particular child exits, without taking over the process-wide SIGCHLD
+        // disposition other child-reaping code in the application may rely on
+        if (const auto pidfd = ::syscall(SYS_pidfd_open, pid_, 0); pidfd >= 0)
+        {
+            exit_watch_.emplace(executor_, static_cast<int>(pidfd));
+            wait_for_exit_watch();
+            return;
+        }
+#endif
+
+        // Without pidfds (kernels before 5.3, other platforms) the exit is signaled by SIGCHLD
+        child_signal_.emplace(executor_, SIGCHLD);
+        wait_for_child_signal();
+    }
+
+#if defined(__linux__)
+    void wait_for_exit_watch()
+    {
+        exit_watch_->async_wait(boost::asio::posix::stream_descriptor::wait_read,
+                                [self = this->shared_from_this()](const auto& ec) {
+                                    if (ec == boost::asio::error::operation_aborted)
+                                    {
+                                        return;
+                                    }
+
+                                    if (ec)
+                                    {
+                                        self->notify(&lux::proc::base::process_handler::on_process_error,
+                                                     std::format("Error waiting for process exit (err={})",
+                                                                 ec.message()));
+                                        return;
+                                    }
+
+                                    if (!self->try_reap())
+                                    {
+                                        self->wait_for_exit_watch();
+                                    }
+                                });
+    }
+#endif
+
+    void wait_for_child_signal()
+    {
+        // The signal may have been delivered before the wait started, so the child is checked first
+        if (try_reap())
+        {
+            return;
+        }
+
+        child_signal_->async_wait([self = this->shared_from_this()](const auto& ec, int) {
+            if (ec == boost::asio::error::operation_aborted)
+            {
+                return;
+            }
+
+            if (ec)
+            {
+                self->notify(&lux::proc::base::process_handler::on_process_error,
+                             std::format("Error waiting for process exit (err={})", ec.message()));
+                return;
+            }
+
+            // SIGCHLD is shared by all children - keep waiting if it was another one
+            self->wait_for_child_signal();
+        });
     }
 
+    bool try_reap()
+    {
+        int status = 0;
+        rusage usage{};
+
+        pid_t result = 0;
+        do
+        {
+            result = ::wait4(pid_, &status, WNOHANG, &usage);
+        } while (result == -1 && errno == EINTR);
+
+        if (result == 0)
+        {
+            return false;
+        }
+
+        pid_ = -1;
+
+        // The exit is always reported from the executor, never from within start()
+        if (result == -1)
+        {
+            // Reaped by someone else (e.g. waitpid(-1) elsewhere in the application); the exit code is lost
+            boost::asio::post(executor_,
+                              [self = this->shared_from_this(), ec = std::error_code{errno, std::system_category()}] {
+                                  self->notify(&lux::proc::base::process_handler::on_process_error,
+                                               std::format("Error waiting for process exit (err={})", ec.message()));
+                              });
+            return true;
+        }
+
+        boost::asio::post(executor_,
+                          [self = this->shared_from_this(),
+                           exit_code = to_exit_code(status),
+                           usage = to_process_usage(usage, std::chrono::steady_clock::now() - started_at_)] {
+                              self->on_process_exit(exit_code, usage);
+                          });
+        return true;
+    }
+#endif
+
+    void on_process_exit(int exit_code, const lux::proc::base::process_usage& usage)
+    {
+        process_.reset();
+
+        // The output written right before exiting may still be in the pipes - it's delivered first
+        exit_.emplace(exit_code, usage);
+        report_exit_once_drained();
+    }
 
 private:
     boost::asio::any_io_executor executor_;
-    lux::proc::base::process_handler& handler_;
+    lux::proc::base::process_handler* handler_{nullptr};
     const std::string exe_path_;
+    const lux::proc::base::process_limits limits_;
 
 private:
-    boost::asio::readable_pipe stdout_pipe_;
-    boost::asio::readable_pipe stderr_pipe_;
+    input_channel stdin_;
+    output_channel stdout_;
+    output_channel stderr_;
     mutable std::optional<boost::process::v2::process> process_;
+    std::chrono::steady_clock::time_point started_at_;
+    std::optional<std::pair<int, lux::proc::base::process_usage>> exit_;
 
+#if !defined(BOOST_PROCESS_V2_WINDOWS)
 private:
-    std::vector<char> stdout_read_buffer_;
-    std::vector<char> stderr_read_buffer_;
+#if defined(__linux__)
+    std::optional<boost::asio::posix::stream_descriptor> exit_watch_;
+#endif
+    std::optional<boost::asio::signal_set> child_signal_;
+    pid_t pid_{-1};
+#endif
 };
 
 process::process(boost::asio::any_io_executor executor,
                  lux::proc::base::process_handler& handler,
                  const std::string& exe_path)
-    : impl_{std::make_shared<impl>(executor, handler, exe_path)}
+    : process(executor, handler, exe_path, lux::proc::base::process_config{})
 {
 }
 
-process::~process() = default;
+process::process(boost::asio::any_io_executor executor,
+                 lux::proc::base::process_handler& handler,
+                 const std::string& exe_path,
+                 const lux::proc::base::process_config& config)
+    : impl_{std::make_shared<impl>(executor, handler, exe_path, config)}
+{
+}
+
+process::~process()
+{
+    if (impl_)
+    {
+        impl_->detach_external_references();
+        impl_->terminate();
+    }
+}
 
 lux::status process::start(const std::vector<std::string>& args)
 {
@@ -232,4 +842,34 @@ bool process::is_running() const
     return impl_->is_running();
 }
 
+void process::pause_output(lux::proc::base::output_stream stream)
+{
+    LUX_ASSERT(impl_, "Process implementation must not be null");
+    impl_->pause_output(stream);
+}
+
+void process::resume_output(lux::proc::base::output_stream stream)
+{
+    LUX_ASSERT(impl_, "Process implementation must not be null");
+    impl_->resume_output(stream);
+}
+
+std::error_code process::write_stdin(std::span<const std::byte> data)
+{
+    LUX_ASSERT(impl_, "Process implementation must not be null");
+    return impl_->write_stdin(data);
+}
+
+std::error_code process::write_stdin(std::vector<std::byte>&& data)
+{
+    LUX_ASSERT(impl_, "Process implementation must not be null");
+    return impl_->write_stdin(lux::move(data));
+}
+
+std::error_code process::close_stdin(bool send_pending)
+{
+    LUX_ASSERT(impl_, "Process implementation must not be null");
+    return impl_->close_stdin(send_pending);
+}
+
 } // namespace lux::proc
\ No newline at end of file
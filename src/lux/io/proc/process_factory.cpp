@@ -14,4 +14,11 @@ lux::proc::base::process_ptr process_factory::create_process(const std::string&
     return std::make_unique<lux::proc::process>(executor_, handler, exe_path);
 }
 
+lux::proc::base::process_ptr process_factory::create_process(const std::string& exe_path,
+                                                             const lux::proc::base::process_config& config,
+                                                             lux::proc::base::process_handler& handler)
+{
+    return std::make_unique<lux::proc::process>(executor_, handler, exe_path, config);
+}
+
 } // namespace lux::proc
\ No newline at end of file
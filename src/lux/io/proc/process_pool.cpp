@@ -0,0 +1,389 @@
+#include <lux/io/proc/process_pool.hpp>
+#include <lux/io/proc/base/process.hpp>
+#include <lux/io/proc/base/process_factory.hpp>
+#include <lux/io/time/retry_executor.hpp>
+
+#include <lux/support/assert.hpp>
+#include <lux/support/move.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <tuple>
+
+namespace lux::proc {
+
+namespace {
+
+constexpr std::size_t frame_header_size = 4; // 4-byte big-endian payload length
+
+std::array<std::byte, frame_header_size> encode_frame_header(std::uint32_t size)
+{
+    return {std::byte(size >> 24), std::byte(size >> 16), std::byte(size >> 8), std::byte(size)};
+}
+
+std::uint32_t decode_frame_header(const std::byte* data)
+{
+    return std::to_integer<std::uint32_t>(data[0]) << 24 | std::to_integer<std::uint32_t>(data[1]) << 16 |
+           std::to_integer<std::uint32_t>(data[2]) << 8 | std::to_integer<std::uint32_t>(data[3]);
+}
+
+} // namespace
+
+class process_pool::worker : public lux::proc::base::process_handler
+{
+public:
+    worker(process_pool& pool)
+        : pool_{pool},
+          restart_executor_{pool.timer_factory_, pool.config_.restart_policy},
+          rearm_timer_{pool.timer_factory_.create_interval_timer()}
+    {
+        restart_executor_.set_retry_action([this] { restart(); });
+        restart_executor_.set_exhausted_callback([this] { on_restarts_exhausted(); });
+
+        // Retrying from within the action would schedule the next attempt before the executor counted this one
+        rearm_timer_->set_handler([this] { restart_executor_.retry(); });
+    }
+
+public:
+    lux::status spawn()
+    {
+        lux::proc::base::process_config config{};
+        config.in.enabled = true;
+        config.out.buffer_size = pool_.config_.read_buffer_size;
+
+        auto process = pool_.process_factory_.create_process(pool_.exe_path_, config, *this);
+        if (auto status = process->start(pool_.config_.args); !status)
+        {
+            return status;
+        }
+
+        process_ = lux::move(process);
+        received_.clear();
+        terminating_ = false;
+        return lux::ok();
+    }
+
+    void stop()
+    {
+        rearm_timer_->cancel();
+        restart_executor_.cancel();
+        process_.reset();
+        received_.clear();
+        fail_job(std::make_error_code(std::errc::operation_canceled));
+    }
+
+    bool is_running() const
+    {
+        return process_ != nullptr;
+    }
+
+    bool is_idle() const
+    {
+        return process_ && !job_handler_;
+    }
+
+    bool is_lost() const
+    {
+        return !process_ && restart_executor_.is_retry_exhausted();
+    }
+
+    void dispatch(job j)
+    {
+        LUX_ASSERT(is_idle(), "Job can be dispatched only to an idle worker");
+
+        const auto header = encode_frame_header(static_cast<std::uint32_t>(j.payload.size()));
+        job_handler_ = lux::move(j.handler);
+
+        // The header is small and copied, the payload buffer is handed over to the process as is
+        auto ec = process_->write_stdin(header);
+        if (!ec && !j.payload.empty())
+        {
+            ec = process_->write_stdin(lux::move(j.payload));
+        }
+
+        if (ec)
+        {
+            // The worker can't take input anymore; its exit fails the job and restarts it
+            terminate();
+        }
+    }
+
+public:
+    // lux::proc::base::process_handler implementation
+    void on_process_error(const std::string& error_message) override
+    {
+        std::ignore = error_message;
+
+        // Broken pipes and the like - make sure the worker goes down, so it is restarted cleanly
+        terminate();
+    }
+
+    void on_process_exit(int exit_code, const lux::proc::base::process_usage& usage) override
+    {
+        std::ignore = exit_code;
+        std::ignore = usage;
+
+        // The output is delivered before the exit, so a worker that answered and then exited has a complete
+        // response buffered at most - it answers the job instead of failing it
+        complete_job();
+
+        process_.reset();
+        received_.clear();
+        fail_job(std::make_error_code(std::errc::io_error));
+
+        if (!pool_.running_)
+        {
+            return;
+        }
+
+        restart_executor_.retry();
+        if (restart_executor_.is_retry_exhausted())
+        {
+            pool_.on_worker_lost();
+        }
+    }
+
+    void on_process_stdout(std::string_view out) override
+    {
+        const auto* data = reinterpret_cast<const std::byte*>(out.data());
+        received_.insert(received_.end(), data, data + out.size());
+
+        while (process_ && complete_job())
+        {
+            pool_.dispatch_queued_jobs();
+        }
+    }
+
+    void on_process_stderr(std::string_view err) override
+    {
+        // Diagnostics of the worker are not part of the protocol
+        std::ignore = err;
+    }
+
+    void on_process_stdin_written(std::span<const std::byte> data) override
+    {
+        std::ignore = data;
+    }
+
+private:
+    void terminate()
+    {
+        // The exit notification fails the current job and restarts the worker
+        if (process_ && !terminating_)
+        {
+            terminating_ = true;
+            process_->terminate();
+        }
+    }
+
+    void restart()
+    {
+        if (!pool_.running_)
+        {
+            return;
+        }
+
+        if (spawn())
+        {
+            pool_.dispatch_queued_jobs();
+            return;
+        }
+
+        // The executor counts the failed attempt once this returns and reports the last one as exhausted
+        rearm_timer_->schedule(std::chrono::milliseconds::zero());
+    }
+
+    void on_restarts_exhausted()
+    {
+        // Also called when the executor is canceled on stop, which fails the jobs on its own
+        if (pool_.running_ && !process_)
+        {
+            pool_.on_worker_lost();
+        }
+    }
+
+    // Completes the current job with the first buffered response, returns false if there is none yet
+    bool complete_job()
+    {
+        if (received_.size() < frame_header_size)
+        {
+            return false;
+        }
+
+        const std::size_t size = decode_frame_header(received_.data());
+        if (size > pool_.config_.max_frame_size || !job_handler_)
+        {
+            // Oversized or unsolicited response - the worker doesn't speak the protocol
+            received_.clear();
+            terminate();
+            return false;
+        }
+
+        if (received_.size() < frame_header_size + size)
+        {
+            return false;
+        }
+
+        std::vector<std::byte> response(received_.begin() + frame_header_size,
+                                        received_.begin() + frame_header_size + size);
+        received_.erase(received_.begin(), received_.begin() + frame_header_size + size);
+
+        // The worker is healthy again, so the next crash starts the backoff from the beginning
+        restart_executor_.reset();
+
+        auto handler = lux::move(job_handler_);
+        job_handler_ = nullptr;
+        handler(lux::move(response));
+        return true;
+    }
+
+    void fail_job(std::error_code ec)
+    {
+        if (job_handler_)
+        {
+            auto handler = lux::move(job_handler_);
+            job_handler_ = nullptr;
+            handler(std::unexpected{ec});
+        }
+    }
+
+private:
+    process_pool& pool_;
+    lux::time::retry_executor restart_executor_;
+    lux::time::base::interval_timer_ptr rearm_timer_;
+    lux::proc::base::process_ptr process_;
+    job_handler job_handler_;
+    std::vector<std::byte> received_;
+    bool terminating_{false};
+};
+
+process_pool::process_pool(lux::time::base::timer_factory& timer_factory,
+                           lux::proc::base::process_factory& process_factory,
+                           const std::string& exe_path,
+                           const process_pool_config& config)
+    : timer_factory_{timer_factory}, process_factory_{process_factory}, exe_path_{exe_path}, config_{config}
+{
+    LUX_ASSERT(config_.size > 0, "Process pool size must be greater than zero");
+    LUX_ASSERT(config_.max_frame_size <= std::numeric_limits<std::uint32_t>::max(),
+               "Maximum frame size must fit the frame header");
+}
+
+process_pool::~process_pool()
+{
+    stop();
+}
+
+lux::status process_pool::start()
+{
+    if (running_)
+    {
+        return lux::ok();
+    }
+
+    workers_.clear();
+    workers_.reserve(config_.size);
+    running_ = true;
+
+    for (std::size_t i = 0; i < config_.size; ++i)
+    {
+        auto& w = *workers_.emplace_back(std::make_unique<worker>(*this));
+        if (auto status = w.spawn(); !status)
+        {
+            stop();
+            status.error().prepend(std::format("Failed to start process pool worker (index={})", i));
+            return status;
+        }
+    }
+
+    return lux::ok();
+}
+
+void process_pool::stop()
+{
+    running_ = false;
+
+    for (auto& w : workers_)
+    {
+        w->stop();
+    }
+
+    fail_queued_jobs(std::make_error_code(std::errc::operation_canceled));
+}
+
+std::error_code process_pool::submit(std::vector<std::byte> payload, job_handler handler)
+{
+    if (!running_ || std::ranges::all_of(workers_, [](const auto& w) { return w->is_lost(); }))
+    {
+        return std::make_error_code(std::errc::no_such_process);
+    }
+
+    if (payload.size() > std::numeric_limits<std::uint32_t>::max())
+    {
+        return std::make_error_code(std::errc::message_size);
+    }
+
+    queued_jobs_.push_back(job{lux::move(payload), lux::move(handler)});
+    dispatch_queued_jobs();
+    return {};
+}
+
+std::size_t process_pool::running_worker_count() const
+{
+    return static_cast<std::size_t>(std::ranges::count_if(workers_, [](const auto& w) { return w->is_running(); }));
+}
+
+std::size_t process_pool::idle_worker_count() const
+{
+    return static_cast<std::size_t>(std::ranges::count_if(workers_, [](const auto& w) { return w->is_idle(); }));
+}
+
+std::size_t process_pool::queued_job_count() const
+{
+    return queued_jobs_.size();
+}
+
+void process_pool::dispatch_queued_jobs()
+{
+    for (auto& w : workers_)
+    {
+        if (queued_jobs_.empty())
+        {
+            return;
+        }
+
+        if (w->is_idle())
+        {
+            auto j = lux::move(queued_jobs_.front());
+            queued_jobs_.pop_front();
+            w->dispatch(lux::move(j));
+        }
+    }
+}
+
+void process_pool::on_worker_lost()
+{
+    // Jobs would wait forever if no worker is ever going to come back
+    if (std::ranges::all_of(workers_, [](const auto& w) { return w->is_lost(); }))
+    {
+        fail_queued_jobs(std::make_error_code(std::errc::no_such_process));
+    }
+}
+
+void process_pool::fail_queued_jobs(std::error_code ec)
+{
+    auto jobs = lux::move(queued_jobs_);
+    queued_jobs_.clear();
+
+    for (auto& j : jobs)
+    {
+        j.handler(std::unexpected{ec});
+    }
+}
+
+} // namespace lux::proc
@@ -7,9 +7,16 @@
 
 namespace lux::time {
 
+namespace {
+
+// Jittered and budget-deferred attempts are always scheduled on the timer, never run inside retry()
+constexpr std::chrono::milliseconds min_deferred_delay{1};
+
+} // namespace
+
 retry_executor::retry_executor(lux::time::base::timer_factory& timer_factory,
                                const lux::time::base::retry_policy& policy)
-    : policy_{policy}, timer_{timer_factory.create_interval_timer()}
+    : policy_{policy}, timer_{timer_factory.create_interval_timer()}, random_engine_{std::random_device{}()}
 {
     timer_->set_handler([this]() { on_timer_expired(); });
 }
@@ -49,6 +56,7 @@ void retry_executor::reset()
     timer_->cancel();
     attempts_ = 0;
     canceled_ = false;
+    previous_delay_ = std::chrono::milliseconds::zero();
 }
 
 void retry_executor::cancel()
@@ -62,6 +70,7 @@ void retry_executor::cancel()
     }
 
     attempts_ = 0;
+    previous_delay_ = std::chrono::milliseconds::zero();
 }
 
 bool retry_executor::is_retry_exhausted() const
@@ -72,6 +81,25 @@ bool retry_executor::is_retry_exhausted() const
 
 void retry_executor::on_timer_expired()
 {
+    if (policy_.budget && !policy_.budget->try_acquire())
+    {
+        // The shared budget is exhausted - skip this attempt and back off further instead of adding to the load
+        ++attempts_;
+
+        if (is_retry_exhausted())
+        {
+            if (exhausted_callback_)
+            {
+                exhausted_callback_();
+            }
+            return;
+        }
+
+        // Never retry immediately here, a zero delay would spin until the budget is refilled
+        timer_->schedule(std::max(calculate_next_delay(), min_deferred_delay));
+        return;
+    }
+
     if (retry_action_)
     {
         retry_action_();
@@ -88,7 +116,7 @@ void retry_executor::on_timer_expired()
     }
 }
 
-std::chrono::milliseconds retry_executor::calculate_next_delay() const
+std::chrono::milliseconds retry_executor::calculate_next_delay()
 {
     switch (policy_.strategy)
     {
@@ -98,6 +126,10 @@ std::chrono::milliseconds retry_executor::calculate_next_delay() const
         return calculate_linear_backoff_delay();
     case lux::time::base::retry_policy::backoff_strategy::exponential_backoff:
         return calculate_exponential_backoff_delay();
+    case lux::time::base::retry_policy::backoff_strategy::full_jitter:
+        return calculate_full_jitter_delay();
+    case lux::time::base::retry_policy::backoff_strategy::decorrelated_jitter:
+        return calculate_decorrelated_jitter_delay();
     }
 
     LUX_UNREACHABLE();
@@ -135,8 +167,9 @@ std::chrono::milliseconds retry_executor::calculate_linear_backoff_delay() const
 
 std::chrono::milliseconds retry_executor::calculate_exponential_backoff_delay() const
 {
-    LUX_ASSERT(policy_.strategy == lux::time::base::retry_policy::backoff_strategy::exponential_backoff,
-               "This method should only be called for exponential backoff strategy");
+    LUX_ASSERT(policy_.strategy == lux::time::base::retry_policy::backoff_strategy::exponential_backoff ||
+                   policy_.strategy == lux::time::base::retry_policy::backoff_strategy::full_jitter,
+               "This method should only be called for exponential backoff or full jitter strategy");
 
     if (attempts_ == 0)
     {
@@ -174,4 +207,41 @@ std::chrono::milliseconds retry_executor::calculate_exponential_backoff_delay()
     return final_delay;
 }
 
+std::chrono::milliseconds retry_executor::calculate_full_jitter_delay()
+{
+    LUX_ASSERT(policy_.strategy == lux::time::base::retry_policy::backoff_strategy::full_jitter,
+               "This method should only be called for full jitter strategy");
+
+    return random_delay(min_deferred_delay, std::max(calculate_exponential_backoff_delay(), min_deferred_delay));
+}
+
+std::chrono::milliseconds retry_executor::calculate_decorrelated_jitter_delay()
+{
+    LUX_ASSERT(policy_.strategy == lux::time::base::retry_policy::backoff_strategy::decorrelated_jitter,
+               "This method should only be called for decorrelated jitter strategy");
+
+    const auto min_delay = std::max(std::min(policy_.base_delay, policy_.max_delay), min_deferred_delay);
+    if (previous_delay_ < min_delay)
+    {
+        // The first attempt is drawn like the others, seeded with the base delay, so clients don't retry in lockstep
+        previous_delay_ = min_delay;
+    }
+
+    // Upper bound is 3 * previous delay, computed without overflow and capped at max_delay
+    const auto upper_bound = previous_delay_ > policy_.max_delay / 3 ? policy_.max_delay : previous_delay_ * 3;
+    previous_delay_ = random_delay(min_delay, std::min(upper_bound, policy_.max_delay));
+    return previous_delay_;
+}
+
+std::chrono::milliseconds retry_executor::random_delay(std::chrono::milliseconds min, std::chrono::milliseconds max)
+{
+    if (max <= min)
+    {
+        return min;
+    }
+
+    std::uniform_int_distribution<std::chrono::milliseconds::rep> distribution{min.count(), max.count()};
+    return std::chrono::milliseconds{distribution(random_engine_)};
+}
+
 } // namespace lux::time
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include <lux/logger/binary_log.hpp>
+
+#include <lux/support/exception.hpp>
+
+#include <spdlog/common.h>
+
+#include <fmt/args.h>
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#include <ctime>
+#include <istream>
+
+namespace lux {
+
+namespace {
+
+template <typename T>
+T read_value(std::istream& stream)
+{
+    T value{};
+    if (!stream.read(reinterpret_cast<char*>(&value), sizeof(T)))
+    {
+        throw lux::formatted_exception("Truncated binary log record (expected {} bytes)", sizeof(T));
+    }
+    return value;
+}
+
+std::string read_string(std::istream& stream)
+{
+    const auto size = read_value<std::uint32_t>(stream);
+
+    std::string str(size, '\0');
+    if (!stream.read(str.data(), static_cast<std::streamsize>(size)))
+    {
+        throw lux::formatted_exception("Truncated binary log string (expected {} bytes)", size);
+    }
+    return str;
+}
+
+void read_argument(std::istream& stream, fmt::dynamic_format_arg_store<fmt::format_context>& store)
+{
+    const auto type = read_value<binary_log_arg_type>(stream);
+    switch (type)
+    {
+    case binary_log_arg_type::boolean:
+        store.push_back(read_value<std::uint8_t>(stream) != 0);
+        return;
+    case binary_log_arg_type::character:
+        store.push_back(read_value<char>(stream));
+        return;
+    case binary_log_arg_type::signed_integer:
+        store.push_back(read_value<std::int64_t>(stream));
+        return;
+    case binary_log_arg_type::unsigned_integer:
+        store.push_back(read_value<std::uint64_t>(stream));
+        return;
+    case binary_log_arg_type::floating_point:
+        store.push_back(read_value<double>(stream));
+        return;
+    case binary_log_arg_type::string:
+        store.push_back(read_string(stream));
+        return;
+    case binary_log_arg_type::pointer:
+        store.push_back(reinterpret_cast<const void*>(static_cast<std::uintptr_t>(read_value<std::uint64_t>(stream))));
+        return;
+    }
+
+    throw lux::formatted_exception("Unknown binary log argument type (type={})", static_cast<unsigned>(type));
+}
+
+} // namespace
+
+binary_log_sink::binary_log_sink(const std::string& filename, log_level level)
+    : stream_{filename, std::ios::binary | std::ios::trunc}, level_{level}
+{
+    if (!stream_)
+    {
+        throw lux::formatted_exception("Failed to open binary log file (filename={})", filename);
+    }
+
+    stream_.write(binary_log_magic.data(), static_cast<std::streamsize>(binary_log_magic.size()));
+    stream_.write(reinterpret_cast<const char*>(&binary_log_version), sizeof(binary_log_version));
+}
+
+binary_log_sink::~binary_log_sink()
+{
+    flush();
+}
+
+void binary_log_sink::register_logger(std::uint32_t logger_id, std::string_view name)
+{
+    std::lock_guard lock{mutex_};
+
+    record_buffer_.clear();
+    detail::binary_log_encoder encoder{record_buffer_};
+    encoder.write(binary_log_record_type::logger);
+    encoder.write(logger_id);
+    encoder.write_string(name);
+
+    stream_.write(reinterpret_cast<const char*>(record_buffer_.data()),
+                  static_cast<std::streamsize>(record_buffer_.size()));
+}
+
+void binary_log_sink::flush()
+{
+    std::lock_guard lock{mutex_};
+    stream_.flush();
+}
+
+void binary_log_sink::write_event(std::uint32_t logger_id,
+                                  log_level level,
+                                  std::string_view format,
+                                  std::uint8_t arg_count,
+                                  std::span<const std::byte> args)
+{
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::system_clock::now().time_since_epoch())
+                               .count();
+    const auto format_id = detail::binary_log_format_id(format);
+
+    std::lock_guard lock{mutex_};
+
+    record_buffer_.clear();
+    detail::binary_log_encoder encoder{record_buffer_};
+
+    if (known_formats_.insert(format_id).second)
+    {
+        encoder.write(binary_log_record_type::format);
+        encoder.write(format_id);
+        encoder.write_string(format);
+    }
+
+    encoder.write(binary_log_record_type::event);
+    encoder.write(static_cast<std::uint64_t>(timestamp));
+    encoder.write(static_cast<std::uint8_t>(level));
+    encoder.write(logger_id);
+    encoder.write(format_id);
+    encoder.write(arg_count);
+
+    stream_.write(reinterpret_cast<const char*>(record_buffer_.data()),
+                  static_cast<std::streamsize>(record_buffer_.size()));
+    stream_.write(reinterpret_cast<const char*>(args.data()), static_cast<std::streamsize>(args.size()));
+}
+
+binary_log_reader::binary_log_reader(std::istream& stream) : stream_{stream}
+{
+    char magic[4]{};
+    if (!stream_.read(magic, sizeof(magic)) || std::string_view{magic, sizeof(magic)} != binary_log_magic)
+    {
+        throw lux::formatted_exception("Not a binary log stream");
+    }
+
+    const auto version = read_value<std::uint16_t>(stream_);
+    if (version != binary_log_version)
+    {
+        throw lux::formatted_exception("Unsupported binary log version (version={})", version);
+    }
+}
+
+std::optional<binary_log_record> binary_log_reader::next()
+{
+    while (true)
+    {
+        binary_log_record_type type{};
+        if (!stream_.read(reinterpret_cast<char*>(&type), sizeof(type)))
+        {
+            return std::nullopt;
+        }
+
+        switch (type)
+        {
+        case binary_log_record_type::logger: {
+            const auto logger_id = read_value<std::uint32_t>(stream_);
+            loggers_[logger_id] = read_string(stream_);
+            break;
+        }
+        case binary_log_record_type::format: {
+            const auto format_id = read_value<std::uint64_t>(stream_);
+            formats_[format_id] = read_string(stream_);
+            break;
+        }
+        case binary_log_record_type::event: {
+            const auto timestamp = read_value<std::uint64_t>(stream_);
+            const auto level = read_value<std::uint8_t>(stream_);
+            const auto logger_id = read_value<std::uint32_t>(stream_);
+            const auto format_id = read_value<std::uint64_t>(stream_);
+            const auto arg_count = read_value<std::uint8_t>(stream_);
+
+            fmt::dynamic_format_arg_store<fmt::format_context> store;
+            store.reserve(arg_count, arg_count);
+            for (std::uint8_t i = 0; i < arg_count; ++i)
+            {
+                read_argument(stream_, store);
+            }
+
+            const auto format_it = formats_.find(format_id);
+            if (format_it == formats_.end())
+            {
+                throw lux::formatted_exception("Binary log event references unknown format (format_id={})", format_id);
+            }
+
+            const auto logger_it = loggers_.find(logger_id);
+            if (logger_it == loggers_.end())
+            {
+                throw lux::formatted_exception("Binary log event references unknown logger (logger_id={})", logger_id);
+            }
+
+            binary_log_record record;
+            record.timestamp = std::chrono::system_clock::time_point{
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{timestamp})};
+            record.level = static_cast<log_level>(level);
+            record.logger_name = logger_it->second;
+
+            try
+            {
+                record.message = fmt::vformat(format_it->second, store);
+            }
+            catch (const fmt::format_error& e)
+            {
+                // Keep the raw format string so a bad specifier does not hide the event
+                record.message = fmt::format("{} [format error: {}]", format_it->second, e.what());
+            }
+
+            return record;
+        }
+        default:
+            throw lux::formatted_exception("Unknown binary log record type (type={})", static_cast<unsigned>(type));
+        }
+    }
+}
+
+std::string to_string(const binary_log_record& record)
+{
+    const auto time = std::chrono::system_clock::to_time_t(record.timestamp);
+    const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(record.timestamp.time_since_epoch()) %
+                        1000;
+
+    std::tm local_time{};
+#ifdef _WIN32
+    localtime_s(&local_time, &time);
+#else
+    localtime_r(&time, &local_time);
+#endif
+
+    const auto level_name = spdlog::level::to_string_view(detail::to_spdlog_level(record.level));
+    return fmt::format("{:%Y-%m-%d %H:%M:%S}.{:03} [{}] <{}> {}",
+                       local_time,
+                       millis.count(),
+                       std::string_view{level_name.data(), level_name.size()},
+                       record.logger_name,
+                       record.message);
+}
+
+} // namespace lux
@@ -15,6 +15,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 
 namespace lux {
 
@@ -32,6 +34,18 @@ logger& logger_manager::get_logger(const char* name)
 {
     LUX_ASSERT(name, "Logger name must not be null");
 
+    {
+        std::shared_lock lock{*loggers_mutex_};
+        auto it = loggers_.find(name);
+        if (it != loggers_.end())
+        {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock{*loggers_mutex_};
+
+    // Another thread may have created the logger between the shared and the exclusive lock
     auto it = loggers_.find(name);
     if (it != loggers_.end())
     {
@@ -44,8 +58,16 @@ logger& logger_manager::get_logger(const char* name)
     // Set the logger's level to the minimum level of all sinks so it doesn't log more than necessary.
     spd_logger->set_level(min_log_level_);
 
-    // return reference to the new logger
-    return loggers_.emplace(name, spd_logger).first->second;
+    if (!binary_sink_)
+    {
+        // return reference to the new logger
+        return loggers_.emplace(name, spd_logger).first->second;
+    }
+
+    // Binary events reference the logger by id, the name is stored once in the log file
+    const auto id = static_cast<std::uint32_t>(loggers_.size());
+    binary_sink_->register_logger(id, name);
+    return loggers_.emplace(name, logger{spd_logger, binary_sink_, id}).first->second;
 }
 
 void logger_manager::configure_sinks(const log_config& config)
@@ -65,6 +87,11 @@ void logger_manager::configure_sinks(const log_config& config)
         configure_ostream_sink(*config.ostream);
     }
 
+    if (config.binary)
+    {
+        configure_binary_sink(*config.binary);
+    }
+
     // Set the minimum log level across all sinks
     if (!sinks_.empty())
     {
@@ -142,4 +169,10 @@ void logger_manager::configure_daily_file_sink(const daily_file_log_config& conf
     sinks_.push_back(lux::move(daily_sink));
 }
 
+void logger_manager::configure_binary_sink(const binary_log_config& config)
+{
+    // Not an spdlog sink: the logger writes binary events directly so no text is formatted for it
+    binary_sink_ = std::make_shared<binary_log_sink>(config.filename, config.level);
+}
+
 } // namespace lux
@@ -0,0 +1,155 @@
+#include <lux/utils/random_bytes.hpp>
+
+#include <lux/support/exception.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <system_error>
+
+#ifdef _WIN32
+#include <Windows.h>
+
+#include <bcrypt.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sys/random.h>
+
+#include <cerrno>
+#else
+#include <pthread.h>
+#include <stdlib.h>
+#endif
+
+namespace lux {
+
+namespace {
+
+// Large enough to amortize the system call over many nonces, small enough to keep per-thread memory low
+constexpr std::size_t pool_size = 4096;
+
+// Requests above this size are served directly by the operating system
+constexpr std::size_t max_pooled_request = pool_size / 4;
+
+void os_random_bytes(std::span<std::byte> buffer)
+{
+#ifdef _WIN32
+    while (!buffer.empty())
+    {
+        const auto size = static_cast<ULONG>(std::min<std::size_t>(buffer.size(), MAXULONG));
+        const auto status = BCryptGenRandom(nullptr,
+                                            reinterpret_cast<PUCHAR>(buffer.data()),
+                                            size,
+                                            BCRYPT_USE_SYSTEM_PREFERRED_RNG);
+        if (!BCRYPT_SUCCESS(status))
+        {
+            throw lux::formatted_exception("Failed to generate random bytes: NTSTATUS {:#x}",
+                                           static_cast<unsigned long>(status));
+        }
+        buffer = buffer.subspan(size);
+    }
+#elif defined(__linux__)
+    while (!buffer.empty())
+    {
+        const auto result = ::getrandom(buffer.data(), buffer.size(), 0);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            throw lux::formatted_exception("Failed to generate random bytes: {}",
+                                           std::error_code{errno, std::system_category()}.message());
+        }
+        buffer = buffer.subspan(static_cast<std::size_t>(result));
+    }
+#else
+    ::arc4random_buf(buffer.data(), buffer.size());
+#endif
+}
+
+// Incremented in the child process after fork, so the child doesn't reuse bytes already buffered by the parent
+std::atomic<unsigned> fork_generation{0};
+
+void register_fork_handler()
+{
+#ifndef _WIN32
+    static const bool registered = [] {
+        ::pthread_atfork(nullptr, nullptr, [] { fork_generation.fetch_add(1, std::memory_order_relaxed); });
+        return true;
+    }();
+    static_cast<void>(registered);
+#endif
+}
+
+class random_pool
+{
+public:
+    void take(std::span<std::byte> buffer)
+    {
+        const auto generation = fork_generation.load(std::memory_order_relaxed);
+        if (generation != generation_)
+        {
+            std::memset(data_.data(), 0, available_);
+            available_ = 0;
+            generation_ = generation;
+        }
+
+        if (available_ < buffer.size())
+        {
+            refill();
+        }
+
+        // Hand out bytes from the end of the available range and wipe them, so they can't be handed out or
+        // recovered again
+        available_ -= buffer.size();
+        std::memcpy(buffer.data(), data_.data() + available_, buffer.size());
+        std::memset(data_.data() + available_, 0, buffer.size());
+    }
+
+private:
+    void refill()
+    {
+        register_fork_handler();
+
+        // Anything left over is too small for the request; generate a full pool instead of splitting it
+        os_random_bytes(data_);
+        available_ = data_.size();
+    }
+
+private:
+    std::array<std::byte, pool_size> data_{};
+    std::size_t available_{0};
+    unsigned generation_{0};
+};
+
+thread_local random_pool pool;
+
+} // namespace
+
+void fill_random_bytes(std::span<std::byte> buffer)
+{
+    if (buffer.empty())
+    {
+        return;
+    }
+
+    if (buffer.size() > max_pooled_request)
+    {
+        os_random_bytes(buffer);
+        return;
+    }
+
+    pool.take(buffer);
+}
+
+std::vector<std::byte> random_bytes(std::size_t count)
+{
+    std::vector<std::byte> result(count);
+    lux::fill_random_bytes(result);
+    return result;
+}
+
+} // namespace lux
@@ -0,0 +1,159 @@
+#include <lux/crypto/aead.hpp>
+#include <lux/utils/buffer_writer.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <openssl/err.h>
+
+#include "test_case.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+std::span<const std::byte> as_bytes(std::string_view str)
+{
+    return std::as_bytes(std::span{str.data(), str.size()});
+}
+
+std::vector<std::byte> make_key(lux::crypto::aead_algorithm algorithm)
+{
+    std::vector<std::byte> key(lux::crypto::aead_key_size(algorithm));
+    for (std::size_t i = 0; i < key.size(); ++i)
+    {
+        key[i] = static_cast<std::byte>(i);
+    }
+    return key;
+}
+
+} // namespace
+
+LUX_TEST_CASE("aead_cipher", "seals and opens messages in place", "[crypto][aead]")
+{
+    const auto algorithm = GENERATE(lux::crypto::aead_algorithm::aes_128_gcm,
+                                    lux::crypto::aead_algorithm::aes_256_gcm,
+                                    lux::crypto::aead_algorithm::chacha20_poly1305);
+
+    auto cipher = lux::crypto::make_aead_cipher(algorithm, make_key(algorithm));
+    REQUIRE(cipher.has_value());
+
+    const lux::crypto::aead_nonce nonce{std::byte{1}, std::byte{2}, std::byte{3}};
+    const auto aad = as_bytes("header");
+    const auto plaintext = as_bytes("attack at dawn");
+
+    std::vector<std::byte> data(plaintext.begin(), plaintext.end());
+    std::array<std::byte, lux::crypto::aead_tag_size> tag{};
+    REQUIRE(cipher->seal(nonce, aad, data, tag));
+    CHECK_FALSE(std::ranges::equal(data, plaintext));
+
+    SECTION("Round-trip restores the plaintext")
+    {
+        REQUIRE(cipher->open(nonce, aad, data, tag));
+        CHECK(std::ranges::equal(data, plaintext));
+    }
+
+    SECTION("Sealing is repeatable with the reused contexts")
+    {
+        std::vector<std::byte> again(plaintext.begin(), plaintext.end());
+        std::array<std::byte, lux::crypto::aead_tag_size> again_tag{};
+        REQUIRE(cipher->seal(nonce, aad, again, again_tag));
+        CHECK(again == data);
+        CHECK(again_tag == tag);
+    }
+
+    SECTION("Tampered ciphertext is rejected and wiped")
+    {
+        data[0] ^= std::byte{0x01};
+        CHECK_FALSE(cipher->open(nonce, aad, data, tag));
+        CHECK(std::ranges::all_of(data, [](std::byte b) { return b == std::byte{0}; }));
+        CHECK(ERR_peek_error() == 0);
+
+        // The cipher stays usable after a failure
+        std::vector<std::byte> other(plaintext.begin(), plaintext.end());
+        REQUIRE(cipher->seal(nonce, aad, other, tag));
+        REQUIRE(cipher->open(nonce, aad, other, tag));
+        CHECK(std::ranges::equal(other, plaintext));
+    }
+
+    SECTION("Tampered associated data is rejected")
+    {
+        CHECK_FALSE(cipher->open(nonce, as_bytes("headex"), data, tag));
+    }
+
+    SECTION("Different nonce is rejected")
+    {
+        auto other_nonce = nonce;
+        other_nonce[11] = std::byte{1};
+        CHECK_FALSE(cipher->open(other_nonce, aad, data, tag));
+    }
+
+    SECTION("Invalid sizes are rejected")
+    {
+        CHECK_FALSE(cipher->seal(std::span{nonce}.first(8), aad, data, tag));
+        CHECK_FALSE(cipher->seal(nonce, aad, data, std::span{tag}.first(8)));
+    }
+}
+
+LUX_TEST_CASE("aead_cipher", "matches a reference vector", "[crypto][aead]")
+{
+    // NIST GCM test case 2: zero key, zero nonce, 16 zero bytes
+    const std::vector<std::byte> key(16);
+    auto cipher = lux::crypto::make_aead_cipher(lux::crypto::aead_algorithm::aes_128_gcm, key);
+    REQUIRE(cipher.has_value());
+
+    std::array<std::byte, 16 + lux::crypto::aead_tag_size> message{};
+    REQUIRE(cipher->seal(lux::crypto::aead_nonce{}, {}, message));
+
+    constexpr std::array<unsigned char, 32> expected{0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2,
+                                                     0xb9, 0x71, 0xb2, 0xfe, 0x78, 0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec,
+                                                     0x13, 0xbd, 0xf5, 0x3a, 0x67, 0xb2, 0x12, 0x57, 0xbd, 0xdf};
+    CHECK(std::ranges::equal(message, std::as_bytes(std::span{expected})));
+}
+
+LUX_TEST_CASE("aead_cipher", "seals messages written by buffer_writer", "[crypto][aead]")
+{
+    const auto algorithm = lux::crypto::aead_algorithm::chacha20_poly1305;
+    auto cipher = lux::crypto::make_aead_cipher(algorithm, make_key(algorithm));
+    REQUIRE(cipher.has_value());
+
+    const lux::crypto::aead_nonce nonce{std::byte{7}};
+
+    std::array<std::byte, 64> buffer{};
+    lux::buffer_writer writer{buffer};
+    writer << std::uint32_t{42} << "payload";
+    writer.skip(lux::crypto::aead_tag_size);
+
+    const auto message = std::span{buffer}.first(writer.position());
+    REQUIRE(cipher->seal(nonce, {}, message));
+
+    SECTION("Open returns the payload within the message")
+    {
+        const auto payload = cipher->open(nonce, {}, message);
+        REQUIRE(payload.has_value());
+        CHECK(payload->data() == buffer.data());
+        CHECK(payload->size() == sizeof(std::uint32_t) + 7);
+        CHECK(std::ranges::equal(payload->subspan(sizeof(std::uint32_t)), as_bytes("payload")));
+    }
+
+    SECTION("Tampered tag is rejected")
+    {
+        message.back() ^= std::byte{0x80};
+        CHECK_FALSE(cipher->open(nonce, {}, message).has_value());
+    }
+
+    SECTION("Message shorter than the tag is rejected")
+    {
+        CHECK_FALSE(cipher->open(nonce, {}, message.first(lux::crypto::aead_tag_size - 1)).has_value());
+    }
+}
+
+LUX_TEST_CASE("aead_cipher", "rejects keys of the wrong size", "[crypto][aead]")
+{
+    const std::vector<std::byte> key(16);
+    CHECK_FALSE(lux::crypto::make_aead_cipher(lux::crypto::aead_algorithm::aes_256_gcm, key).has_value());
+}
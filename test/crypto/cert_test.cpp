@@ -1,8 +1,18 @@
 #include <lux/crypto/cert.hpp>
 #include <lux/crypto/key.hpp>
+#include <lux/support/move.hpp>
 
 #include <catch2/catch_all.hpp>
 
+#include <openssl/evp.h>
+#include <openssl/x509.h>
+#include <openssl/x509v3.h>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "test_case.hpp"
 
 LUX_TEST_CASE("generate_csr", "generates CSR successfully with basic subject info", "[crypto][cert][csr]")
@@ -150,3 +160,173 @@ LUX_TEST_CASE("csr_pem", "converts CSR with SANs to PEM successfully", "[crypto]
     CHECK(csr_pem_result->get().find("-----BEGIN CERTIFICATE REQUEST-----") != std::string::npos);
     CHECK(csr_pem_result->get().find("-----END CERTIFICATE REQUEST-----") != std::string::npos);
 }
+
+namespace {
+
+using x509_ptr = std::unique_ptr<X509, decltype(&X509_free)>;
+
+lux::crypto::subject_info make_subject(std::string common_name)
+{
+    lux::crypto::subject_info subject{};
+    subject.common_name = lux::move(common_name);
+    return subject;
+}
+
+x509_ptr parse_cert(const lux::crypto::cert_der& der)
+{
+    const unsigned char* der_ptr{reinterpret_cast<const unsigned char*>(der.get().data())};
+    return x509_ptr{d2i_X509(nullptr, &der_ptr, static_cast<long>(der.get().size())), &X509_free};
+}
+
+bool verifies_against(const lux::crypto::cert_der& leaf, const lux::crypto::cert_der& ca)
+{
+    const auto leaf_x509 = parse_cert(leaf);
+    const auto ca_x509 = parse_cert(ca);
+    REQUIRE(leaf_x509);
+    REQUIRE(ca_x509);
+
+    std::unique_ptr<X509_STORE, decltype(&X509_STORE_free)> store{X509_STORE_new(), &X509_STORE_free};
+    std::unique_ptr<X509_STORE_CTX, decltype(&X509_STORE_CTX_free)> ctx{X509_STORE_CTX_new(), &X509_STORE_CTX_free};
+    REQUIRE(X509_STORE_add_cert(store.get(), ca_x509.get()) == 1);
+    REQUIRE(X509_STORE_CTX_init(ctx.get(), store.get(), leaf_x509.get(), nullptr) == 1);
+    return X509_verify_cert(ctx.get()) == 1;
+}
+
+} // namespace
+
+LUX_TEST_CASE("generate_self_signed_cert", "generates self-signed certificate", "[crypto][cert]")
+{
+    const auto private_key{lux::crypto::generate_ed25519_private_key()};
+    REQUIRE(private_key.has_value());
+
+    auto subject = make_subject("localhost");
+    subject.subject_alt_names = {"localhost", "127.0.0.1", "::1"};
+
+    const auto cert{lux::crypto::generate_self_signed_cert(*private_key, subject)};
+    REQUIRE(cert.has_value());
+
+    SECTION("Certificate verifies against itself")
+    {
+        CHECK(verifies_against(*cert, *cert));
+    }
+
+    SECTION("Subject alternative names are encoded by type")
+    {
+        const auto x509 = parse_cert(*cert);
+        REQUIRE(x509);
+        CHECK(X509_check_host(x509.get(), "localhost", 0, 0, nullptr) == 1);
+        CHECK(X509_check_ip_asc(x509.get(), "127.0.0.1", 0) == 1);
+        CHECK(X509_check_ip_asc(x509.get(), "::1", 0) == 1);
+        CHECK(X509_check_host(x509.get(), "example.com", 0, 0, nullptr) == 0);
+    }
+
+    SECTION("Converts to PEM")
+    {
+        const auto pem{lux::crypto::to_pem(*cert)};
+        REQUIRE(pem.has_value());
+        CHECK(pem->get().starts_with("-----BEGIN CERTIFICATE-----"));
+        CHECK(pem->get().find("-----END CERTIFICATE-----") != std::string::npos);
+    }
+
+    SECTION("Is not a CA unless requested")
+    {
+        const auto x509 = parse_cert(*cert);
+        REQUIRE(x509);
+        CHECK(X509_check_ca(x509.get()) == 0);
+
+        const auto ca_cert{lux::crypto::generate_self_signed_cert(*private_key, subject, {.is_ca = true})};
+        REQUIRE(ca_cert.has_value());
+        const auto ca_x509 = parse_cert(*ca_cert);
+        REQUIRE(ca_x509);
+        CHECK(X509_check_ca(ca_x509.get()) == 1);
+    }
+}
+
+LUX_TEST_CASE("issue_cert", "issues certificate signed by the issuer", "[crypto][cert]")
+{
+    const auto ca_key{lux::crypto::generate_ed25519_private_key()};
+    const auto leaf_key{lux::crypto::generate_ed25519_private_key()};
+    REQUIRE(ca_key.has_value());
+    REQUIRE(leaf_key.has_value());
+
+    const auto ca_cert{lux::crypto::generate_self_signed_cert(*ca_key, make_subject("Test CA"), {.is_ca = true})};
+    REQUIRE(ca_cert.has_value());
+
+    const auto leaf_public_key{lux::crypto::derive_public_key(*leaf_key)};
+    REQUIRE(leaf_public_key.has_value());
+
+    const auto leaf_cert{
+        lux::crypto::issue_cert(*leaf_public_key, make_subject("leaf.example.com"), *ca_key, *ca_cert)};
+    REQUIRE(leaf_cert.has_value());
+
+    SECTION("Leaf verifies against the issuer")
+    {
+        CHECK(verifies_against(*leaf_cert, *ca_cert));
+    }
+
+    SECTION("Leaf does not verify against another CA")
+    {
+        const auto other_key{lux::crypto::generate_ed25519_private_key()};
+        REQUIRE(other_key.has_value());
+        const auto other_ca{
+            lux::crypto::generate_self_signed_cert(*other_key, make_subject("Test CA"), {.is_ca = true})};
+        REQUIRE(other_ca.has_value());
+
+        CHECK_FALSE(verifies_against(*leaf_cert, *other_ca));
+    }
+
+    SECTION("Fails with malformed issuer certificate")
+    {
+        const lux::crypto::cert_der malformed{std::vector<std::byte>{std::byte{0x30}, std::byte{0x01}}};
+        CHECK_FALSE(lux::crypto::issue_cert(*leaf_public_key, make_subject("leaf"), *ca_key, malformed).has_value());
+    }
+}
+
+LUX_TEST_CASE("certificate_authority", "issues leaf certificates with fresh keys", "[crypto][cert]")
+{
+    const auto ca{lux::crypto::make_certificate_authority(make_subject("Test CA"))};
+    REQUIRE(ca.has_value());
+
+    auto subject = make_subject("localhost");
+    subject.subject_alt_names = {"localhost", "127.0.0.1"};
+
+    const auto leaf1{ca->issue(subject)};
+    const auto leaf2{ca->issue(subject)};
+    REQUIRE(leaf1.has_value());
+    REQUIRE(leaf2.has_value());
+
+    SECTION("Leaves verify against the CA")
+    {
+        CHECK(verifies_against(leaf1->cert, ca->cert()));
+        CHECK(verifies_against(leaf2->cert, ca->cert()));
+    }
+
+    SECTION("Leaves have distinct keys and certificates")
+    {
+        CHECK(leaf1->private_key.data != leaf2->private_key.data);
+        CHECK(leaf1->cert.get() != leaf2->cert.get());
+    }
+
+    SECTION("Leaf certificate matches its private key")
+    {
+        const auto x509 = parse_cert(leaf1->cert);
+        REQUIRE(x509);
+        const auto public_key{lux::crypto::derive_public_key(leaf1->private_key)};
+        REQUIRE(public_key.has_value());
+
+        std::array<std::byte, lux::crypto::ed25519_public_key::size> cert_public_key{};
+        std::size_t len{cert_public_key.size()};
+        REQUIRE(EVP_PKEY_get_raw_public_key(X509_get0_pubkey(x509.get()),
+                                            reinterpret_cast<unsigned char*>(cert_public_key.data()),
+                                            &len) == 1);
+        CHECK(cert_public_key == public_key->data);
+    }
+
+    SECTION("Copies share the CA")
+    {
+        const auto copy = *ca;
+        const auto leaf{copy.issue(subject)};
+        REQUIRE(leaf.has_value());
+        CHECK(verifies_against(leaf->cert, ca->cert()));
+    }
+}
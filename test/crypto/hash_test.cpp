@@ -0,0 +1,233 @@
+#include <lux/crypto/hash.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include "test_case.hpp"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+std::span<const std::byte> as_bytes(std::string_view str)
+{
+    return std::as_bytes(std::span{str.data(), str.size()});
+}
+
+std::string to_hex(const lux::crypto::digest& digest)
+{
+    static constexpr std::string_view digits{"0123456789abcdef"};
+
+    std::string result;
+    for (const auto byte : digest.bytes())
+    {
+        result.push_back(digits[std::to_integer<unsigned>(byte) >> 4]);
+        result.push_back(digits[std::to_integer<unsigned>(byte) & 0x0F]);
+    }
+    return result;
+}
+
+} // namespace
+
+LUX_TEST_CASE("hash", "computes digests of known messages", "[crypto][hash]")
+{
+    using lux::crypto::hash_algorithm;
+
+    SECTION("SHA-256")
+    {
+        const auto digest = lux::crypto::hash(hash_algorithm::sha256, as_bytes("abc"));
+        REQUIRE(digest.has_value());
+        CHECK(digest->size == lux::crypto::digest_size(hash_algorithm::sha256));
+        CHECK(to_hex(*digest) == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    }
+
+    SECTION("SHA-512")
+    {
+        const auto digest = lux::crypto::hash(hash_algorithm::sha512, as_bytes("abc"));
+        REQUIRE(digest.has_value());
+        CHECK(to_hex(*digest) ==
+              "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd"
+              "454d4423643ce80e2a9ac94fa54ca49f");
+    }
+
+#ifdef OPENSSL_IS_BORINGSSL
+    SECTION("BLAKE2b-256")
+    {
+        const auto digest = lux::crypto::hash(hash_algorithm::blake2b256, as_bytes("abc"));
+        REQUIRE(digest.has_value());
+        CHECK(digest->size == lux::crypto::digest_size(hash_algorithm::blake2b256));
+        CHECK(to_hex(*digest) == "bddd813c634239723171ef3fee98579b94964e3bb1cb3e427262c8c068d52319");
+    }
+#else
+    SECTION("BLAKE2s-256")
+    {
+        const auto digest = lux::crypto::hash(hash_algorithm::blake2s256, as_bytes("abc"));
+        REQUIRE(digest.has_value());
+        CHECK(to_hex(*digest) == "508c5e8c327c14e2e1a72ba34eeb452f37458b209ed63a294d999b4c86675982");
+    }
+
+    SECTION("BLAKE2b-512")
+    {
+        const auto digest = lux::crypto::hash(hash_algorithm::blake2b512, as_bytes("abc"));
+        REQUIRE(digest.has_value());
+        CHECK(digest->size == lux::crypto::digest_size(hash_algorithm::blake2b512));
+        CHECK(to_hex(*digest) ==
+              "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d17d87c5392aab792dc252d5de4533cc95"
+              "18d38aa8dbf1925ab92386edd4009923");
+    }
+#endif
+}
+
+LUX_TEST_CASE("hasher", "hashes messages incrementally", "[crypto][hash]")
+{
+    auto hasher = lux::crypto::make_hasher(lux::crypto::hash_algorithm::sha256);
+    REQUIRE(hasher.has_value());
+
+    SECTION("Split message gives the same digest")
+    {
+        REQUIRE(hasher->update("a"));
+        REQUIRE(hasher->update(as_bytes("b")));
+        REQUIRE(hasher->update("c"));
+
+        const auto digest = hasher->final();
+        REQUIRE(digest.has_value());
+        CHECK(*digest == *lux::crypto::hash(lux::crypto::hash_algorithm::sha256, as_bytes("abc")));
+    }
+
+    SECTION("Final starts a new message")
+    {
+        REQUIRE(hasher->update("abc"));
+        const auto first = hasher->final();
+
+        REQUIRE(hasher->update("abc"));
+        const auto second = hasher->final();
+
+        const auto empty = hasher->final();
+
+        REQUIRE(first.has_value());
+        REQUIRE(second.has_value());
+        REQUIRE(empty.has_value());
+        CHECK(*first == *second);
+        CHECK(to_hex(*empty) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    }
+
+    SECTION("Hashers are independent")
+    {
+        auto other = lux::crypto::make_hasher(lux::crypto::hash_algorithm::sha256);
+        REQUIRE(other.has_value());
+
+        REQUIRE(hasher->update("abc"));
+        REQUIRE(other->update("xyz"));
+
+        const auto digest1 = hasher->final();
+        const auto digest2 = other->final();
+        REQUIRE(digest1.has_value());
+        REQUIRE(digest2.has_value());
+        CHECK(*digest1 != *digest2);
+    }
+}
+
+LUX_TEST_CASE("hmac", "computes MACs with a fixed key", "[crypto][hash][hmac]")
+{
+    // RFC 4231, test case 2
+    auto hmac = lux::crypto::make_hmac(lux::crypto::hash_algorithm::sha256, as_bytes("Jefe"));
+    REQUIRE(hmac.has_value());
+
+    SECTION("Matches the reference value")
+    {
+        REQUIRE(hmac->update("what do ya want "));
+        REQUIRE(hmac->update("for nothing?"));
+
+        const auto mac = hmac->final();
+        REQUIRE(mac.has_value());
+        CHECK(to_hex(*mac) == "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843");
+    }
+
+    SECTION("Final starts a new message with the same key")
+    {
+        REQUIRE(hmac->update("what do ya want for nothing?"));
+        const auto first = hmac->final();
+
+        REQUIRE(hmac->update("what do ya want for nothing?"));
+        const auto second = hmac->final();
+
+        REQUIRE(first.has_value());
+        REQUIRE(second.has_value());
+        CHECK(lux::crypto::constant_time_equal(first->bytes(), second->bytes()));
+    }
+
+    SECTION("Different key gives a different MAC")
+    {
+        auto other = lux::crypto::make_hmac(lux::crypto::hash_algorithm::sha256, as_bytes("Jeff"));
+        REQUIRE(other.has_value());
+
+        REQUIRE(hmac->update("message"));
+        REQUIRE(other->update("message"));
+
+        const auto mac1 = hmac->final();
+        const auto mac2 = other->final();
+        REQUIRE(mac1.has_value());
+        REQUIRE(mac2.has_value());
+        CHECK_FALSE(lux::crypto::constant_time_equal(mac1->bytes(), mac2->bytes()));
+    }
+
+    SECTION("Works with BLAKE2")
+    {
+#ifdef OPENSSL_IS_BORINGSSL
+        constexpr auto algorithm = lux::crypto::hash_algorithm::blake2b256;
+#else
+        constexpr auto algorithm = lux::crypto::hash_algorithm::blake2b512;
+#endif
+        auto blake = lux::crypto::make_hmac(algorithm, as_bytes("key"));
+        REQUIRE(blake.has_value());
+        REQUIRE(blake->update("message"));
+
+        const auto mac = blake->final();
+        REQUIRE(mac.has_value());
+        CHECK(mac->size == lux::crypto::digest_size(algorithm));
+    }
+}
+
+LUX_TEST_CASE("hash", "fails for algorithms the crypto library lacks", "[crypto][hash]")
+{
+#ifdef OPENSSL_IS_BORINGSSL
+    constexpr auto algorithm = lux::crypto::hash_algorithm::blake2s256;
+#else
+    constexpr auto algorithm = lux::crypto::hash_algorithm::blake2b256;
+#endif
+
+    CHECK_FALSE(lux::crypto::hash(algorithm, as_bytes("abc")).has_value());
+    CHECK_FALSE(lux::crypto::make_hasher(algorithm).has_value());
+    CHECK_FALSE(lux::crypto::make_hmac(algorithm, as_bytes("key")).has_value());
+}
+
+LUX_TEST_CASE("hash", "hashes many messages at once", "[crypto][hash]")
+{
+    const std::vector<std::string> texts{"", "a", "abc", std::string(1000, 'x')};
+
+    std::vector<std::span<const std::byte>> messages;
+    for (const auto& text : texts)
+    {
+        messages.push_back(as_bytes(text));
+    }
+
+    std::vector<lux::crypto::digest> digests(messages.size());
+    REQUIRE(lux::crypto::hash_many(lux::crypto::hash_algorithm::sha512, messages, digests));
+
+    for (std::size_t i = 0; i < messages.size(); ++i)
+    {
+        CHECK(digests[i] == *lux::crypto::hash(lux::crypto::hash_algorithm::sha512, messages[i]));
+    }
+}
+
+LUX_TEST_CASE("hash", "compares byte sequences in constant time", "[crypto][hash]")
+{
+    CHECK(lux::crypto::constant_time_equal(as_bytes("abc"), as_bytes("abc")));
+    CHECK(lux::crypto::constant_time_equal({}, {}));
+    CHECK_FALSE(lux::crypto::constant_time_equal(as_bytes("abc"), as_bytes("abd")));
+    CHECK_FALSE(lux::crypto::constant_time_equal(as_bytes("abc"), as_bytes("ab")));
+}
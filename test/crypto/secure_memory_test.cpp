@@ -0,0 +1,152 @@
+#include <lux/crypto/container.hpp>
+#include <lux/crypto/secure_memory.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <openssl/crypto.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_case.hpp"
+
+namespace {
+
+bool is_zeroed(const void* ptr, std::size_t size)
+{
+    const std::span bytes{static_cast<const std::byte*>(ptr), size};
+    return std::ranges::all_of(bytes, [](std::byte b) { return b == std::byte{0}; });
+}
+
+} // namespace
+
+LUX_TEST_CASE("secure_memory", "initializes automatically on first allocation", "[crypto][secure_memory]")
+{
+    void* ptr = lux::crypto::secure_allocate(32);
+    REQUIRE(ptr != nullptr);
+    lux::crypto::secure_deallocate(ptr, 32);
+
+#ifndef OPENSSL_IS_BORINGSSL
+    CHECK(CRYPTO_secure_malloc_initialized() == 1);
+#endif
+    CHECK_FALSE(lux::crypto::init_secure_memory().has_value());
+}
+
+LUX_TEST_CASE("secure_memory", "serves small allocations from arena slots", "[crypto][secure_memory]")
+{
+    const auto before = lux::crypto::get_secure_arena_stats();
+
+    SECTION("Allocations are zeroed and aligned")
+    {
+        for (const std::size_t size : {1, 15, 16, 17, 100, 512, 1000, 1024})
+        {
+            void* ptr = lux::crypto::secure_allocate(size);
+            REQUIRE(ptr != nullptr);
+            CHECK(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t) == 0);
+            CHECK(is_zeroed(ptr, size));
+            CHECK(lux::crypto::get_secure_arena_stats().allocated_slots == before.allocated_slots + 1);
+
+            lux::crypto::secure_deallocate(ptr, size);
+            CHECK(lux::crypto::get_secure_arena_stats().allocated_slots == before.allocated_slots);
+        }
+    }
+
+    SECTION("Released slot is cleansed and reused")
+    {
+        void* ptr = lux::crypto::secure_allocate(64);
+        std::memset(ptr, 0xAA, 64);
+        lux::crypto::secure_deallocate(ptr, 64);
+
+        void* reused = lux::crypto::secure_allocate(48);
+        CHECK(reused == ptr);
+        CHECK(is_zeroed(reused, 64));
+        lux::crypto::secure_deallocate(reused, 48);
+    }
+
+    SECTION("Reserves memory in chunks")
+    {
+        std::vector<void*> ptrs;
+        for (int i = 0; i < 64; ++i)
+        {
+            ptrs.push_back(lux::crypto::secure_allocate(256));
+        }
+
+        const auto during = lux::crypto::get_secure_arena_stats();
+        CHECK(during.allocated_slots == before.allocated_slots + ptrs.size());
+        CHECK(during.reserved_bytes >= before.reserved_bytes);
+
+        for (auto* ptr : ptrs)
+        {
+            lux::crypto::secure_deallocate(ptr, 256);
+        }
+
+        // Released slots are kept for reuse
+        CHECK(lux::crypto::get_secure_arena_stats().reserved_bytes == during.reserved_bytes);
+    }
+}
+
+LUX_TEST_CASE("secure_memory", "serves large allocations outside the arena", "[crypto][secure_memory]")
+{
+    const auto before = lux::crypto::get_secure_arena_stats();
+
+    for (const std::size_t size : {std::size_t{1025}, std::size_t{8 * 1024}, std::size_t{1024 * 1024}})
+    {
+        void* ptr = lux::crypto::secure_allocate(size);
+        REQUIRE(ptr != nullptr);
+        CHECK(is_zeroed(ptr, size));
+        CHECK(lux::crypto::get_secure_arena_stats().allocated_slots == before.allocated_slots);
+
+        std::memset(ptr, 0xAA, size);
+        lux::crypto::secure_deallocate(ptr, size);
+    }
+}
+
+LUX_TEST_CASE("secure_memory", "backs secure containers", "[crypto][secure_memory]")
+{
+    SECTION("Secure string grows across slot sizes")
+    {
+        lux::crypto::secure_string str;
+        for (int i = 0; i < 4096; ++i)
+        {
+            str.push_back(static_cast<char>('a' + i % 26));
+        }
+
+        REQUIRE(str.size() == 4096);
+        CHECK(str.substr(0, 3) == "abc");
+        CHECK(str[4095] == static_cast<char>('a' + 4095 % 26));
+    }
+
+    SECTION("Secure vector copies")
+    {
+        lux::crypto::secure_vector<std::byte> vec(100, std::byte{0x42});
+        const auto copy = vec;
+        CHECK(copy == vec);
+    }
+}
+
+LUX_TEST_CASE("secure_memory", "allocates concurrently", "[crypto][secure_memory]")
+{
+    const auto before = lux::crypto::get_secure_arena_stats();
+
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([t] {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    lux::crypto::secure_string str(static_cast<std::size_t>(16 + (i + t) % 700), 'x');
+                    str.append("secret");
+                }
+            });
+        }
+    }
+
+    CHECK(lux::crypto::get_secure_arena_stats().allocated_slots == before.allocated_slots);
+}
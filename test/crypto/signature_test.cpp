@@ -0,0 +1,208 @@
+#include <lux/crypto/signature.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include "test_case.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+
+std::span<const std::byte> as_bytes(std::string_view str)
+{
+    return std::as_bytes(std::span{str.data(), str.size()});
+}
+
+struct key_pair
+{
+    lux::crypto::ed25519_signing_key signing_key;
+    lux::crypto::ed25519_verifying_key verifying_key;
+};
+
+key_pair make_key_pair()
+{
+    const auto private_key = lux::crypto::generate_ed25519_private_key();
+    REQUIRE(private_key.has_value());
+
+    auto signing_key = lux::crypto::make_signing_key(*private_key);
+    REQUIRE(signing_key.has_value());
+
+    auto verifying_key = lux::crypto::make_verifying_key(signing_key->public_key());
+    REQUIRE(verifying_key.has_value());
+
+    return key_pair{*signing_key, *verifying_key};
+}
+
+// Runs the tasks on a few threads, like a caller sharing its thread pool would
+void run_on_threads(std::size_t count, const std::function<void(std::size_t)>& task)
+{
+    constexpr std::size_t thread_count = 4;
+
+    std::vector<std::jthread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&task, count, t] {
+            for (std::size_t i = t; i < count; i += thread_count)
+            {
+                task(i);
+            }
+        });
+    }
+}
+
+} // namespace
+
+LUX_TEST_CASE("ed25519_signing_key", "exposes the public key of the private key", "[crypto][signature][ed25519]")
+{
+    const auto private_key = lux::crypto::generate_ed25519_private_key();
+    REQUIRE(private_key.has_value());
+
+    const auto signing_key = lux::crypto::make_signing_key(*private_key);
+    const auto public_key = lux::crypto::derive_public_key(*private_key);
+
+    REQUIRE(signing_key.has_value());
+    REQUIRE(public_key.has_value());
+    CHECK(signing_key->public_key().data == public_key->data);
+}
+
+LUX_TEST_CASE("ed25519_signing_key", "signs messages deterministically", "[crypto][signature][ed25519]")
+{
+    const auto keys = make_key_pair();
+
+    const auto signature1 = keys.signing_key.sign(as_bytes("message"));
+    const auto signature2 = keys.signing_key.sign(as_bytes("message"));
+    const auto signature3 = keys.signing_key.sign(as_bytes("other message"));
+
+    REQUIRE(signature1.has_value());
+    REQUIRE(signature2.has_value());
+    REQUIRE(signature3.has_value());
+    CHECK(signature1->data == signature2->data);
+    CHECK(signature1->data != signature3->data);
+}
+
+LUX_TEST_CASE("ed25519_verifying_key", "verifies signatures", "[crypto][signature][ed25519]")
+{
+    const auto keys = make_key_pair();
+
+    const auto signature = keys.signing_key.sign(as_bytes("message"));
+    REQUIRE(signature.has_value());
+
+    SECTION("Accepts a valid signature")
+    {
+        CHECK(keys.verifying_key.verify(as_bytes("message"), *signature));
+        CHECK(keys.verifying_key.verify(as_bytes("message"), *signature));
+    }
+
+    SECTION("Accepts a signature of an empty message")
+    {
+        const auto empty_signature = keys.signing_key.sign({});
+        REQUIRE(empty_signature.has_value());
+        CHECK(keys.verifying_key.verify({}, *empty_signature));
+    }
+
+    SECTION("Rejects a different message")
+    {
+        CHECK_FALSE(keys.verifying_key.verify(as_bytes("massage"), *signature));
+    }
+
+    SECTION("Rejects a tampered signature")
+    {
+        auto tampered = *signature;
+        tampered.data[10] ^= std::byte{0x01};
+        CHECK_FALSE(keys.verifying_key.verify(as_bytes("message"), tampered));
+    }
+
+    SECTION("Rejects a signature of the wrong size")
+    {
+        CHECK_FALSE(keys.verifying_key.verify(as_bytes("message"), std::span{signature->data}.first(63)));
+    }
+
+    SECTION("Rejects a signature of another key")
+    {
+        const auto other_keys = make_key_pair();
+        CHECK_FALSE(other_keys.verifying_key.verify(as_bytes("message"), *signature));
+    }
+}
+
+LUX_TEST_CASE("ed25519_verifying_key", "verifies batches of signatures", "[crypto][signature][ed25519]")
+{
+    const auto keys1 = make_key_pair();
+    const auto keys2 = make_key_pair();
+
+    constexpr std::size_t count = 100;
+    std::vector<std::array<std::byte, 16>> messages(count);
+    std::vector<lux::crypto::ed25519_signature> signatures;
+    std::vector<lux::crypto::ed25519_verify_item> items;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        messages[i].fill(static_cast<std::byte>(i));
+        const auto& keys = i % 2 == 0 ? keys1 : keys2;
+
+        auto signature = keys.signing_key.sign(messages[i]);
+        REQUIRE(signature.has_value());
+        signatures.push_back(*signature);
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto& keys = i % 2 == 0 ? keys1 : keys2;
+        items.push_back({.message = messages[i], .signature = signatures[i].data, .key = &keys.verifying_key});
+    }
+
+    std::vector<std::uint8_t> expected(count, 1);
+    std::vector<std::uint8_t> results(count);
+
+    std::atomic<std::size_t> tasks{0};
+    const lux::crypto::parallel_for run_parallel = [&](std::size_t task_count, const auto& task) {
+        tasks = task_count;
+        run_on_threads(task_count, task);
+    };
+
+    SECTION("Accepts all valid signatures")
+    {
+        CHECK(lux::crypto::verify_batch(items, results, run_parallel));
+        CHECK(results == expected);
+        CHECK(tasks > 1);
+    }
+
+    SECTION("Reports each invalid signature")
+    {
+        signatures[3].data[0] ^= std::byte{0x01};
+        items[50].key = &keys2.verifying_key;
+        items[77].key = nullptr;
+        expected[3] = expected[50] = expected[77] = false;
+
+        CHECK_FALSE(lux::crypto::verify_batch(items, results, run_parallel));
+        CHECK(results == expected);
+
+        std::vector<std::uint8_t> sequential_results(count);
+        CHECK_FALSE(lux::crypto::verify_batch(items, sequential_results));
+        CHECK(sequential_results == expected);
+    }
+
+    SECTION("Verifies on the calling thread only")
+    {
+        CHECK(lux::crypto::verify_batch(items, results));
+        CHECK(results == expected);
+    }
+
+    SECTION("Verifies small batches without the parallel-for")
+    {
+        CHECK(lux::crypto::verify_batch(std::span{items}.first(4), std::span{results}.first(4), run_parallel));
+        CHECK(tasks == 0);
+    }
+
+    SECTION("Accepts an empty batch")
+    {
+        CHECK(lux::crypto::verify_batch({}, {}));
+    }
+}
@@ -0,0 +1,147 @@
+#include <lux/crypto/cert.hpp>
+#include <lux/crypto/ssl_context.hpp>
+#include <lux/support/move.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <openssl/bio.h>
+#include <openssl/ssl.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "test_case.hpp"
+
+namespace {
+
+using ssl_ptr = std::unique_ptr<SSL, decltype(&SSL_free)>;
+
+lux::crypto::subject_info make_subject(std::string common_name)
+{
+    lux::crypto::subject_info subject{};
+    subject.subject_alt_names = {common_name, "127.0.0.1"};
+    subject.common_name = lux::move(common_name);
+    return subject;
+}
+
+/**
+ * Runs a TLS handshake between the contexts over an in-memory BIO pair.
+ */
+bool handshake(lux::net::base::ssl_context& server_ctx, lux::net::base::ssl_context& client_ctx, const char* host)
+{
+    ssl_ptr server{SSL_new(server_ctx.native_handle()), &SSL_free};
+    ssl_ptr client{SSL_new(client_ctx.native_handle()), &SSL_free};
+    REQUIRE(server);
+    REQUIRE(client);
+
+    BIO* server_bio{nullptr};
+    BIO* client_bio{nullptr};
+    REQUIRE(BIO_new_bio_pair(&server_bio, 0, &client_bio, 0) == 1);
+    SSL_set_bio(server.get(), server_bio, server_bio);
+    SSL_set_bio(client.get(), client_bio, client_bio);
+
+    SSL_set_accept_state(server.get());
+    SSL_set_connect_state(client.get());
+    REQUIRE(SSL_set1_host(client.get(), host) == 1);
+
+    bool server_done{false};
+    bool client_done{false};
+    for (int round = 0; round < 16 && !(server_done && client_done); ++round)
+    {
+        for (auto [ssl, done] : {std::pair{client.get(), &client_done}, std::pair{server.get(), &server_done}})
+        {
+            if (*done)
+            {
+                continue;
+            }
+
+            const int res{SSL_do_handshake(ssl)};
+            if (res == 1)
+            {
+                *done = true;
+            }
+            else if (const int err{SSL_get_error(ssl, res)}; err != SSL_ERROR_WANT_READ && err != SSL_ERROR_WANT_WRITE)
+            {
+                return false;
+            }
+        }
+    }
+
+    return server_done && client_done && SSL_get_verify_result(client.get()) == X509_V_OK;
+}
+
+} // namespace
+
+LUX_TEST_CASE("ssl_context", "builds SSL contexts from in-memory certificates", "[crypto][ssl]")
+{
+    const auto ca{lux::crypto::make_certificate_authority(make_subject("Test CA"))};
+    REQUIRE(ca.has_value());
+
+    const auto leaf{ca->issue(make_subject("localhost"))};
+    REQUIRE(leaf.has_value());
+
+    auto server_ctx{lux::crypto::make_server_ssl_context(leaf->private_key, leaf->cert)};
+    REQUIRE(server_ctx.has_value());
+
+    SECTION("Client trusting the CA completes the handshake")
+    {
+        auto client_ctx{lux::crypto::make_client_ssl_context(ca->cert())};
+        REQUIRE(client_ctx.has_value());
+
+        CHECK(handshake(*server_ctx, *client_ctx, "localhost"));
+    }
+
+    SECTION("Client rejects a mismatching host")
+    {
+        auto client_ctx{lux::crypto::make_client_ssl_context(ca->cert())};
+        REQUIRE(client_ctx.has_value());
+
+        CHECK_FALSE(handshake(*server_ctx, *client_ctx, "example.com"));
+    }
+
+    SECTION("Client trusting another CA rejects the server")
+    {
+        const auto other_ca{lux::crypto::make_certificate_authority(make_subject("Other CA"))};
+        REQUIRE(other_ca.has_value());
+
+        auto client_ctx{lux::crypto::make_client_ssl_context(other_ca->cert())};
+        REQUIRE(client_ctx.has_value());
+
+        CHECK_FALSE(handshake(*server_ctx, *client_ctx, "localhost"));
+    }
+
+    SECTION("Server rejects a certificate not matching the private key")
+    {
+        const auto other{ca->issue(make_subject("localhost"))};
+        REQUIRE(other.has_value());
+
+        CHECK_FALSE(lux::crypto::make_server_ssl_context(other->private_key, leaf->cert).has_value());
+    }
+
+    SECTION("Server sends the chain")
+    {
+        const auto intermediate{ca->issue(make_subject("Intermediate CA"), {.is_ca = true})};
+        REQUIRE(intermediate.has_value());
+
+        const auto chained_key{lux::crypto::generate_ed25519_private_key()};
+        REQUIRE(chained_key.has_value());
+        const auto chained_public_key{lux::crypto::derive_public_key(*chained_key)};
+        REQUIRE(chained_public_key.has_value());
+
+        const auto chained_cert{lux::crypto::issue_cert(*chained_public_key,
+                                                        make_subject("localhost"),
+                                                        intermediate->private_key,
+                                                        intermediate->cert)};
+        REQUIRE(chained_cert.has_value());
+
+        const lux::crypto::cert_der chain[]{intermediate->cert};
+        auto chained_server_ctx{lux::crypto::make_server_ssl_context(*chained_key, *chained_cert, chain)};
+        REQUIRE(chained_server_ctx.has_value());
+
+        auto client_ctx{lux::crypto::make_client_ssl_context(ca->cert())};
+        REQUIRE(client_ctx.has_value());
+
+        CHECK(handshake(*chained_server_ctx, *client_ctx, "localhost"));
+    }
+}
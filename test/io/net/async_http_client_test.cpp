@@ -0,0 +1,85 @@
+#include "test_case.hpp"
+
+#include <lux/io/net/async_http_client.hpp>
+#include <lux/io/net/base/http_status.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_awaitable.hpp>
+
+#include <chrono>
+#include <expected>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+class test_http_client : public lux::net::base::http_client
+{
+public:
+    void request(const lux::net::base::http_request& request,
+                 lux::net::base::http_client_handler_type handler) override
+    {
+        requests.push_back(request);
+        handlers.push_back(lux::move(handler));
+    }
+
+    std::vector<lux::net::base::http_request> requests;
+    std::vector<lux::net::base::http_client_handler_type> handlers;
+};
+
+} // namespace
+
+LUX_TEST_CASE("async_http_client", "completes requests through completion tokens", "[io][net][http][async]")
+{
+    boost::asio::io_context io_context;
+    test_http_client client;
+    lux::net::async_http_client async_client{io_context.get_executor(), client};
+
+    SECTION("Awaited request returns response of the underlying client")
+    {
+        std::optional<lux::net::base::http_request_result> result;
+
+        boost::asio::co_spawn(
+            io_context,
+            [&]() -> boost::asio::awaitable<void> {
+                lux::net::base::http_request request;
+                request.set_target("/status");
+                result = co_await async_client.async_request(request, boost::asio::use_awaitable);
+            },
+            boost::asio::detached);
+
+        io_context.run_for(std::chrono::milliseconds{10});
+        REQUIRE(client.handlers.size() == 1);
+        CHECK(client.requests[0].target() == "/status");
+        CHECK_FALSE(result.has_value());
+
+        client.handlers[0](lux::net::base::http_response{lux::net::base::http_status::ok});
+
+        io_context.restart();
+        io_context.run_for(std::chrono::milliseconds{10});
+        REQUIRE(result.has_value());
+        REQUIRE(result->has_value());
+        CHECK((*result)->status() == lux::net::base::http_status::ok);
+    }
+
+    SECTION("Synchronously reported error is not completed inline")
+    {
+        std::optional<lux::net::base::http_request_result> result;
+        async_client.async_request(lux::net::base::http_request{},
+                                   [&](const lux::net::base::http_request_result& r) { result = r; });
+
+        REQUIRE(client.handlers.size() == 1);
+        client.handlers[0](std::unexpected{std::make_error_code(std::errc::connection_refused)});
+        CHECK_FALSE(result.has_value());
+
+        io_context.run_for(std::chrono::milliseconds{10});
+        REQUIRE(result.has_value());
+        REQUIRE_FALSE(result->has_value());
+        CHECK(result->error() == std::make_error_code(std::errc::connection_refused));
+    }
+}
@@ -0,0 +1,227 @@
+#include "test_case.hpp"
+
+#include <lux/io/net/async_tcp_socket.hpp>
+#include <lux/io/net/socket_factory.hpp>
+#include <lux/io/net/base/endpoint.hpp>
+#include <lux/io/net/base/address_v4.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <boost/asio/as_tuple.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/write.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+std::vector<std::byte> to_bytes(const std::string& str)
+{
+    const auto* data = reinterpret_cast<const std::byte*>(str.data());
+    return std::vector<std::byte>{data, data + str.size()};
+}
+
+std::string from_bytes(std::span<const std::byte> bytes)
+{
+    return std::string{reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
+lux::net::base::tcp_socket_config create_default_config()
+{
+    lux::net::base::tcp_socket_config config{};
+    config.reconnect.enabled = false;
+    return config;
+}
+
+} // namespace
+
+LUX_TEST_CASE("async_tcp_socket", "connects, sends and reads using coroutines", "[io][net][tcp][async]")
+{
+    boost::asio::io_context io_context;
+    lux::net::socket_factory socket_factory{io_context.get_executor()};
+
+    boost::asio::ip::tcp::acceptor acceptor{io_context, boost::asio::ip::tcp::endpoint{boost::asio::ip::tcp::v4(), 0}};
+    const auto server_port = acceptor.local_endpoint().port();
+
+    // Echo server
+    boost::asio::ip::tcp::socket server_socket{io_context};
+    std::array<char, 64> server_buffer{};
+    acceptor.async_accept(server_socket, [&](const boost::system::error_code& ec) {
+        REQUIRE_FALSE(ec);
+        server_socket.async_read_some(boost::asio::buffer(server_buffer),
+                                      [&](const boost::system::error_code& read_ec, std::size_t size) {
+                                          REQUIRE_FALSE(read_ec);
+                                          boost::asio::write(server_socket, boost::asio::buffer(server_buffer, size));
+                                      });
+    });
+
+    lux::net::async_tcp_socket socket{io_context.get_executor(), socket_factory, create_default_config()};
+
+    std::error_code connect_error = std::make_error_code(std::errc::io_error);
+    std::error_code send_error = std::make_error_code(std::errc::io_error);
+    std::string received;
+    bool finished = false;
+
+    boost::asio::co_spawn(
+        io_context,
+        [&]() -> boost::asio::awaitable<void> {
+            std::tie(connect_error) = co_await socket.async_connect(
+                lux::net::base::endpoint{lux::net::base::localhost, server_port},
+                boost::asio::as_tuple(boost::asio::use_awaitable));
+
+            const auto request = to_bytes("hello");
+            std::tie(send_error) = co_await socket.async_send(std::span<const std::byte>{request},
+                                                              boost::asio::as_tuple(boost::asio::use_awaitable));
+
+            std::array<std::byte, 64> buffer{};
+            while (received.size() < request.size())
+            {
+                const auto [read_error, size] = co_await socket.async_read_some(
+                    buffer, boost::asio::as_tuple(boost::asio::use_awaitable));
+                if (read_error)
+                {
+                    break;
+                }
+                received += from_bytes(std::span{buffer.data(), size});
+            }
+
+            finished = true;
+            io_context.stop();
+        },
+        boost::asio::detached);
+
+    io_context.run_for(std::chrono::milliseconds{1000});
+
+    CHECK(finished);
+    CHECK_FALSE(connect_error);
+    CHECK_FALSE(send_error);
+    CHECK(received == "hello");
+}
+
+LUX_TEST_CASE("async_tcp_socket", "completes pending operations with errors", "[io][net][tcp][async]")
+{
+    boost::asio::io_context io_context;
+    lux::net::socket_factory socket_factory{io_context.get_executor()};
+
+    SECTION("Read fails when socket is not connected")
+    {
+        lux::net::async_tcp_socket socket{io_context.get_executor(), socket_factory, create_default_config()};
+
+        std::array<std::byte, 16> buffer{};
+        std::error_code read_error;
+        bool completed = false;
+        socket.async_read_some(buffer, [&](const std::error_code& ec, std::size_t size) {
+            read_error = ec;
+            completed = true;
+            CHECK(size == 0);
+        });
+
+        // Completion is never invoked from within the initiating function
+        CHECK_FALSE(completed);
+
+        io_context.run_for(std::chrono::milliseconds{100});
+        CHECK(completed);
+        CHECK(read_error == std::make_error_code(std::errc::not_connected));
+    }
+
+    SECTION("Pending read fails when the peer closes the connection")
+    {
+        boost::asio::ip::tcp::acceptor acceptor{io_context,
+                                                boost::asio::ip::tcp::endpoint{boost::asio::ip::tcp::v4(), 0}};
+        const auto server_port = acceptor.local_endpoint().port();
+
+        boost::asio::ip::tcp::socket server_socket{io_context};
+        acceptor.async_accept(server_socket, [&](const boost::system::error_code&) { server_socket.close(); });
+
+        lux::net::async_tcp_socket socket{io_context.get_executor(), socket_factory, create_default_config()};
+
+        std::error_code read_error;
+        bool completed = false;
+        std::array<std::byte, 16> buffer{};
+
+        boost::asio::co_spawn(
+            io_context,
+            [&]() -> boost::asio::awaitable<void> {
+                const auto [connect_error] = co_await socket.async_connect(
+                    lux::net::base::endpoint{lux::net::base::localhost, server_port},
+                    boost::asio::as_tuple(boost::asio::use_awaitable));
+                REQUIRE_FALSE(connect_error);
+
+                std::size_t size{0};
+                std::tie(read_error, size) = co_await socket.async_read_some(
+                    buffer, boost::asio::as_tuple(boost::asio::use_awaitable));
+
+                completed = true;
+                io_context.stop();
+            },
+            boost::asio::detached);
+
+        io_context.run_for(std::chrono::milliseconds{1000});
+
+        CHECK(completed);
+        CHECK(read_error);
+        CHECK_FALSE(socket.is_connected());
+    }
+}
+
+LUX_TEST_CASE("async_tcp_socket", "limits data buffered while no read is pending", "[io][net][tcp][async]")
+{
+    boost::asio::io_context io_context;
+    lux::net::socket_factory socket_factory{io_context.get_executor()};
+
+    boost::asio::ip::tcp::acceptor acceptor{io_context, boost::asio::ip::tcp::endpoint{boost::asio::ip::tcp::v4(), 0}};
+    const auto server_port = acceptor.local_endpoint().port();
+
+    boost::asio::ip::tcp::socket server_socket{io_context};
+    acceptor.async_accept(server_socket, [&](const boost::system::error_code& ec) {
+        REQUIRE_FALSE(ec);
+        boost::asio::write(server_socket, boost::asio::buffer(std::string(64, 'x')));
+    });
+
+    auto config = create_default_config();
+    config.buffer.max_unread_size = GENERATE(std::size_t{16}, std::size_t{64});
+    lux::net::async_tcp_socket socket{io_context.get_executor(), socket_factory, config};
+
+    std::error_code connect_error = std::make_error_code(std::errc::io_error);
+    socket.async_connect(lux::net::base::endpoint{lux::net::base::localhost, server_port},
+                         [&](const std::error_code& ec) { connect_error = ec; });
+
+    // Nothing is read while the server sends
+    io_context.run_for(std::chrono::milliseconds{200});
+    REQUIRE_FALSE(connect_error);
+
+    std::error_code read_error;
+    std::size_t read_size{0};
+    std::array<std::byte, 128> buffer{};
+    socket.async_read_some(buffer, [&](const std::error_code& ec, std::size_t size) {
+        read_error = ec;
+        read_size = size;
+    });
+
+    io_context.restart();
+    io_context.run_for(std::chrono::milliseconds{100});
+
+    if (config.buffer.max_unread_size < 64)
+    {
+        CHECK(read_error == std::make_error_code(std::errc::no_buffer_space));
+        CHECK(read_size == 0);
+        CHECK_FALSE(socket.is_connected());
+    }
+    else
+    {
+        CHECK_FALSE(read_error);
+        CHECK(read_size == 64);
+        CHECK(socket.is_connected());
+    }
+}
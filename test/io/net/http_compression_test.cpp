@@ -0,0 +1,338 @@
+﻿#include "test_case.hpp"
+
+#include <lux/io/net/http_compression.hpp>
+
+#include <lux/io/net/base/http_method.hpp>
+#include <lux/io/net/base/http_request.hpp>
+#include <lux/io/net/base/http_response.hpp>
+#include <lux/io/net/base/http_status.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <boost/beast/zlib/inflate_stream.hpp>
+#include <boost/crc.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace {
+
+std::uint32_t read_le32(std::string_view data)
+{
+    std::uint32_t value{0};
+    for (int i = 3; i >= 0; --i)
+    {
+        value = (value << 8) | static_cast<unsigned char>(data[i]);
+    }
+    return value;
+}
+
+/**
+ * Inflates the raw deflate data following the header, returns the decompressed data and the trailer after it.
+ */
+std::pair<std::string, std::string_view> inflate(std::string_view data, std::size_t header_size)
+{
+    REQUIRE(data.size() > header_size);
+
+    boost::beast::zlib::inflate_stream stream;
+    stream.reset(15);
+
+    std::string out(1024 * 1024, '\0');
+    boost::beast::zlib::z_params params;
+    params.next_in = data.data() + header_size;
+    params.avail_in = data.size() - header_size;
+    params.next_out = out.data();
+    params.avail_out = out.size();
+
+    boost::beast::error_code ec;
+    stream.write(params, boost::beast::zlib::Flush::finish, ec);
+    REQUIRE(ec == boost::beast::zlib::error::end_of_stream);
+
+    out.resize(out.size() - params.avail_out);
+    return {out, data.substr(data.size() - params.avail_in)};
+}
+
+std::string make_text(std::size_t size)
+{
+    std::string text;
+    while (text.size() < size)
+    {
+        text += "The quick brown fox jumps over the lazy dog " + std::to_string(text.size()) + ". ";
+    }
+    text.resize(size);
+    return text;
+}
+
+lux::net::base::http_request make_request(std::string_view accept_encoding)
+{
+    lux::net::base::http_request request{lux::net::base::http_method::get, "/"};
+    request.set_header("Accept-Encoding", std::string{accept_encoding});
+    return request;
+}
+
+lux::net::http_compression_config make_config()
+{
+    lux::net::http_compression_config config;
+    config.enabled = true;
+    return config;
+}
+
+} // namespace
+
+LUX_TEST_CASE("http_compression", "negotiates content coding from Accept-Encoding", "[io][net][http]")
+{
+    using lux::net::http_content_coding;
+    using lux::net::negotiate_content_coding;
+
+    SECTION("No supported coding")
+    {
+        CHECK(negotiate_content_coding("") == http_content_coding::identity);
+        CHECK(negotiate_content_coding("br, zstd") == http_content_coding::identity);
+        CHECK(negotiate_content_coding("identity") == http_content_coding::identity);
+    }
+
+    SECTION("Single coding")
+    {
+        CHECK(negotiate_content_coding("gzip") == http_content_coding::gzip);
+        CHECK(negotiate_content_coding("x-gzip") == http_content_coding::gzip);
+        CHECK(negotiate_content_coding("deflate") == http_content_coding::deflate);
+        CHECK(negotiate_content_coding("GZIP") == http_content_coding::gzip);
+    }
+
+    SECTION("Prefers gzip on equal quality")
+    {
+        CHECK(negotiate_content_coding("deflate, gzip") == http_content_coding::gzip);
+        CHECK(negotiate_content_coding("gzip, deflate, br") == http_content_coding::gzip);
+        CHECK(negotiate_content_coding("*") == http_content_coding::gzip);
+    }
+
+    SECTION("Honors quality values")
+    {
+        CHECK(negotiate_content_coding("gzip;q=0.5, deflate") == http_content_coding::deflate);
+        CHECK(negotiate_content_coding("gzip; q=0.8, deflate;q=0.9") == http_content_coding::deflate);
+        CHECK(negotiate_content_coding("gzip;q=1.0, deflate;q=0.999") == http_content_coding::gzip);
+    }
+
+    SECTION("Rejects codings with zero quality")
+    {
+        CHECK(negotiate_content_coding("gzip;q=0") == http_content_coding::identity);
+        CHECK(negotiate_content_coding("gzip;q=0, deflate") == http_content_coding::deflate);
+        CHECK(negotiate_content_coding("*;q=0") == http_content_coding::identity);
+    }
+
+    SECTION("Applies wildcard only to codings not listed")
+    {
+        CHECK(negotiate_content_coding("gzip;q=0, *") == http_content_coding::deflate);
+        CHECK(negotiate_content_coding("deflate, *;q=0.5") == http_content_coding::deflate);
+    }
+
+    SECTION("Ignores malformed entries")
+    {
+        CHECK(negotiate_content_coding("gzip;q=2, deflate") == http_content_coding::deflate);
+        CHECK(negotiate_content_coding("gzip;q=abc") == http_content_coding::identity);
+        CHECK(negotiate_content_coding(" , ,gzip") == http_content_coding::gzip);
+    }
+}
+
+LUX_TEST_CASE("http_compression", "compresses data into valid gzip and deflate streams", "[io][net][http]")
+{
+    using lux::net::http_content_coding;
+
+    SECTION("Gzip")
+    {
+        const auto data = make_text(200'000);
+        const auto compressed = lux::net::compress(http_content_coding::gzip, data, 6);
+        REQUIRE(compressed);
+        CHECK(compressed->size() < data.size());
+        CHECK(static_cast<unsigned char>((*compressed)[0]) == 0x1f);
+        CHECK(static_cast<unsigned char>((*compressed)[1]) == 0x8b);
+
+        const auto [decompressed, trailer] = inflate(*compressed, 10);
+        CHECK(decompressed == data);
+
+        REQUIRE(trailer.size() == 8);
+        boost::crc_32_type crc;
+        crc.process_bytes(data.data(), data.size());
+        CHECK(read_le32(trailer) == crc.checksum());
+        CHECK(read_le32(trailer.substr(4)) == data.size());
+    }
+
+    SECTION("Deflate")
+    {
+        const auto data = make_text(200'000);
+        const auto compressed = lux::net::compress(http_content_coding::deflate, data, 9);
+        REQUIRE(compressed);
+        CHECK(compressed->size() < data.size());
+
+        // The zlib header checksum makes the first two bytes a multiple of 31
+        const auto header = static_cast<unsigned char>((*compressed)[0]) * 256u +
+                            static_cast<unsigned char>((*compressed)[1]);
+        CHECK(header % 31 == 0);
+
+        const auto [decompressed, trailer] = inflate(*compressed, 2);
+        CHECK(decompressed == data);
+        CHECK(trailer.size() == 4);
+    }
+
+    SECTION("Empty data")
+    {
+        const auto compressed = lux::net::compress(http_content_coding::gzip, "", 1);
+        REQUIRE(compressed);
+
+        const auto [decompressed, trailer] = inflate(*compressed, 10);
+        CHECK(decompressed.empty());
+        CHECK(trailer == std::string_view{"\0\0\0\0\0\0\0\0", 8});
+    }
+
+    SECTION("Reuses the compression context")
+    {
+        const auto first = lux::net::compress(http_content_coding::gzip, make_text(5000), 6);
+        const auto second = lux::net::compress(http_content_coding::gzip, make_text(5000), 6);
+        REQUIRE(first);
+        REQUIRE(second);
+        CHECK(*first == *second);
+    }
+}
+
+LUX_TEST_CASE("http_compression", "compresses only qualifying responses", "[io][net][http]")
+{
+    const auto body = make_text(4096);
+    const auto config = make_config();
+
+    lux::net::base::http_response response;
+    response.text(body);
+
+    SECTION("Compresses text for a client accepting gzip")
+    {
+        CHECK(lux::net::compress_response(make_request("gzip, deflate"), response, config));
+        CHECK(response.header("Content-Encoding") == "gzip");
+        CHECK(response.header("Vary") == "Accept-Encoding");
+        CHECK(inflate(response.body(), 10).first == body);
+    }
+
+    SECTION("Finds request and response headers regardless of case")
+    {
+        lux::net::base::http_request request{lux::net::base::http_method::get, "/"};
+        request.set_header("accept-encoding", "deflate");
+
+        lux::net::base::http_response json_response;
+        json_response.set_header("content-type", "Application/JSON; charset=utf-8");
+        json_response.set_body(body);
+
+        CHECK(lux::net::compress_response(request, json_response, config));
+        CHECK(json_response.header("Content-Encoding") == "deflate");
+    }
+
+    SECTION("Leaves body as is for a client without a supported coding")
+    {
+        CHECK_FALSE(lux::net::compress_response(make_request("br"), response, config));
+        CHECK(response.body() == body);
+        CHECK_FALSE(response.has_header("Content-Encoding"));
+        CHECK(response.header("Vary") == "Accept-Encoding");
+    }
+
+    SECTION("Skips bodies below the minimum size")
+    {
+        lux::net::base::http_response small;
+        small.text("short");
+
+        CHECK_FALSE(lux::net::compress_response(make_request("gzip"), small, config));
+        CHECK(small.body() == "short");
+        CHECK_FALSE(small.has_header("Vary"));
+    }
+
+    SECTION("Skips media types not configured")
+    {
+        response.set_header("Content-Type", "image/png");
+
+        CHECK_FALSE(lux::net::compress_response(make_request("gzip"), response, config));
+        CHECK(response.body() == body);
+        CHECK_FALSE(response.has_header("Vary"));
+    }
+
+    SECTION("Skips responses without a media type")
+    {
+        lux::net::base::http_response untyped;
+        untyped.set_body(body);
+
+        CHECK_FALSE(lux::net::compress_response(make_request("gzip"), untyped, config));
+    }
+
+    SECTION("Skips already encoded responses")
+    {
+        response.set_header("Content-Encoding", "br");
+
+        CHECK_FALSE(lux::net::compress_response(make_request("gzip"), response, config));
+        CHECK(response.body() == body);
+        CHECK(response.header("Content-Encoding") == "br");
+    }
+
+    SECTION("Skips partial content")
+    {
+        response.set_status(lux::net::base::http_status::partial_content);
+
+        CHECK_FALSE(lux::net::compress_response(make_request("gzip"), response, config));
+        CHECK(response.body() == body);
+    }
+
+    SECTION("Weakens a strong ETag of a compressed body")
+    {
+        response.set_header("etag", "\"v1\"");
+
+        CHECK(lux::net::compress_response(make_request("gzip"), response, config));
+        CHECK(response.header("etag") == "W/\"v1\"");
+    }
+
+    SECTION("Keeps a weak ETag and the ETag of an uncompressed body")
+    {
+        response.set_header("ETag", "W/\"v1\"");
+        CHECK(lux::net::compress_response(make_request("gzip"), response, config));
+        CHECK(response.header("ETag") == "W/\"v1\"");
+
+        lux::net::base::http_response identity;
+        identity.text(body);
+        identity.set_header("ETag", "\"v1\"");
+        CHECK_FALSE(lux::net::compress_response(make_request("br"), identity, config));
+        CHECK(identity.header("ETag") == "\"v1\"");
+    }
+
+    SECTION("Appends to existing Vary")
+    {
+        response.set_header("Vary", "Origin");
+
+        CHECK(lux::net::compress_response(make_request("gzip"), response, config));
+        CHECK(response.header("Vary") == "Origin, Accept-Encoding");
+    }
+
+    SECTION("Sends incompressible bodies as is")
+    {
+        std::string random(4096, '\0');
+        std::uint32_t state{12345};
+        for (auto& c : random)
+        {
+            state = state * 1664525u + 1013904223u;
+            c = static_cast<char>(state >> 24);
+        }
+
+        lux::net::base::http_response binary;
+        binary.text(random);
+
+        CHECK_FALSE(lux::net::compress_response(make_request("gzip"), binary, config));
+        CHECK(binary.body() == random);
+        CHECK_FALSE(binary.has_header("Content-Encoding"));
+    }
+
+    SECTION("Matches custom media types")
+    {
+        auto custom = config;
+        custom.content_types = {"application/wasm"};
+
+        lux::net::base::http_response wasm;
+        wasm.set_header("Content-Type", "application/wasm");
+        wasm.set_body(body);
+
+        CHECK(lux::net::compress_response(make_request("gzip"), wasm, custom));
+        CHECK_FALSE(lux::net::compress_response(make_request("gzip"), response, custom));
+    }
+}
@@ -6,9 +6,14 @@
 #include <lux/io/net/base/http_response.hpp>
 #include <lux/io/net/base/http_method.hpp>
 #include <lux/io/net/base/http_status.hpp>
+#include <lux/io/net/static_file_handler.hpp>
+#include <lux/support/finally.hpp>
 
 #include <catch2/catch_all.hpp>
 
+#include <filesystem>
+#include <fstream>
+
 LUX_TEST_CASE("http_router", "routes request to registered handler successfully", "[io][net][http][router]")
 {
     lux::net::http_router router;
@@ -358,3 +363,78 @@ LUX_TEST_CASE("http_router", "routes request with unknown method", "[io][net][ht
 
     CHECK(response.status() == lux::net::base::http_status::not_found);
 }
+
+LUX_TEST_CASE("http_router", "serves files below static route prefixes", "[io][net][http][router]")
+{
+    const auto root = std::filesystem::temp_directory_path() / "lux_http_router_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "assets");
+    LUX_FINALLY({ std::filesystem::remove_all(root); });
+    std::ofstream{root / "app.js"} << "app";
+    std::ofstream{root / "assets" / "logo.svg"} << "logo";
+
+    lux::net::http_router router;
+    router.add_route(lux::net::base::http_method::get, "/static/health", [](const auto&, auto& res) { res.ok("OK"); });
+    router.add_static_route("/static/", lux::net::static_file_handler_config{.root = root});
+    router.add_static_route("/static/assets", lux::net::static_file_handler_config{.root = root / "assets"});
+
+    SECTION("Serve a file below the prefix")
+    {
+        lux::net::base::http_request request{lux::net::base::http_method::get, "/static/app.js?v=1"};
+        lux::net::base::http_response response;
+
+        router.route(request, response);
+
+        CHECK(router.serves_file(request));
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        REQUIRE(response.file_body().has_value());
+        CHECK(response.file_body()->size == 3);
+    }
+
+    SECTION("Prefer the longest matching prefix")
+    {
+        lux::net::base::http_request request{lux::net::base::http_method::get, "/static/assets/logo.svg"};
+        lux::net::base::http_response response;
+
+        router.route(request, response);
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        REQUIRE(response.file_body().has_value());
+        CHECK(response.file_body()->size == 4);
+    }
+
+    SECTION("Prefer exact routes over static routes")
+    {
+        lux::net::base::http_request request{lux::net::base::http_method::get, "/static/health"};
+        lux::net::base::http_response response;
+
+        router.route(request, response);
+
+        CHECK_FALSE(router.serves_file(request));
+        CHECK(response.body() == "OK");
+        CHECK_FALSE(response.file_body().has_value());
+    }
+
+    SECTION("Match the prefix only at segment boundaries")
+    {
+        lux::net::base::http_request request{lux::net::base::http_method::get, "/staticapp.js"};
+        lux::net::base::http_response response;
+
+        router.route(request, response);
+
+        CHECK_FALSE(router.serves_file(request));
+        CHECK(response.status() == lux::net::base::http_status::not_found);
+    }
+
+    SECTION("Return 404 for other methods")
+    {
+        lux::net::base::http_request request{lux::net::base::http_method::post, "/static/app.js"};
+        lux::net::base::http_response response;
+
+        router.route(request, response);
+
+        CHECK_FALSE(router.serves_file(request));
+        CHECK(response.status() == lux::net::base::http_status::not_found);
+        CHECK_FALSE(response.file_body().has_value());
+    }
+}
@@ -706,6 +706,43 @@ LUX_TEST_CASE("http_server_app", "handler can read request body", "[io][net][htt
     CHECK(response.body() == expected_body);
 }
 
+LUX_TEST_CASE("http_server_app", "compresses responses only when compression is enabled", "[io][net][http]")
+{
+    const std::string body(4096, 'a');
+
+    auto serve = [&](const lux::net::http_server_app_config& config) {
+        mock_http_factory factory;
+        lux::net::http_server_app app{config, factory};
+        app.get("/text", [&](const auto&, auto& res) { res.text(body); });
+        app.serve(lux::net::base::endpoint{lux::net::base::localhost, 8080});
+
+        auto* mock_server = factory.last_created_server();
+        REQUIRE(mock_server != nullptr);
+
+        lux::net::base::http_request request{lux::net::base::http_method::get, "/text"};
+        request.set_header("Accept-Encoding", "gzip");
+        return mock_server->simulate_request(request);
+    };
+
+    SECTION("Disabled by default")
+    {
+        const auto response = serve(create_default_http_server_app_config());
+        CHECK(response.body() == body);
+        CHECK_FALSE(response.has_header("Content-Encoding"));
+    }
+
+    SECTION("Enabled in the configuration")
+    {
+        auto config = create_default_http_server_app_config();
+        config.compression.enabled = true;
+
+        const auto response = serve(config);
+        CHECK(response.header("Content-Encoding") == "gzip");
+        CHECK(response.header("Vary") == "Accept-Encoding");
+        CHECK(response.body().size() < body.size());
+    }
+}
+
     LUX_TEST_CASE("http_server_app", "handler can access query parameters from request", "[io][net][http]")
     {
         mock_http_factory factory;
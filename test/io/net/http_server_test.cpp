@@ -3,20 +3,26 @@
 
 #include <lux/io/net/http_server.hpp>
 #include <lux/io/net/socket_factory.hpp>
+#include <lux/io/net/static_file_handler.hpp>
 #include <lux/io/net/tcp_socket.hpp>
 #include <lux/io/net/base/endpoint.hpp>
 #include <lux/io/net/base/address_v4.hpp>
 #include <lux/io/net/base/http_method.hpp>
 #include <lux/io/net/base/http_status.hpp>
 #include <lux/io/time/timer_factory.hpp>
+#include <lux/support/finally.hpp>
 
 #include <catch2/catch_all.hpp>
 
 #include <boost/asio/io_context.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -65,6 +71,11 @@ public:
         return lux::net::base::http_response{lux::net::base::http_status::ok};
     }
 
+    bool may_block(const lux::net::base::http_request& request) override
+    {
+        return may_block_callback && may_block_callback(request);
+    }
+
     std::size_t started_calls{0};
     std::size_t stopped_calls{0};
     std::size_t error_calls{0};
@@ -76,6 +87,7 @@ public:
     std::function<void()> on_server_stopped_callback;
     std::function<void(const std::error_code&)> on_server_error_callback;
     std::function<lux::net::base::http_response(const lux::net::base::http_request&)> handle_request_callback;
+    std::function<bool(const lux::net::base::http_request&)> may_block_callback;
 };
 
 class test_tcp_socket_handler : public lux::net::base::tcp_socket_handler
@@ -168,6 +180,25 @@ std::string create_http_request(const std::string& method,
     return request;
 }
 
+std::string create_file_contents(std::size_t size)
+{
+    std::string contents(size, '\0');
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        contents[i] = static_cast<char>('a' + i % 26);
+    }
+    return contents;
+}
+
+std::filesystem::path create_static_root(const std::string& contents)
+{
+    const auto root = std::filesystem::temp_directory_path() / "lux_http_server_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root);
+    std::ofstream{root / "file.bin", std::ios::binary} << contents;
+    return root;
+}
+
 std::vector<std::byte> to_bytes(const std::string& str)
 {
     std::vector<std::byte> result;
@@ -308,6 +339,56 @@ LUX_TEST_CASE("http_server", "handles GET request successfully", "[io][net][http
     server.stop();
 }
 
+LUX_TEST_CASE("http_server", "closes connection when request times out", "[io][net][http][server]")
+{
+    boost::asio::io_context io_context;
+    lux::net::socket_factory socket_factory{io_context.get_executor()};
+    test_http_server_handler handler;
+
+    auto config = create_default_http_server_config();
+    config.idle_timeout = std::chrono::milliseconds{100};
+    config.header_read_timeout = std::chrono::milliseconds{100};
+    lux::net::http_server server{config, handler, socket_factory};
+
+    const auto serve_error = server.serve(lux::net::base::endpoint{lux::net::base::localhost, 0});
+    REQUIRE_FALSE(serve_error);
+
+    test_tcp_socket_handler client_handler;
+    client_handler.on_connected_callback = [&] { io_context.stop(); };
+
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
+    const auto socket_config = create_default_tcp_socket_config();
+    lux::net::tcp_socket client_socket{io_context.get_executor(), client_handler, socket_config, timer_factory};
+
+    REQUIRE(server.local_endpoint().has_value());
+    const auto connect_error = client_socket.connect(server.local_endpoint().value());
+    CHECK_FALSE(connect_error);
+
+    io_context.run_for(std::chrono::milliseconds{50});
+    REQUIRE(client_handler.connected_calls == 1);
+
+    client_handler.on_disconnected_callback = [&] { io_context.stop(); };
+
+    SECTION("Idle connection without any request")
+    {
+    }
+
+    SECTION("Incomplete request header")
+    {
+        const auto request_bytes = to_bytes("GET /test HTTP/1.1\r\nHost: localhost\r\n");
+        const auto send_error = client_socket.send(std::span{request_bytes});
+        CHECK_FALSE(send_error);
+    }
+
+    io_context.restart();
+    io_context.run_for(std::chrono::milliseconds{1000});
+
+    CHECK(client_handler.disconnected_calls >= 1);
+    CHECK(handler.request_calls == 0);
+
+    server.stop();
+}
+
 LUX_TEST_CASE("http_server", "handles POST request with body successfully", "[io][net][http][server]")
 {
     boost::asio::io_context io_context;
@@ -646,6 +727,147 @@ LUX_TEST_CASE("http_server", "handles different HTTP methods", "[io][net][http][
     server.stop();
 }
 
+LUX_TEST_CASE("http_server", "sends file bodies", "[io][net][http][server]")
+{
+    boost::asio::io_context io_context;
+    lux::net::socket_factory socket_factory{io_context.get_executor()};
+    test_http_server_handler handler;
+
+    const auto contents = create_file_contents(300 * 1024);
+    const auto root = create_static_root(contents);
+    LUX_FINALLY({ std::filesystem::remove_all(root); });
+
+    // Files above the cache limit are sent from the open file, the others from memory
+    const auto cache_max_file_size = GENERATE(std::size_t{0}, std::size_t{1024 * 1024});
+    lux::net::static_file_handler file_handler{
+        lux::net::static_file_handler_config{.root = root, .cache_max_file_size = cache_max_file_size}};
+
+    handler.handle_request_callback = [&](const lux::net::base::http_request& request) {
+        lux::net::base::http_response response;
+        file_handler.serve(request, "file.bin", response);
+        return response;
+    };
+    handler.may_block_callback = [](const auto&) { return true; };
+
+    const auto config = create_default_http_server_config();
+    lux::net::http_server server{config, handler, socket_factory};
+
+    const auto serve_error = server.serve(lux::net::base::endpoint{lux::net::base::localhost, 0});
+    REQUIRE_FALSE(serve_error);
+
+    test_tcp_socket_handler client_handler;
+    client_handler.on_connected_callback = [&] { io_context.stop(); };
+    client_handler.on_data_read_callback = [&](const std::span<const std::byte>& data) {
+        std::ignore = data;
+        if (client_handler.received_data.size() >= contents.size())
+        {
+            const auto response_str = from_bytes(client_handler.received_data);
+            if (response_str.ends_with(contents))
+            {
+                io_context.stop();
+            }
+        }
+    };
+
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
+    const auto socket_config = create_default_tcp_socket_config();
+    lux::net::tcp_socket client_socket{io_context.get_executor(), client_handler, socket_config, timer_factory};
+
+    REQUIRE(server.local_endpoint().has_value());
+    const auto connect_error = client_socket.connect(server.local_endpoint().value());
+    CHECK_FALSE(connect_error);
+
+    io_context.run_for(std::chrono::milliseconds{100});
+
+    const auto request_bytes = to_bytes(create_http_request("GET", "/file.bin"));
+    const auto send_error = client_socket.send(std::span{request_bytes});
+    CHECK_FALSE(send_error);
+
+    io_context.restart();
+    io_context.run_for(std::chrono::seconds{5});
+
+    const auto response_str = from_bytes(client_handler.received_data);
+    CHECK(response_str.starts_with("HTTP/1.1 200 OK"));
+    CHECK(response_str.find("Content-Length: " + std::to_string(contents.size())) != std::string::npos);
+    CHECK(response_str.ends_with("\r\n\r\n" + contents));
+
+    server.stop();
+}
+
+LUX_TEST_CASE("http_server", "sends responses in request order when requests block", "[io][net][http][server]")
+{
+    boost::asio::io_context io_context;
+    lux::net::socket_factory socket_factory{io_context.get_executor()};
+    test_http_server_handler handler;
+
+    std::atomic<std::thread::id> slow_thread;
+    handler.may_block_callback = [](const lux::net::base::http_request& request) { return request.target() == "/slow"; };
+    handler.handle_request_callback = [&](const lux::net::base::http_request& request) {
+        lux::net::base::http_response response;
+        if (request.target() == "/slow")
+        {
+            slow_thread = std::this_thread::get_id();
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        }
+        response.ok(std::string{request.target()});
+        return response;
+    };
+
+    const auto config = create_default_http_server_config();
+    lux::net::http_server server{config, handler, socket_factory};
+
+    const auto serve_error = server.serve(lux::net::base::endpoint{lux::net::base::localhost, 0});
+    REQUIRE_FALSE(serve_error);
+
+    test_tcp_socket_handler client_handler;
+    client_handler.on_connected_callback = [&] { io_context.stop(); };
+    client_handler.on_data_read_callback = [&](const std::span<const std::byte>& data) {
+        std::ignore = data;
+        const auto response_str = from_bytes(client_handler.received_data);
+        if (response_str.ends_with("/fast") && response_str.find("/fast") != response_str.rfind("/fast"))
+        {
+            io_context.stop();
+        }
+    };
+
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
+    const auto socket_config = create_default_tcp_socket_config();
+    lux::net::tcp_socket client_socket{io_context.get_executor(), client_handler, socket_config, timer_factory};
+
+    REQUIRE(server.local_endpoint().has_value());
+    const auto connect_error = client_socket.connect(server.local_endpoint().value());
+    CHECK_FALSE(connect_error);
+
+    io_context.run_for(std::chrono::milliseconds{100});
+
+    // Pipelined in a single write, the fast request is parsed while the slow one is still being handled
+    const auto request_bytes =
+        to_bytes(create_http_request("GET", "/slow") + create_http_request("GET", "/fast") +
+                 create_http_request("GET", "/slow") + create_http_request("GET", "/fast"));
+    const auto send_error = client_socket.send(std::span{request_bytes});
+    CHECK_FALSE(send_error);
+
+    io_context.restart();
+    io_context.run_for(std::chrono::seconds{5});
+
+    const auto response_str = from_bytes(client_handler.received_data);
+    const auto first_slow = response_str.find("/slow");
+    const auto first_fast = response_str.find("/fast");
+    const auto second_slow = response_str.find("/slow", first_slow + 1);
+    const auto second_fast = response_str.find("/fast", first_fast + 1);
+    REQUIRE(second_fast != std::string::npos);
+    CHECK(first_slow < first_fast);
+    CHECK(first_fast < second_slow);
+    CHECK(second_slow < second_fast);
+    CHECK(handler.request_calls == 4);
+
+    // Handled off the thread running the connections
+    CHECK(slow_thread.load() != std::thread::id{});
+    CHECK(slow_thread.load() != std::this_thread::get_id());
+
+    server.stop();
+}
+
 LUX_TEST_CASE("ssl_http_server", "handles HTTPS request successfully", "[io][net][http][server][ssl]")
 {
     boost::asio::io_context io_context;
@@ -713,3 +935,73 @@ LUX_TEST_CASE("ssl_http_server", "handles HTTPS request successfully", "[io][net
     server.stop();
 }
 
+LUX_TEST_CASE("ssl_http_server", "sends file bodies over HTTPS", "[io][net][http][server][ssl]")
+{
+    boost::asio::io_context io_context;
+    lux::net::socket_factory socket_factory{io_context.get_executor()};
+    test_http_server_handler handler;
+    auto server_ssl_context = lux::test::net::create_ssl_server_context();
+
+    const auto contents = create_file_contents(300 * 1024);
+    const auto root = create_static_root(contents);
+    LUX_FINALLY({ std::filesystem::remove_all(root); });
+
+    const auto cache_max_file_size = GENERATE(std::size_t{0}, std::size_t{1024 * 1024});
+    lux::net::static_file_handler file_handler{
+        lux::net::static_file_handler_config{.root = root, .cache_max_file_size = cache_max_file_size}};
+
+    handler.handle_request_callback = [&](const lux::net::base::http_request& request) {
+        lux::net::base::http_response response;
+        file_handler.serve(request, "file.bin", response);
+        return response;
+    };
+    handler.may_block_callback = [](const auto&) { return true; };
+
+    const auto config = create_default_http_server_config();
+    lux::net::http_server server{config, handler, socket_factory, server_ssl_context};
+
+    const auto serve_error = server.serve(lux::net::base::endpoint{lux::net::base::localhost, 0});
+    REQUIRE_FALSE(serve_error);
+
+    test_tcp_socket_handler client_handler;
+    client_handler.on_connected_callback = [&] { io_context.stop(); };
+    client_handler.on_data_read_callback = [&](const std::span<const std::byte>& data) {
+        std::ignore = data;
+        if (client_handler.received_data.size() >= contents.size())
+        {
+            const auto response_str = from_bytes(client_handler.received_data);
+            if (response_str.ends_with(contents))
+            {
+                io_context.stop();
+            }
+        }
+    };
+
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
+    const auto socket_config = create_default_tcp_socket_config();
+    auto client_ssl_context = lux::test::net::create_ssl_client_context();
+    lux::net::ssl_tcp_socket client_socket{io_context.get_executor(),
+                                           client_handler,
+                                           socket_config,
+                                           timer_factory,
+                                           client_ssl_context};
+
+    REQUIRE(server.local_endpoint().has_value());
+    const auto connect_error = client_socket.connect(server.local_endpoint().value());
+    CHECK_FALSE(connect_error);
+
+    io_context.run_for(std::chrono::milliseconds{500});
+
+    const auto request_bytes = to_bytes(create_http_request("GET", "/file.bin"));
+    const auto send_error = client_socket.send(std::span{request_bytes});
+    CHECK_FALSE(send_error);
+
+    io_context.restart();
+    io_context.run_for(std::chrono::seconds{5});
+
+    const auto response_str = from_bytes(client_handler.received_data);
+    CHECK(response_str.starts_with("HTTP/1.1 200 OK"));
+    CHECK(response_str.ends_with("\r\n\r\n" + contents));
+
+    server.stop();
+}
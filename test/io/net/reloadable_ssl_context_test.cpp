@@ -0,0 +1,65 @@
+﻿#include "test_case.hpp"
+#include "io/net/test_utils.hpp"
+
+#include <lux/io/net/reloadable_ssl_context.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <openssl/ssl.h>
+
+#include <string_view>
+
+LUX_TEST_CASE("reloadable_ssl_context", "switches certificate for new handshakes", "[io][net][ssl]")
+{
+    const auto initial = lux::test::net::create_shared_ssl_server_context();
+    const auto reloaded = lux::test::net::create_shared_ssl_server_context();
+
+    lux::net::reloadable_ssl_context ctx{initial};
+    CHECK(ctx.current() == initial);
+
+    SECTION("Handshake uses the initial context")
+    {
+        const auto connection = lux::test::net::ssl_handshake(ctx.context());
+        REQUIRE(connection.established);
+        CHECK(lux::test::net::presents_certificate_of(connection, *initial));
+        CHECK_FALSE(lux::test::net::presents_certificate_of(connection, *reloaded));
+    }
+
+    SECTION("Handshake after reload uses the new context")
+    {
+        ctx.reload(reloaded);
+        CHECK(ctx.current() == reloaded);
+
+        const auto connection = lux::test::net::ssl_handshake(ctx.context());
+        REQUIRE(connection.established);
+        CHECK(lux::test::net::presents_certificate_of(connection, *reloaded));
+    }
+
+    SECTION("Handshake without server name uses the new context")
+    {
+        ctx.reload(reloaded);
+
+        const auto connection = lux::test::net::ssl_handshake(ctx.context(), nullptr);
+        REQUIRE(connection.established);
+        CHECK(lux::test::net::presents_certificate_of(connection, *reloaded));
+    }
+
+    SECTION("Established connection keeps working after its context is released")
+    {
+        auto released = lux::test::net::create_shared_ssl_server_context();
+        ctx.reload(released);
+
+        const auto connection = lux::test::net::ssl_handshake(ctx.context());
+        REQUIRE(connection.established);
+        CHECK(lux::test::net::presents_certificate_of(connection, *released));
+
+        ctx.reload(reloaded);
+        released.reset();
+
+        const char message[]{"ping"};
+        char received[sizeof(message)]{};
+        REQUIRE(SSL_write(connection.client.get(), message, sizeof(message)) == static_cast<int>(sizeof(message)));
+        REQUIRE(SSL_read(connection.server.get(), received, sizeof(received)) == static_cast<int>(sizeof(message)));
+        CHECK(std::string_view{received} == "ping");
+    }
+}
@@ -0,0 +1,133 @@
+﻿#include "test_case.hpp"
+#include "io/net/test_utils.hpp"
+
+#include <lux/io/net/reloadable_ssl_context.hpp>
+#include <lux/io/net/sni_ssl_context.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <memory>
+
+namespace {
+
+lux::net::sni_ssl_context::context_ptr create_entry(const char* common_name)
+{
+    return std::make_shared<lux::net::reloadable_ssl_context>(
+        lux::test::net::create_shared_ssl_server_context(common_name));
+}
+
+} // namespace
+
+LUX_TEST_CASE("sni_ssl_context", "finds context by server name", "[io][net][ssl]")
+{
+    const auto example = create_entry("example.com");
+    const auto wildcard = create_entry("*.example.com");
+    const auto api = create_entry("api.example.com");
+    const auto fallback = create_entry("fallback");
+
+    const lux::string_unordered_map<lux::net::sni_ssl_context::context_ptr> contexts{
+        {"example.com", example},
+        {"*.example.com", wildcard},
+        {"API.Example.com", api},
+    };
+
+    SECTION("Exact host name")
+    {
+        const lux::net::sni_ssl_context ctx{contexts};
+        CHECK(ctx.find("example.com") == example.get());
+        CHECK(ctx.find("api.example.com") == api.get());
+    }
+
+    SECTION("Host names are case-insensitive")
+    {
+        const lux::net::sni_ssl_context ctx{contexts};
+        CHECK(ctx.find("EXAMPLE.com") == example.get());
+        CHECK(ctx.find("Api.Example.Com") == api.get());
+    }
+
+    SECTION("Wildcard matches a single label")
+    {
+        const lux::net::sni_ssl_context ctx{contexts};
+        CHECK(ctx.find("www.example.com") == wildcard.get());
+        CHECK(ctx.find("WWW.example.com") == wildcard.get());
+        CHECK(ctx.find("a.b.example.com") == nullptr);
+        CHECK(ctx.find(".example.com") == nullptr);
+    }
+
+    SECTION("Unknown or missing server name without default")
+    {
+        const lux::net::sni_ssl_context ctx{contexts};
+        CHECK(ctx.find("example.org") == nullptr);
+        CHECK(ctx.find("") == nullptr);
+        CHECK(ctx.find(std::string(300, 'a')) == nullptr);
+    }
+
+    SECTION("Unknown or missing server name with default")
+    {
+        const lux::net::sni_ssl_context ctx{contexts, fallback};
+        CHECK(ctx.find("example.org") == fallback.get());
+        CHECK(ctx.find("") == fallback.get());
+        CHECK(ctx.find("example.com") == example.get());
+    }
+}
+
+LUX_TEST_CASE("sni_ssl_context", "presents certificate of the requested server name", "[io][net][ssl]")
+{
+    const auto example = create_entry("example.com");
+    const auto wildcard = create_entry("*.example.org");
+    const auto fallback = create_entry("fallback");
+
+    const lux::string_unordered_map<lux::net::sni_ssl_context::context_ptr> contexts{
+        {"example.com", example},
+        {"*.example.org", wildcard},
+    };
+
+    SECTION("Handshake uses the matching context")
+    {
+        lux::net::sni_ssl_context ctx{contexts};
+
+        const auto exact = lux::test::net::ssl_handshake(ctx.context(), "example.com");
+        REQUIRE(exact.established);
+        CHECK(lux::test::net::presents_certificate_of(exact, *example->current()));
+
+        const auto matched = lux::test::net::ssl_handshake(ctx.context(), "www.example.org");
+        REQUIRE(matched.established);
+        CHECK(lux::test::net::presents_certificate_of(matched, *wildcard->current()));
+    }
+
+    SECTION("Handshake fails for unknown server name without default")
+    {
+        lux::net::sni_ssl_context ctx{contexts};
+
+        CHECK_FALSE(lux::test::net::ssl_handshake(ctx.context(), "example.net").established);
+        CHECK_FALSE(lux::test::net::ssl_handshake(ctx.context(), nullptr).established);
+    }
+
+    SECTION("Handshake uses the default context for unknown server name")
+    {
+        lux::net::sni_ssl_context ctx{contexts, fallback};
+
+        const auto unknown = lux::test::net::ssl_handshake(ctx.context(), "example.net");
+        REQUIRE(unknown.established);
+        CHECK(lux::test::net::presents_certificate_of(unknown, *fallback->current()));
+
+        const auto missing = lux::test::net::ssl_handshake(ctx.context(), nullptr);
+        REQUIRE(missing.established);
+        CHECK(lux::test::net::presents_certificate_of(missing, *fallback->current()));
+    }
+
+    SECTION("Handshake after reloading an entry uses its new certificate")
+    {
+        lux::net::sni_ssl_context ctx{contexts};
+        const auto reloaded = lux::test::net::create_shared_ssl_server_context("example.com");
+        example->reload(reloaded);
+
+        const auto exact = lux::test::net::ssl_handshake(ctx.context(), "example.com");
+        REQUIRE(exact.established);
+        CHECK(lux::test::net::presents_certificate_of(exact, *reloaded));
+
+        const auto matched = lux::test::net::ssl_handshake(ctx.context(), "www.example.org");
+        REQUIRE(matched.established);
+        CHECK(lux::test::net::presents_certificate_of(matched, *wildcard->current()));
+    }
+}
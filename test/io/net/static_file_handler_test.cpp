@@ -0,0 +1,441 @@
+﻿#include "test_case.hpp"
+
+#include <lux/io/net/static_file_handler.hpp>
+
+#include <lux/io/net/base/file_region.hpp>
+#include <lux/io/net/base/http_method.hpp>
+#include <lux/io/net/base/http_request.hpp>
+#include <lux/io/net/base/http_response.hpp>
+#include <lux/io/net/base/http_status.hpp>
+#include <lux/support/finally.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+std::filesystem::path create_root_directory()
+{
+    const auto root = std::filesystem::temp_directory_path() / "lux_static_file_handler_test";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "docs");
+    return root;
+}
+
+void write_file(const std::filesystem::path& path, std::string_view contents)
+{
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+std::string read_file_body(const lux::net::base::http_response& response)
+{
+    const auto& region = response.file_body();
+    REQUIRE(region.has_value());
+    REQUIRE(region->source != nullptr);
+
+    std::vector<std::byte> buffer(region->size);
+    REQUIRE_FALSE(region->source->read(region->offset, buffer));
+    return std::string{reinterpret_cast<const char*>(buffer.data()), buffer.size()};
+}
+
+lux::net::base::http_response serve(const lux::net::static_file_handler& handler,
+                                    std::string_view path,
+                                    const std::vector<std::pair<std::string, std::string>>& headers = {})
+{
+    lux::net::base::http_request request{lux::net::base::http_method::get, "/" + std::string{path}};
+    for (const auto& [key, value] : headers)
+    {
+        request.set_header(key, value);
+    }
+
+    lux::net::base::http_response response;
+    handler.serve(request, path, response);
+    return response;
+}
+
+} // namespace
+
+LUX_TEST_CASE("static_file_handler", "serves files with validators and content type", "[io][net][http]")
+{
+    const auto root = create_root_directory();
+    LUX_FINALLY({ std::filesystem::remove_all(root); });
+    write_file(root / "hello.txt", "Hello, World!");
+    write_file(root / "docs" / "site.css", "body {}");
+
+    lux::net::static_file_handler handler{lux::net::static_file_handler_config{.root = root}};
+
+    SECTION("Serve a file as a file body")
+    {
+        const auto response = serve(handler, "hello.txt");
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK(response.body().empty());
+        CHECK(read_file_body(response) == "Hello, World!");
+        CHECK(response.header("Content-Type") == "text/plain; charset=utf-8");
+        CHECK(response.header("Accept-Ranges") == "bytes");
+        CHECK_FALSE(response.header("ETag").empty());
+        CHECK(response.header("Last-Modified").ends_with(" GMT"));
+        CHECK_FALSE(response.has_header("Cache-Control"));
+    }
+
+    SECTION("Serve a file from a subdirectory")
+    {
+        const auto response = serve(handler, "docs/site.css");
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK(read_file_body(response) == "body {}");
+        CHECK(response.header("Content-Type") == "text/css; charset=utf-8");
+    }
+
+    SECTION("Serve a percent-encoded path")
+    {
+        write_file(root / "a b.txt", "spaced");
+
+        const auto response = serve(handler, "a%20b.txt");
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK(read_file_body(response) == "spaced");
+    }
+
+    SECTION("Serve the index file of a directory")
+    {
+        write_file(root / "docs" / "index.html", "<html></html>");
+
+        const auto response = serve(handler, "docs");
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK(read_file_body(response) == "<html></html>");
+        CHECK(response.header("Content-Type") == "text/html; charset=utf-8");
+    }
+
+    SECTION("Serve an empty file without a file body")
+    {
+        write_file(root / "empty.bin", "");
+
+        const auto response = serve(handler, "empty.bin");
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK_FALSE(response.file_body().has_value());
+        CHECK(response.header("Content-Type") == "application/octet-stream");
+    }
+
+    SECTION("Set the configured Cache-Control")
+    {
+        lux::net::static_file_handler caching_handler{
+            lux::net::static_file_handler_config{.root = root, .cache_control = "max-age=3600"}};
+
+        const auto response = serve(caching_handler, "hello.txt");
+
+        CHECK(response.header("Cache-Control") == "max-age=3600");
+    }
+}
+
+LUX_TEST_CASE("static_file_handler", "returns 404 for missing files and paths escaping the root", "[io][net][http]")
+{
+    const auto root = create_root_directory();
+    LUX_FINALLY({ std::filesystem::remove_all(root); });
+    write_file(root / "hello.txt", "Hello, World!");
+    write_file(root.parent_path() / "lux_static_file_handler_secret.txt", "secret");
+    LUX_FINALLY({ std::filesystem::remove(root.parent_path() / "lux_static_file_handler_secret.txt"); });
+
+    lux::net::static_file_handler handler{lux::net::static_file_handler_config{.root = root}};
+
+    const auto path = GENERATE(as<std::string>{},
+                               "missing.txt",
+                               "docs",
+                               "../lux_static_file_handler_secret.txt",
+                               "%2e%2e/lux_static_file_handler_secret.txt",
+                               "docs/..%2Flux_static_file_handler_secret.txt",
+                               "docs%2F..%2F..%2Flux_static_file_handler_secret.txt",
+                               "./hello.txt",
+                               "hello.txt%00");
+
+    const auto response = serve(handler, path);
+
+    CHECK(response.status() == lux::net::base::http_status::not_found);
+    CHECK_FALSE(response.file_body().has_value());
+}
+
+// Creating symbolic links requires a privilege on Windows
+#ifndef _WIN32
+LUX_TEST_CASE("static_file_handler", "follows symbolic links only within the root", "[io][net][http]")
+{
+    const auto root = create_root_directory();
+    const auto outside = root.parent_path() / "lux_static_file_handler_outside";
+    LUX_FINALLY({
+        std::filesystem::remove_all(root);
+        std::filesystem::remove_all(outside);
+    });
+    write_file(root / "hello.txt", "Hello, World!");
+    std::filesystem::create_directories(outside);
+    write_file(outside / "secret.txt", "secret");
+
+    std::filesystem::create_symlink(outside / "secret.txt", root / "secret.txt");
+    std::filesystem::create_directory_symlink(outside, root / "outside");
+    std::filesystem::create_symlink(root / "hello.txt", root / "docs" / "hello.txt");
+
+    // Uncached files are opened the same way
+    const auto cache_max_file_size = GENERATE(std::size_t{0}, std::size_t{64 * 1024});
+    lux::net::static_file_handler handler{
+        lux::net::static_file_handler_config{.root = root, .cache_max_file_size = cache_max_file_size}};
+
+    SECTION("Return 404 for a link to a file outside the root")
+    {
+        const auto response = serve(handler, "secret.txt");
+
+        CHECK(response.status() == lux::net::base::http_status::not_found);
+        CHECK_FALSE(response.file_body().has_value());
+    }
+
+    SECTION("Return 404 for files in a linked directory outside the root")
+    {
+        const auto response = serve(handler, "outside/secret.txt");
+
+        CHECK(response.status() == lux::net::base::http_status::not_found);
+        CHECK_FALSE(response.file_body().has_value());
+    }
+
+    SECTION("Serve a link to a file within the root")
+    {
+        const auto response = serve(handler, "docs/hello.txt");
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK(read_file_body(response) == "Hello, World!");
+    }
+}
+#endif
+
+LUX_TEST_CASE("static_file_handler", "answers conditional requests with 304", "[io][net][http]")
+{
+    const auto root = create_root_directory();
+    LUX_FINALLY({ std::filesystem::remove_all(root); });
+    write_file(root / "hello.txt", "Hello, World!");
+
+    lux::net::static_file_handler handler{lux::net::static_file_handler_config{.root = root}};
+
+    const auto first = serve(handler, "hello.txt");
+    const std::string etag{first.header("ETag")};
+    const std::string last_modified{first.header("Last-Modified")};
+
+    SECTION("Return 304 when If-None-Match matches")
+    {
+        const auto response = serve(handler, "hello.txt", {{"If-None-Match", "\"other\", " + etag}});
+
+        CHECK(response.status() == lux::net::base::http_status::not_modified);
+        CHECK_FALSE(response.file_body().has_value());
+        CHECK(response.header("ETag") == etag);
+    }
+
+    SECTION("Return 304 for a weak If-None-Match")
+    {
+        const auto response = serve(handler, "hello.txt", {{"if-none-match", "W/" + etag}});
+
+        CHECK(response.status() == lux::net::base::http_status::not_modified);
+    }
+
+    SECTION("Return 304 when If-Modified-Since is not older than the file")
+    {
+        const auto response = serve(handler, "hello.txt", {{"If-Modified-Since", last_modified}});
+
+        CHECK(response.status() == lux::net::base::http_status::not_modified);
+    }
+
+    SECTION("Serve the file when If-None-Match doesn't match")
+    {
+        const auto response =
+            serve(handler, "hello.txt", {{"If-None-Match", "\"other\""}, {"If-Modified-Since", last_modified}});
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK(read_file_body(response) == "Hello, World!");
+    }
+
+    SECTION("Serve the file when it was modified since")
+    {
+        const auto response = serve(handler, "hello.txt", {{"If-Modified-Since", "Thu, 01 Jan 1970 00:00:00 GMT"}});
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+    }
+#ifndef _WIN32
+    SECTION("Serve the file when it was replaced with the same size and modification time")
+    {
+        write_file(root / "replacement.txt", "Hello, Earth!");
+        std::filesystem::last_write_time(root / "replacement.txt",
+                                         std::filesystem::last_write_time(root / "hello.txt"));
+        std::filesystem::rename(root / "replacement.txt", root / "hello.txt");
+
+        const auto response = serve(handler, "hello.txt", {{"If-None-Match", etag}});
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK(response.header("ETag") != etag);
+        CHECK(response.header("Last-Modified") == last_modified);
+        CHECK(read_file_body(response) == "Hello, Earth!");
+    }
+#endif
+}
+
+LUX_TEST_CASE("static_file_handler", "serves byte ranges", "[io][net][http]")
+{
+    const auto root = create_root_directory();
+    LUX_FINALLY({ std::filesystem::remove_all(root); });
+    write_file(root / "digits.txt", "0123456789");
+
+    lux::net::static_file_handler handler{lux::net::static_file_handler_config{.root = root}};
+
+    SECTION("Serve a closed range")
+    {
+        const auto response = serve(handler, "digits.txt", {{"Range", "bytes=2-5"}});
+
+        CHECK(response.status() == lux::net::base::http_status::partial_content);
+        CHECK(response.header("Content-Range") == "bytes 2-5/10");
+        CHECK(read_file_body(response) == "2345");
+    }
+
+    SECTION("Serve an open-ended range")
+    {
+        const auto response = serve(handler, "digits.txt", {{"Range", "bytes=7-"}});
+
+        CHECK(response.status() == lux::net::base::http_status::partial_content);
+        CHECK(response.header("Content-Range") == "bytes 7-9/10");
+        CHECK(read_file_body(response) == "789");
+    }
+
+    SECTION("Serve a suffix range")
+    {
+        const auto response = serve(handler, "digits.txt", {{"Range", "bytes=-3"}});
+
+        CHECK(response.status() == lux::net::base::http_status::partial_content);
+        CHECK(read_file_body(response) == "789");
+    }
+
+    SECTION("Clamp a range past the end of the file")
+    {
+        const auto response = serve(handler, "digits.txt", {{"Range", "bytes=8-100"}});
+
+        CHECK(response.status() == lux::net::base::http_status::partial_content);
+        CHECK(response.header("Content-Range") == "bytes 8-9/10");
+        CHECK(read_file_body(response) == "89");
+    }
+
+    SECTION("Return 416 for a range starting past the end of the file")
+    {
+        const auto response = serve(handler, "digits.txt", {{"Range", "bytes=10-"}});
+
+        CHECK(response.status() == lux::net::base::http_status::range_not_satisfiable);
+        CHECK(response.header("Content-Range") == "bytes */10");
+        CHECK_FALSE(response.file_body().has_value());
+    }
+
+    SECTION("Serve the whole file for multiple or malformed ranges")
+    {
+        const auto range = GENERATE(as<std::string>{}, "bytes=0-1,4-5", "bytes=5-2", "lines=1-2", "bytes=x-");
+
+        const auto response = serve(handler, "digits.txt", {{"Range", range}});
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK(read_file_body(response) == "0123456789");
+    }
+
+    SECTION("Honor a matching If-Range")
+    {
+        const std::string etag{serve(handler, "digits.txt").header("ETag")};
+
+        const auto response = serve(handler, "digits.txt", {{"Range", "bytes=0-0"}, {"If-Range", etag}});
+
+        CHECK(response.status() == lux::net::base::http_status::partial_content);
+        CHECK(read_file_body(response) == "0");
+    }
+
+    SECTION("Serve the whole file when If-Range doesn't match")
+    {
+        const auto response = serve(handler, "digits.txt", {{"Range", "bytes=0-0"}, {"If-Range", "\"stale\""}});
+
+        CHECK(response.status() == lux::net::base::http_status::ok);
+        CHECK(read_file_body(response) == "0123456789");
+    }
+}
+
+LUX_TEST_CASE("static_file_handler", "caches small files in memory", "[io][net][http]")
+{
+    const auto root = create_root_directory();
+    LUX_FINALLY({ std::filesystem::remove_all(root); });
+    write_file(root / "small.txt", "small");
+    write_file(root / "other.txt", "other");
+    write_file(root / "large.txt", std::string(64, 'x'));
+
+    lux::net::static_file_handler handler{
+        lux::net::static_file_handler_config{.root = root, .cache_max_file_size = 16, .cache_max_size = 10}};
+
+    SECTION("Serve cached files from memory")
+    {
+        const auto first = serve(handler, "small.txt");
+        const auto second = serve(handler, "small.txt");
+
+        REQUIRE(first.file_body().has_value());
+        REQUIRE(second.file_body().has_value());
+        CHECK(first.file_body()->source == second.file_body()->source);
+        CHECK(second.file_body()->source->loaded().size() == 5);
+
+        const auto stats = handler.cache_stats();
+        CHECK(stats.files == 1);
+        CHECK(stats.bytes == 5);
+    }
+
+    SECTION("Don't cache files above the size limit")
+    {
+        const auto response = serve(handler, "large.txt");
+
+        CHECK(read_file_body(response) == std::string(64, 'x'));
+        CHECK(response.file_body()->source->loaded().empty());
+        CHECK(handler.cache_stats().files == 0);
+    }
+
+    SECTION("Evict the least recently used file beyond the cache size")
+    {
+        write_file(root / "third.txt", "third");
+
+        serve(handler, "small.txt");
+        serve(handler, "other.txt");
+        serve(handler, "small.txt");
+        serve(handler, "third.txt");
+
+        const auto stats = handler.cache_stats();
+        CHECK(stats.files == 2);
+        CHECK(stats.bytes == 10);
+
+        const auto first = serve(handler, "small.txt");
+        const auto second = serve(handler, "small.txt");
+        CHECK(first.file_body()->source == second.file_body()->source);
+    }
+
+    SECTION("Reload a cached file after it changes")
+    {
+        const auto before = serve(handler, "small.txt");
+        const auto before_source = before.file_body()->source;
+
+        std::filesystem::remove(root / "small.txt");
+        write_file(root / "small.txt", "changed");
+
+        const auto after = serve(handler, "small.txt");
+
+        CHECK(after.file_body()->source != before_source);
+        CHECK(read_file_body(after) == "changed");
+        CHECK(read_file_body(before) == "small");
+        CHECK(handler.cache_stats().bytes == 7);
+    }
+
+    SECTION("Keep serving a cached file truncated in place")
+    {
+        const auto response = serve(handler, "small.txt");
+        write_file(root / "small.txt", "");
+
+        const auto loaded = response.file_body()->source->loaded();
+        CHECK(std::string{reinterpret_cast<const char*>(loaded.data()), loaded.size()} == "small");
+    }
+}
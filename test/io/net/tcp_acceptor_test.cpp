@@ -117,19 +117,21 @@ std::uint16_t get_available_port(boost::asio::io_context& io_context)
 LUX_TEST_CASE("tcp_acceptor", "constructs successfully with default configuration", "[io][net][tcp][acceptor]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_acceptor_handler handler;
     const auto config = create_default_acceptor_config();
 
     std::optional<lux::net::tcp_acceptor> acceptor;
-    REQUIRE_NOTHROW(acceptor.emplace(io_context.get_executor(), handler, config));
+    REQUIRE_NOTHROW(acceptor.emplace(io_context.get_executor(), handler, config, timer_factory));
 }
 
 LUX_TEST_CASE("tcp_acceptor", "listens on specified endpoint successfully", "[io][net][tcp][acceptor]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_acceptor_handler handler;
     const auto config = create_default_acceptor_config();
-    lux::net::tcp_acceptor acceptor{io_context.get_executor(), handler, config};
+    lux::net::tcp_acceptor acceptor{io_context.get_executor(), handler, config, timer_factory};
 
     const lux::net::base::endpoint endpoint{lux::net::base::localhost, 0};
     const auto listen_error = acceptor.listen(endpoint);
@@ -141,10 +143,11 @@ LUX_TEST_CASE("tcp_acceptor", "listens on specified endpoint successfully", "[io
 LUX_TEST_CASE("tcp_acceptor", "accepts incoming connection successfully", "[io][net][tcp][acceptor]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
 
     test_tcp_acceptor_handler acceptor_handler;
     const auto acceptor_config = create_default_acceptor_config();
-    lux::net::tcp_acceptor acceptor{io_context.get_executor(), acceptor_handler, acceptor_config};
+    lux::net::tcp_acceptor acceptor{io_context.get_executor(), acceptor_handler, acceptor_config, timer_factory};
 
     const lux::net::base::endpoint bind_endpoint{lux::net::base::localhost, 0};
     const auto listen_error = acceptor.listen(bind_endpoint);
@@ -152,7 +155,6 @@ LUX_TEST_CASE("tcp_acceptor", "accepts incoming connection successfully", "[io][
 
     test_tcp_socket_handler socket_handler;
     socket_handler.on_connected_callback = [&]() { io_context.stop(); };
-    lux::time::timer_factory timer_factory{io_context.get_executor()};
     const auto socket_config = create_default_socket_config();
     lux::net::tcp_socket client_socket{io_context.get_executor(), socket_handler, socket_config, timer_factory};
 
@@ -193,21 +195,23 @@ LUX_TEST_CASE("tcp_acceptor", "accepts incoming connection successfully", "[io][
 LUX_TEST_CASE("ssl_tcp_acceptor", "constructs successfully with SSL context", "[io][net][tcp][acceptor][ssl]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_acceptor_handler handler;
     const auto config = create_default_acceptor_config();
     auto ssl_context = lux::test::net::create_ssl_server_context();
 
     std::optional<lux::net::ssl_tcp_acceptor> acceptor;
-    REQUIRE_NOTHROW(acceptor.emplace(io_context.get_executor(), handler, config, ssl_context));
+    REQUIRE_NOTHROW(acceptor.emplace(io_context.get_executor(), handler, config, timer_factory, ssl_context));
 }
 
 LUX_TEST_CASE("ssl_tcp_acceptor", "listens on endpoint successfully", "[io][net][tcp][acceptor][ssl]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_acceptor_handler handler;
     const auto config = create_default_acceptor_config();
     auto ssl_context = lux::test::net::create_ssl_server_context();
-    lux::net::ssl_tcp_acceptor acceptor{io_context.get_executor(), handler, config, ssl_context};
+    lux::net::ssl_tcp_acceptor acceptor{io_context.get_executor(), handler, config, timer_factory, ssl_context};
 
     const auto port = get_available_port(io_context);
     const lux::net::base::endpoint endpoint{lux::net::base::localhost, port};
@@ -220,6 +224,7 @@ LUX_TEST_CASE("ssl_tcp_acceptor", "listens on endpoint successfully", "[io][net]
 LUX_TEST_CASE("ssl_tcp_acceptor", "accepts incoming SSL connection successfully", "[io][net][tcp][acceptor][ssl]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
 
     test_tcp_acceptor_handler acceptor_handler;
     const auto acceptor_config = create_default_acceptor_config();
@@ -227,6 +232,7 @@ LUX_TEST_CASE("ssl_tcp_acceptor", "accepts incoming SSL connection successfully"
     lux::net::ssl_tcp_acceptor acceptor{io_context.get_executor(),
                                         acceptor_handler,
                                         acceptor_config,
+                                        timer_factory,
                                         server_ssl_context};
 
     const lux::net::base::endpoint bind_endpoint{lux::net::base::localhost, 0};
@@ -244,7 +250,6 @@ LUX_TEST_CASE("ssl_tcp_acceptor", "accepts incoming SSL connection successfully"
 
     acceptor_handler.on_accepted_callback = [&]() { connection_accepted = true; };
 
-    lux::time::timer_factory timer_factory{io_context.get_executor()};
     const auto socket_config = create_default_socket_config();
     auto client_ssl_context = lux::test::net::create_ssl_client_context();
     lux::net::ssl_tcp_socket client_socket{io_context.get_executor(),
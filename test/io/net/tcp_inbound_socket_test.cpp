@@ -6,6 +6,7 @@
 #include <lux/io/net/tcp_inbound_socket.hpp>
 #include <lux/io/net/base/endpoint.hpp>
 #include <lux/io/net/base/address_v4.hpp>
+#include <lux/io/time/timer_factory.hpp>
 
 #include <catch2/catch_all.hpp>
 
@@ -17,6 +18,8 @@
 #include <vector>
 #include <chrono>
 #include <functional>
+#include <optional>
+#include <string>
 #include <utility>
 
 namespace {
@@ -74,6 +77,7 @@ lux::net::base::tcp_inbound_socket_config create_default_config()
 LUX_TEST_CASE("tcp_inbound_socket", "constructs successfully from accepted socket", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -99,7 +103,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "constructs successfully from accepted socke
     REQUIRE(accepted);
 
     std::optional<lux::net::tcp_inbound_socket> inbound_socket;
-    REQUIRE_NOTHROW(inbound_socket.emplace(lux::move(accepted_socket), config));
+    REQUIRE_NOTHROW(inbound_socket.emplace(lux::move(accepted_socket), config, timer_factory));
     inbound_socket->set_handler(handler);
 
     CHECK(inbound_socket->is_connected());
@@ -114,6 +118,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "constructs successfully from accepted socke
 LUX_TEST_CASE("tcp_inbound_socket", "succeeds when disconnecting while connected", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -137,7 +142,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "succeeds when disconnecting while connected
     io_context.run_for(std::chrono::milliseconds{100});
     REQUIRE(accepted);
 
-    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config};
+    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config, timer_factory};
     inbound_socket.set_handler(handler);
 
     CHECK(inbound_socket.is_connected());
@@ -158,6 +163,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "succeeds when disconnecting while connected
 LUX_TEST_CASE("tcp_inbound_socket", "returns error when sending data while disconnected", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -181,7 +187,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "returns error when sending data while disco
     io_context.run_for(std::chrono::milliseconds{200});
     REQUIRE(accepted);
 
-    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config};
+    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config, timer_factory};
     inbound_socket.set_handler(handler);
 
     // Disconnect first
@@ -202,6 +208,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "returns error when sending data while disco
 LUX_TEST_CASE("tcp_inbound_socket", "sends and receives data with client", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -226,7 +233,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "sends and receives data with client", "[io]
     io_context.run_for(std::chrono::milliseconds{200});
     REQUIRE(accepted);
 
-    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config};
+    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config, timer_factory};
     inbound_socket.set_handler(handler);
 
     bool data_sent = false;
@@ -296,6 +303,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "sends and receives data with client", "[io]
 LUX_TEST_CASE("tcp_inbound_socket", "queues multiple send operations correctly", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -319,7 +327,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "queues multiple send operations correctly",
     io_context.run_for(std::chrono::milliseconds{200});
     REQUIRE(accepted);
 
-    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config};
+    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config, timer_factory};
     inbound_socket.set_handler(handler);
 
     int send_count = 0;
@@ -355,6 +363,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "queues multiple send operations correctly",
 LUX_TEST_CASE("tcp_inbound_socket", "sends pending data when disconnecting gracefully", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -378,7 +387,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "sends pending data when disconnecting grace
     io_context.run_for(std::chrono::milliseconds{200});
     REQUIRE(accepted);
 
-    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config};
+    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config, timer_factory};
     inbound_socket.set_handler(handler);
 
     bool data_sent = false;
@@ -410,6 +419,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "sends pending data when disconnecting grace
 LUX_TEST_CASE("tcp_inbound_socket", "discards pending data when disconnecting immediately", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -433,7 +443,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "discards pending data when disconnecting im
     io_context.run_for(std::chrono::milliseconds{200});
     REQUIRE(accepted);
 
-    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config};
+    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config, timer_factory};
     inbound_socket.set_handler(handler);
 
     bool data_sent = false;
@@ -465,6 +475,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "discards pending data when disconnecting im
 LUX_TEST_CASE("tcp_inbound_socket", "invokes callback when remote peer disconnects", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -488,7 +499,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "invokes callback when remote peer disconnec
     io_context.run_for(std::chrono::milliseconds{200});
     REQUIRE(accepted);
 
-    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config};
+    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config, timer_factory};
     inbound_socket.set_handler(handler);
 
     bool disconnected = false;
@@ -513,9 +524,91 @@ LUX_TEST_CASE("tcp_inbound_socket", "invokes callback when remote peer disconnec
     acceptor.close();
 }
 
+LUX_TEST_CASE("tcp_inbound_socket", "disconnects with timeout error when idle for too long", "[io][net][tcp]")
+{
+    boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
+    test_tcp_inbound_socket_handler handler;
+    auto config = create_default_config();
+    config.timeout.idle = std::chrono::milliseconds{50};
+
+    boost::asio::ip::tcp::acceptor acceptor{io_context, boost::asio::ip::tcp::endpoint{boost::asio::ip::tcp::v4(), 0}};
+    const auto server_port = acceptor.local_endpoint().port();
+
+    boost::asio::ip::tcp::socket client_socket{io_context};
+    boost::asio::ip::tcp::socket accepted_socket{io_context};
+
+    bool accepted = false;
+    acceptor.async_accept(accepted_socket, [&](const boost::system::error_code& ec) {
+        if (!ec)
+        {
+            accepted = true;
+        }
+    });
+
+    client_socket.async_connect(lux::test::net::make_localhost_endpoint(server_port),
+                                [](const boost::system::error_code&) {});
+
+    io_context.run_for(std::chrono::milliseconds{20});
+    REQUIRE(accepted);
+
+    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config, timer_factory};
+    inbound_socket.set_handler(handler);
+    handler.on_disconnected_callback = [&](const std::error_code&) { io_context.stop(); };
+
+    SECTION("Idle timer is restarted by received data")
+    {
+        inbound_socket.read();
+
+        const std::string message{"ping"};
+        boost::asio::write(client_socket, boost::asio::buffer(message));
+
+        io_context.restart();
+        io_context.run_for(std::chrono::milliseconds{30});
+        REQUIRE(handler.data_read_calls.size() == 1);
+        CHECK(inbound_socket.is_connected());
+    }
+
+    std::optional<std::chrono::steady_clock::time_point> last_activity;
+    SECTION("Timeout counts from the last activity")
+    {
+        handler.on_data_read_callback = [&](const auto&) { last_activity = std::chrono::steady_clock::now(); };
+        inbound_socket.read();
+
+        io_context.restart();
+        io_context.run_for(std::chrono::milliseconds{30});
+
+        const std::string message{"ping"};
+        boost::asio::write(client_socket, boost::asio::buffer(message));
+
+        // Runs past the deadline the timer was armed with on construction
+        io_context.restart();
+        io_context.run_for(std::chrono::milliseconds{30});
+        REQUIRE(handler.data_read_calls.size() == 1);
+        CHECK(inbound_socket.is_connected());
+    }
+
+    io_context.restart();
+    io_context.run_for(std::chrono::milliseconds{1000});
+
+    if (last_activity)
+    {
+        CHECK(std::chrono::steady_clock::now() - *last_activity >= config.timeout.idle);
+    }
+
+    REQUIRE(handler.disconnected_calls.size() == 1);
+    CHECK(handler.disconnected_calls[0] == std::make_error_code(std::errc::timed_out));
+    CHECK_FALSE(inbound_socket.is_connected());
+
+    // Clean up
+    client_socket.close();
+    acceptor.close();
+}
+
 LUX_TEST_CASE("tcp_inbound_socket", "completes full lifecycle of send, receive, disconnect", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -540,7 +633,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "completes full lifecycle of send, receive,
     io_context.run_for(std::chrono::milliseconds{200});
     REQUIRE(accepted);
 
-    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config};
+    lux::net::tcp_inbound_socket inbound_socket{lux::move(accepted_socket), config, timer_factory};
     inbound_socket.set_handler(handler);
     inbound_socket.read();
 
@@ -623,6 +716,7 @@ LUX_TEST_CASE("tcp_inbound_socket", "completes full lifecycle of send, receive,
 LUX_TEST_CASE("ssl_tcp_inbound_socket", "constructs successfully from SSL stream", "[io][net][tcp][ssl]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -681,7 +775,7 @@ LUX_TEST_CASE("ssl_tcp_inbound_socket", "constructs successfully from SSL stream
     REQUIRE(server_handshake_complete);
 
     std::optional<lux::net::ssl_tcp_inbound_socket> inbound_socket;
-    REQUIRE_NOTHROW(inbound_socket.emplace(lux::move(*server_ssl_stream), config));
+    REQUIRE_NOTHROW(inbound_socket.emplace(lux::move(*server_ssl_stream), config, timer_factory));
     inbound_socket->set_handler(handler);
 
     CHECK(inbound_socket->is_connected());
@@ -700,6 +794,7 @@ LUX_TEST_CASE("ssl_tcp_inbound_socket", "constructs successfully from SSL stream
 LUX_TEST_CASE("ssl_tcp_inbound_socket", "returns error when sending while disconnected", "[io][net][tcp][ssl]")
 {
     boost::asio::io_context io_context;
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
     test_tcp_inbound_socket_handler handler;
     const auto config = create_default_config();
 
@@ -756,7 +851,7 @@ LUX_TEST_CASE("ssl_tcp_inbound_socket", "returns error when sending while discon
     REQUIRE(client_handshake_complete);
     REQUIRE(server_handshake_complete);
 
-    lux::net::ssl_tcp_inbound_socket inbound_socket{lux::move(*server_ssl_stream), config};
+    lux::net::ssl_tcp_inbound_socket inbound_socket{lux::move(*server_ssl_stream), config, timer_factory};
     inbound_socket.set_handler(handler);
 
     // Disconnect first
@@ -5,11 +5,13 @@
 #include <lux/io/net/base/endpoint.hpp>
 #include <lux/io/net/base/address_v4.hpp>
 #include <lux/io/time/timer_factory.hpp>
+#include <lux/utils/chunked_buffer_writer.hpp>
 
 #include <catch2/catch_all.hpp>
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/asio/ssl.hpp>
 
@@ -466,6 +468,65 @@ LUX_TEST_CASE("tcp_socket", "queues multiple send operations correctly", "[io][n
     acceptor.close();
 }
 
+LUX_TEST_CASE("tcp_socket", "sends buffer chains without flattening them", "[io][net][tcp]")
+{
+    boost::asio::io_context io_context;
+    test_tcp_socket_handler handler;
+    const auto config = create_default_config();
+    lux::time::timer_factory timer_factory{io_context.get_executor()};
+    lux::net::tcp_socket socket{io_context.get_executor(), handler, config, timer_factory};
+
+    boost::asio::ip::tcp::acceptor acceptor{io_context, boost::asio::ip::tcp::endpoint{boost::asio::ip::tcp::v4(), 0}};
+    const auto server_port = acceptor.local_endpoint().port();
+    boost::asio::ip::tcp::socket server_socket{io_context};
+
+    lux::chunked_buffer_writer writer{lux::make_growable_memory_arena(2, 4), 4};
+    writer.write_big_endian(std::uint16_t{0x4142}).write("hello world").write_varint(300u);
+    const auto expected = writer.to_vector();
+    REQUIRE(writer.chunks().size() == 4);
+
+    std::error_code send_error;
+    handler.on_connected_callback = [&]() {
+        CHECK(socket.send(lux::buffer_chain{}) == std::make_error_code(std::errc::invalid_argument));
+        send_error = socket.send(writer.release());
+    };
+
+    std::vector<std::byte> received(expected.size());
+    acceptor.async_accept(server_socket, [&](const boost::system::error_code& ec) {
+        REQUIRE_FALSE(ec);
+        boost::asio::async_read(server_socket,
+                                boost::asio::buffer(received),
+                                [&](const boost::system::error_code& read_ec, std::size_t) {
+                                    CHECK_FALSE(read_ec);
+                                    io_context.stop();
+                                });
+    });
+
+    const lux::net::base::endpoint endpoint{lux::net::base::localhost, server_port};
+    CHECK_FALSE(socket.connect(endpoint));
+
+    io_context.run_for(std::chrono::milliseconds{500});
+
+    CHECK_FALSE(send_error);
+    CHECK(received == expected);
+
+    // Every chunk of the chain is reported as sent
+    io_context.restart();
+    io_context.run_for(std::chrono::milliseconds{50});
+    REQUIRE(handler.data_sent_calls.size() == 4);
+
+    std::vector<std::byte> sent;
+    for (const auto& chunk : handler.data_sent_calls)
+    {
+        sent.insert(sent.end(), chunk.begin(), chunk.end());
+    }
+    CHECK(sent == expected);
+
+    socket.disconnect(false);
+    server_socket.close();
+    acceptor.close();
+}
+
 LUX_TEST_CASE("tcp_socket", "sends pending data when disconnecting gracefully", "[io][net][tcp]")
 {
     boost::asio::io_context io_context;
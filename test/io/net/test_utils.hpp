@@ -8,6 +8,7 @@
 #include <catch2/catch_all.hpp>
 
 #include <cstdint>
+#include <memory>
 
 namespace lux::test::net {
 
@@ -84,4 +85,90 @@ inline boost::asio::ssl::context create_ssl_server_context()
     return ctx;
 }
 
+/**
+ * Creates a server context with a fresh self-signed P-256 certificate for the common name.
+ */
+inline std::shared_ptr<boost::asio::ssl::context>
+    create_shared_ssl_server_context(const char* common_name = "localhost")
+{
+    std::unique_ptr<EVP_PKEY, decltype(&EVP_PKEY_free)> pkey{EVP_EC_gen("P-256"), &EVP_PKEY_free};
+    std::unique_ptr<X509, decltype(&X509_free)> x509{X509_new(), &X509_free};
+    REQUIRE(pkey);
+    REQUIRE(x509);
+
+    X509_gmtime_adj(X509_getm_notBefore(x509.get()), 0);
+    X509_gmtime_adj(X509_getm_notAfter(x509.get()), 3600);
+    X509_set_pubkey(x509.get(), pkey.get());
+    X509_NAME_add_entry_by_txt(X509_get_subject_name(x509.get()),
+                               "CN",
+                               MBSTRING_ASC,
+                               reinterpret_cast<const unsigned char*>(common_name),
+                               -1,
+                               -1,
+                               0);
+    X509_set_issuer_name(x509.get(), X509_get_subject_name(x509.get()));
+    REQUIRE(X509_sign(x509.get(), pkey.get(), EVP_sha256()));
+
+    auto ctx = std::make_shared<boost::asio::ssl::context>(boost::asio::ssl::context::tls_server);
+    REQUIRE(SSL_CTX_use_certificate(ctx->native_handle(), x509.get()) == 1);
+    REQUIRE(SSL_CTX_use_PrivateKey(ctx->native_handle(), pkey.get()) == 1);
+    return ctx;
+}
+
+using ssl_ptr = std::unique_ptr<SSL, decltype(&SSL_free)>;
+
+struct ssl_connection
+{
+    ssl_ptr client{nullptr, &SSL_free};
+    ssl_ptr server{nullptr, &SSL_free};
+    bool established{false};
+};
+
+/**
+ * Runs a TLS handshake with the server context over an in-memory BIO pair, without verifying the server.
+ * No server name is sent if server_name is null.
+ */
+inline ssl_connection ssl_handshake(boost::asio::ssl::context& server_ctx, const char* server_name = "localhost")
+{
+    static boost::asio::ssl::context client_ctx{boost::asio::ssl::context::tls_client};
+
+    ssl_connection connection;
+    connection.server.reset(SSL_new(server_ctx.native_handle()));
+    connection.client.reset(SSL_new(client_ctx.native_handle()));
+    REQUIRE(connection.server);
+    REQUIRE(connection.client);
+
+    BIO* server_bio{nullptr};
+    BIO* client_bio{nullptr};
+    REQUIRE(BIO_new_bio_pair(&server_bio, 0, &client_bio, 0) == 1);
+    SSL_set_bio(connection.server.get(), server_bio, server_bio);
+    SSL_set_bio(connection.client.get(), client_bio, client_bio);
+    SSL_set_accept_state(connection.server.get());
+    SSL_set_connect_state(connection.client.get());
+    if (server_name)
+    {
+        REQUIRE(SSL_set_tlsext_host_name(connection.client.get(), server_name) == 1);
+    }
+
+    bool server_done{false};
+    bool client_done{false};
+    for (int round = 0; round < 16 && !(server_done && client_done); ++round)
+    {
+        client_done = client_done || SSL_do_handshake(connection.client.get()) == 1;
+        server_done = server_done || SSL_do_handshake(connection.server.get()) == 1;
+    }
+
+    connection.established = server_done && client_done;
+    return connection;
+}
+
+/**
+ * Checks whether the server presented the certificate of the context.
+ */
+inline bool presents_certificate_of(const ssl_connection& connection, boost::asio::ssl::context& ctx)
+{
+    const X509* peer{SSL_get0_peer_certificate(connection.client.get())};
+    return peer && X509_cmp(peer, SSL_CTX_get0_certificate(ctx.native_handle())) == 0;
+}
+
 } // namespace lux::test::net
@@ -16,7 +16,7 @@ public:
     {
     }
 
-    void on_process_exit(int /*exit_code*/) override
+    void on_process_exit(int /*exit_code*/, const lux::proc::base::process_usage& /*usage*/) override
     {
     }
 
@@ -27,6 +27,10 @@ public:
     void on_process_stderr(std::string_view /*err*/) override
     {
     }
+
+    void on_process_stdin_written(std::span<const std::byte> /*data*/) override
+    {
+    }
 };
 
 } // namespace
@@ -0,0 +1,277 @@
+#include "test_case.hpp"
+
+#include <lux/io/proc/base/process_factory.hpp>
+#include <lux/io/proc/process_factory.hpp>
+#include <lux/io/proc/process_pool.hpp>
+#include <lux/io/time/timer_factory.hpp>
+
+#include <boost/asio/io_context.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace {
+
+#ifdef _WIN32
+constexpr const char* test_helper_path = "process-test-helper.exe";
+#else
+constexpr const char* test_helper_path = "process-test-helper";
+#endif
+
+std::vector<std::byte> to_bytes(std::string_view str)
+{
+    const auto* data = reinterpret_cast<const std::byte*>(str.data());
+    return std::vector<std::byte>{data, data + str.size()};
+}
+
+std::string from_bytes(const std::vector<std::byte>& bytes)
+{
+    return std::string{reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
+lux::proc::process_pool_config create_pool_config(std::size_t size)
+{
+    lux::proc::process_pool_config config{};
+    config.size = size;
+    config.args = {"worker"};
+    config.restart_policy.strategy = lux::time::base::retry_policy::backoff_strategy::fixed_delay;
+    config.restart_policy.base_delay = std::chrono::milliseconds{10};
+    return config;
+}
+
+// Spawns the helper until it is broken, then only tries a missing executable, counting every attempt
+class breaking_process_factory : public lux::proc::base::process_factory
+{
+public:
+    explicit breaking_process_factory(lux::proc::process_factory& factory) : factory_{factory}
+    {
+    }
+
+    lux::proc::base::process_ptr create_process(const std::string& executable_path,
+                                                lux::proc::base::process_handler& handler) override
+    {
+        return create_process(executable_path, {}, handler);
+    }
+
+    lux::proc::base::process_ptr create_process(const std::string& executable_path,
+                                                const lux::proc::base::process_config& config,
+                                                lux::proc::base::process_handler& handler) override
+    {
+        ++created;
+        return factory_.create_process(broken ? "non-existent-executable" : executable_path, config, handler);
+    }
+
+public:
+    bool broken{false};
+    std::size_t created{0};
+
+private:
+    lux::proc::process_factory& factory_;
+};
+
+void run_io_context_until(boost::asio::io_context& io_ctx, auto predicate, std::chrono::milliseconds timeout)
+{
+    const auto start = std::chrono::steady_clock::now();
+    while (!predicate())
+    {
+        io_ctx.poll_one();
+        if (std::chrono::steady_clock::now() - start > timeout)
+        {
+            break;
+        }
+    }
+}
+
+} // namespace
+
+LUX_TEST_CASE("process_pool", "dispatches jobs to warm workers", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    lux::time::timer_factory timer_factory{io_ctx.get_executor()};
+    lux::proc::process_factory process_factory{io_ctx.get_executor()};
+
+    SECTION("Jobs are queued and served by the same worker process")
+    {
+        lux::proc::process_pool pool{timer_factory, process_factory, test_helper_path, create_pool_config(1)};
+        REQUIRE(pool.start());
+        CHECK(pool.running_worker_count() == 1);
+
+        std::vector<std::string> responses;
+        for (const auto* payload : {"a", "b", "c"})
+        {
+            CHECK_FALSE(pool.submit(to_bytes(payload), [&](lux::proc::process_pool::job_result result) {
+                REQUIRE(result.has_value());
+                responses.push_back(from_bytes(*result));
+            }));
+        }
+
+        CHECK(pool.queued_job_count() == 2);
+
+        run_io_context_until(io_ctx, [&] { return responses.size() == 3; }, std::chrono::seconds{5});
+
+        // The request counter of the worker shows that it was not respawned between the jobs
+        CHECK(responses == std::vector<std::string>{"a#1", "b#2", "c#3"});
+        CHECK(pool.queued_job_count() == 0);
+        CHECK(pool.idle_worker_count() == 1);
+    }
+
+    SECTION("Jobs are spread over idle workers")
+    {
+        lux::proc::process_pool pool{timer_factory, process_factory, test_helper_path, create_pool_config(2)};
+        REQUIRE(pool.start());
+
+        std::vector<std::string> responses;
+        for (const auto* payload : {"a", "b"})
+        {
+            CHECK_FALSE(pool.submit(to_bytes(payload), [&](lux::proc::process_pool::job_result result) {
+                REQUIRE(result.has_value());
+                responses.push_back(from_bytes(*result));
+            }));
+        }
+
+        CHECK(pool.queued_job_count() == 0);
+        CHECK(pool.idle_worker_count() == 0);
+
+        run_io_context_until(io_ctx, [&] { return responses.size() == 2; }, std::chrono::seconds{5});
+
+        CHECK_THAT(responses, Catch::Matchers::UnorderedEquals(std::vector<std::string>{"a#1", "b#1"}));
+    }
+}
+
+LUX_TEST_CASE("process_pool", "restarts crashed workers", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    lux::time::timer_factory timer_factory{io_ctx.get_executor()};
+    lux::proc::process_factory process_factory{io_ctx.get_executor()};
+
+    lux::proc::process_pool pool{timer_factory, process_factory, test_helper_path, create_pool_config(1)};
+    REQUIRE(pool.start());
+
+    std::vector<lux::proc::process_pool::job_result> results;
+    const auto collect = [&](lux::proc::process_pool::job_result result) { results.push_back(result); };
+
+    CHECK_FALSE(pool.submit(to_bytes("crash"), collect));
+    CHECK_FALSE(pool.submit(to_bytes("next"), collect));
+
+    run_io_context_until(io_ctx, [&] { return results.size() == 2; }, std::chrono::seconds{5});
+
+    REQUIRE(results.size() == 2);
+    REQUIRE_FALSE(results[0].has_value());
+    CHECK(results[0].error() == std::make_error_code(std::errc::io_error));
+
+    // The queued job was served by a fresh worker
+    REQUIRE(results[1].has_value());
+    CHECK(from_bytes(*results[1]) == "next#1");
+    CHECK(pool.running_worker_count() == 1);
+}
+
+LUX_TEST_CASE("process_pool", "completes the job a worker answers right before exiting", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    lux::time::timer_factory timer_factory{io_ctx.get_executor()};
+    lux::proc::process_factory process_factory{io_ctx.get_executor()};
+    breaking_process_factory counting_factory{process_factory};
+
+    lux::proc::process_pool pool{timer_factory, counting_factory, test_helper_path, create_pool_config(1)};
+    REQUIRE(pool.start());
+
+    std::vector<lux::proc::process_pool::job_result> results;
+    CHECK_FALSE(pool.submit(to_bytes("last"), [&](lux::proc::process_pool::job_result result) {
+        results.push_back(result);
+    }));
+
+    // The worker answers and exits right away, then it is restarted
+    run_io_context_until(
+        io_ctx, [&] { return counting_factory.created == 2 && pool.idle_worker_count() == 1; },
+        std::chrono::seconds{5});
+
+    REQUIRE(results.size() == 1);
+    REQUIRE(results[0].has_value());
+    CHECK(from_bytes(*results[0]) == "last#1");
+    CHECK(counting_factory.created == 2);
+}
+
+LUX_TEST_CASE("process_pool", "fails jobs when stopped or not started", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    lux::time::timer_factory timer_factory{io_ctx.get_executor()};
+    lux::proc::process_factory process_factory{io_ctx.get_executor()};
+
+    lux::proc::process_pool pool{timer_factory, process_factory, test_helper_path, create_pool_config(1)};
+
+    SECTION("Submitting to a pool that is not started fails")
+    {
+        CHECK(pool.submit(to_bytes("a"), [](auto) {}) == std::make_error_code(std::errc::no_such_process));
+    }
+
+    SECTION("Stopping the pool cancels running and queued jobs")
+    {
+        REQUIRE(pool.start());
+
+        std::vector<lux::proc::process_pool::job_result> results;
+        const auto collect = [&](lux::proc::process_pool::job_result result) { results.push_back(result); };
+
+        CHECK_FALSE(pool.submit(to_bytes("a"), collect));
+        CHECK_FALSE(pool.submit(to_bytes("b"), collect));
+
+        pool.stop();
+
+        REQUIRE(results.size() == 2);
+        for (const auto& result : results)
+        {
+            REQUIRE_FALSE(result.has_value());
+            CHECK(result.error() == std::make_error_code(std::errc::operation_canceled));
+        }
+        CHECK(pool.running_worker_count() == 0);
+    }
+
+    SECTION("Starting fails when the worker executable doesn't exist")
+    {
+        lux::proc::process_pool missing_pool{timer_factory, process_factory, "non-existent-executable", {}};
+        CHECK_FALSE(missing_pool.start());
+        CHECK(missing_pool.running_worker_count() == 0);
+    }
+}
+
+LUX_TEST_CASE("process_pool", "fails queued jobs once every worker is lost", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    lux::time::timer_factory timer_factory{io_ctx.get_executor()};
+    lux::proc::process_factory process_factory{io_ctx.get_executor()};
+    breaking_process_factory breaking_factory{process_factory};
+
+    auto config = create_pool_config(1);
+    config.restart_policy.base_delay = std::chrono::milliseconds{1};
+    config.restart_policy.max_attempts = 3;
+
+    lux::proc::process_pool pool{timer_factory, breaking_factory, test_helper_path, config};
+    REQUIRE(pool.start());
+    breaking_factory.broken = true;
+    breaking_factory.created = 0;
+
+    std::vector<lux::proc::process_pool::job_result> results;
+    const auto collect = [&](lux::proc::process_pool::job_result result) { results.push_back(result); };
+
+    CHECK_FALSE(pool.submit(to_bytes("crash"), collect));
+    CHECK_FALSE(pool.submit(to_bytes("next"), collect));
+
+    run_io_context_until(io_ctx, [&] { return results.size() == 2; }, std::chrono::seconds{5});
+
+    REQUIRE(results.size() == 2);
+    REQUIRE_FALSE(results[0].has_value());
+    CHECK(results[0].error() == std::make_error_code(std::errc::io_error));
+    REQUIRE_FALSE(results[1].has_value());
+    CHECK(results[1].error() == std::make_error_code(std::errc::no_such_process));
+
+    // No restart is attempted beyond the policy
+    run_io_context_until(io_ctx, [] { return false; }, std::chrono::milliseconds{50});
+    CHECK(breaking_factory.created == 3);
+    CHECK(pool.running_worker_count() == 0);
+    CHECK(pool.submit(to_bytes("late"), collect) == std::make_error_code(std::errc::no_such_process));
+}
@@ -7,10 +7,17 @@
 #include <catch2/catch_all.hpp>
 
 #include <chrono>
+#include <cstddef>
+#include <span>
 #include <string>
+#include <system_error>
 #include <vector>
 #include <filesystem>
 
+#if defined(__linux__)
+#include <csignal>
+#endif
+
 namespace {
 
 // Path to the test helper executable (built alongside tests)
@@ -28,9 +35,10 @@ public:
         errors.emplace_back(error_message);
     }
 
-    void on_process_exit(int code) override
+    void on_process_exit(int code, const lux::proc::base::process_usage& process_usage) override
     {
         this->exit_code = code;
+        this->usage = process_usage;
         exit_called = true;
     }
 
@@ -44,13 +52,58 @@ public:
         stderr_data += err;
     }
 
+    void on_process_stdin_written(std::span<const std::byte> data) override
+    {
+        stdin_written.push_back(data.size());
+    }
+
     bool exit_called{false};
     int exit_code{-1};
+    lux::proc::base::process_usage usage{};
     std::string stdout_data;
     std::string stderr_data;
+    std::vector<std::size_t> stdin_written;
     std::vector<std::string> errors;
 };
 
+class line_process_handler : public test_process_handler
+{
+public:
+    void on_process_stdout(std::string_view out) override
+    {
+        stdout_lines.emplace_back(out);
+        if (pause_on_line && process)
+        {
+            process->pause_output(lux::proc::base::output_stream::out);
+        }
+    }
+
+    std::vector<std::string> stdout_lines;
+    bool pause_on_line{false};
+    lux::proc::base::process* process{nullptr};
+};
+
+std::vector<std::byte> to_bytes(std::string_view str)
+{
+    const auto* data = reinterpret_cast<const std::byte*>(str.data());
+    return std::vector<std::byte>{data, data + str.size()};
+}
+
+lux::proc::base::process_config create_stdin_config()
+{
+    lux::proc::base::process_config config{};
+    config.in.enabled = true;
+    return config;
+}
+
+lux::proc::base::process_config create_line_config(std::size_t buffer_size)
+{
+    lux::proc::base::process_config config{};
+    config.out.buffer_size = buffer_size;
+    config.out.framing = lux::proc::base::output_framing::line;
+    return config;
+}
+
 void run_io_context_until(boost::asio::io_context& io_ctx, auto predicate, std::chrono::milliseconds timeout)
 {
     const auto start = std::chrono::steady_clock::now();
@@ -74,7 +127,8 @@ LUX_TEST_CASE("process", "captures stdout from child process", "[io][proc]")
     lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path};
     CHECK(proc.start({"stdout"}));
 
-    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+    run_io_context_until(
+        io_ctx, [&] { return handler.exit_called && handler.stdout_data.size() == 19; }, std::chrono::seconds{5});
 
     REQUIRE(handler.exit_called);
     CHECK(handler.exit_code == 0);
@@ -82,6 +136,33 @@ LUX_TEST_CASE("process", "captures stdout from child process", "[io][proc]")
     CHECK(handler.stderr_data.empty());
 }
 
+LUX_TEST_CASE("process", "reports exit after the last output", "[io][proc]")
+{
+    class ordered_process_handler : public test_process_handler
+    {
+    public:
+        void on_process_exit(int code, const lux::proc::base::process_usage& process_usage) override
+        {
+            output_at_exit = stdout_data + "|" + stderr_data;
+            test_process_handler::on_process_exit(code, process_usage);
+        }
+
+        std::string output_at_exit;
+    };
+
+    boost::asio::io_context io_ctx;
+    ordered_process_handler handler;
+
+    // The child writes to both streams and exits right away, so the exit is usually seen before the output
+    lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path};
+    CHECK(proc.start({"both"}));
+
+    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+
+    REQUIRE(handler.exit_called);
+    CHECK(handler.output_at_exit == "stdout line|stderr line");
+}
+
 LUX_TEST_CASE("process", "captures stderr from child process", "[io][proc]")
 {
     boost::asio::io_context io_ctx;
@@ -90,7 +171,8 @@ LUX_TEST_CASE("process", "captures stderr from child process", "[io][proc]")
     lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path};
     CHECK(proc.start({"stderr"}));
 
-    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+    run_io_context_until(
+        io_ctx, [&] { return handler.exit_called && handler.stderr_data.size() == 19; }, std::chrono::seconds{5});
 
     REQUIRE(handler.exit_called);
     CHECK(handler.exit_code == 0);
@@ -106,7 +188,10 @@ LUX_TEST_CASE("process", "captures both stdout and stderr from child process", "
     lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path};
     CHECK(proc.start({"both"}));
 
-    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+    run_io_context_until(
+        io_ctx,
+        [&] { return handler.exit_called && handler.stdout_data.size() == 11 && handler.stderr_data.size() == 11; },
+        std::chrono::seconds{5});
 
     REQUIRE(handler.exit_called);
     CHECK(handler.exit_code == 0);
@@ -182,3 +267,217 @@ LUX_TEST_CASE("process", "terminates running child process", "[io][proc]")
     CHECK(handler.exit_code != 0); // Terminated process should not have exit code 0
     CHECK_FALSE(proc.is_running());
 }
+
+LUX_TEST_CASE("process", "captures stdout with a small read buffer", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    test_process_handler handler;
+
+    lux::proc::base::process_config config{};
+    config.out.buffer_size = 4;
+
+    lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path, config};
+    CHECK(proc.start({"stdout"}));
+
+    run_io_context_until(
+        io_ctx, [&] { return handler.exit_called && handler.stdout_data.size() == 19; }, std::chrono::seconds{5});
+
+    REQUIRE(handler.exit_called);
+    CHECK(handler.stdout_data == "test stdout message");
+}
+
+LUX_TEST_CASE("process", "delivers stdout line by line", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    line_process_handler handler;
+
+    SECTION("Lines are split on newline and the unterminated last line is delivered at the end")
+    {
+        lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path, create_line_config(1024)};
+        CHECK(proc.start({"lines"}));
+
+        run_io_context_until(io_ctx, [&] { return handler.stdout_lines.size() == 3; }, std::chrono::seconds{5});
+
+        CHECK(handler.stdout_lines == std::vector<std::string>{"first", "second line", "third"});
+    }
+
+    SECTION("Lines longer than the buffer are delivered in parts")
+    {
+        lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path, create_line_config(4)};
+        CHECK(proc.start({"lines"}));
+
+        run_io_context_until(io_ctx, [&] { return handler.stdout_lines.size() == 7; }, std::chrono::seconds{5});
+
+        CHECK(handler.stdout_lines == std::vector<std::string>{"firs", "t", "seco", "nd l", "ine", "thir", "d"});
+    }
+}
+
+LUX_TEST_CASE("process", "pauses and resumes output delivery", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    line_process_handler handler;
+
+    lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path, create_line_config(1024)};
+    handler.process = &proc;
+    handler.pause_on_line = true;
+
+    CHECK(proc.start({"lines"}));
+
+    // The child exits right away, but the exit waits for the output held back by the pause
+    run_io_context_until(io_ctx, [&] { return !proc.is_running(); }, std::chrono::seconds{5});
+    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::milliseconds{100});
+
+    CHECK_FALSE(handler.exit_called);
+    CHECK(handler.stdout_lines == std::vector<std::string>{"first"});
+
+    // Output left in the buffer and in the pipe is delivered after resuming, then the exit
+    handler.pause_on_line = false;
+    proc.resume_output(lux::proc::base::output_stream::out);
+
+    io_ctx.restart();
+    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+
+    REQUIRE(handler.exit_called);
+    CHECK(handler.stdout_lines == std::vector<std::string>{"first", "second line", "third"});
+}
+
+LUX_TEST_CASE("process", "streams data to stdin of child process", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    test_process_handler handler;
+
+    SECTION("Queued data is written in order and the pipe is closed once drained")
+    {
+        lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path, create_stdin_config()};
+        REQUIRE(proc.start({"cat"}));
+
+        const auto hello = to_bytes("hello ");
+        CHECK_FALSE(proc.write_stdin(std::span<const std::byte>{hello}));
+        CHECK_FALSE(proc.write_stdin(to_bytes("world")));
+        CHECK_FALSE(proc.close_stdin(true));
+
+        // Nothing can be queued once closing was requested
+        CHECK(proc.write_stdin(to_bytes("!")) == std::make_error_code(std::errc::broken_pipe));
+
+        run_io_context_until(
+            io_ctx, [&] { return handler.exit_called && handler.stdout_data.size() == 11; }, std::chrono::seconds{5});
+
+        REQUIRE(handler.exit_called);
+        CHECK(handler.exit_code == 0);
+        CHECK(handler.stdout_data == "hello world");
+        CHECK(handler.stdin_written == std::vector<std::size_t>{6, 5});
+        CHECK(handler.errors.empty());
+    }
+
+    SECTION("Closing immediately drops queued data")
+    {
+        lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path, create_stdin_config()};
+        REQUIRE(proc.start({"cat"}));
+
+        // Only one write is in flight at a time, so the second one is still queued
+        CHECK_FALSE(proc.write_stdin(to_bytes("first")));
+        CHECK_FALSE(proc.write_stdin(to_bytes("dropped")));
+        CHECK_FALSE(proc.close_stdin(false));
+
+        run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+        io_ctx.poll();
+
+        REQUIRE(handler.exit_called);
+        CHECK(handler.stdout_data.find("dropped") == std::string::npos);
+        CHECK(handler.stdin_written.empty());
+    }
+
+    SECTION("Writing fails when stdin is not enabled")
+    {
+        lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path};
+        REQUIRE(proc.start({"exit_code", "0"}));
+
+        CHECK(proc.write_stdin(to_bytes("data")) == std::make_error_code(std::errc::operation_not_supported));
+        CHECK(proc.close_stdin(true) == std::make_error_code(std::errc::operation_not_supported));
+
+        run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+    }
+
+    SECTION("Writing empty data fails")
+    {
+        lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path, create_stdin_config()};
+        REQUIRE(proc.start({"cat"}));
+
+        CHECK(proc.write_stdin(std::vector<std::byte>{}) == std::make_error_code(std::errc::invalid_argument));
+        CHECK_FALSE(proc.close_stdin(true));
+
+        run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+        CHECK(handler.exit_called);
+    }
+}
+
+LUX_TEST_CASE("process", "reports exit only after start returns", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    test_process_handler handler;
+
+    lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path};
+    CHECK(proc.start({"exit_code", "0"}));
+    CHECK_FALSE(handler.exit_called);
+
+    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+
+    REQUIRE(handler.exit_called);
+    CHECK(handler.exit_code == 0);
+}
+
+#if defined(__linux__)
+LUX_TEST_CASE("process", "leaves the SIGCHLD disposition untouched", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    test_process_handler handler;
+
+    lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path};
+    CHECK(proc.start({"exit_code", "0"}));
+
+    struct sigaction action{};
+    REQUIRE(::sigaction(SIGCHLD, nullptr, &action) == 0);
+    CHECK(action.sa_handler == SIG_DFL);
+
+    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+
+    REQUIRE(handler.exit_called);
+    CHECK(handler.exit_code == 0);
+}
+#endif
+
+LUX_TEST_CASE("process", "reports resource usage on exit", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    test_process_handler handler;
+
+    lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path};
+    CHECK(proc.start({"spin", "200"}));
+
+    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{5});
+
+    REQUIRE(handler.exit_called);
+    CHECK(handler.exit_code == 0);
+    CHECK(handler.usage.wall_time >= std::chrono::milliseconds{200});
+    CHECK(handler.usage.user_cpu_time + handler.usage.system_cpu_time >= std::chrono::milliseconds{100});
+    CHECK(handler.usage.max_rss > 0);
+}
+
+LUX_TEST_CASE("process", "applies resource limits at spawn", "[io][proc]")
+{
+    boost::asio::io_context io_ctx;
+    test_process_handler handler;
+
+    lux::proc::base::process_config config{};
+    config.limits.cpu_time = std::chrono::seconds{1};
+
+    lux::proc::process proc{io_ctx.get_executor(), handler, test_helper_path, config};
+    CHECK(proc.start({"spin", "10000"}));
+
+    run_io_context_until(io_ctx, [&] { return handler.exit_called; }, std::chrono::seconds{8});
+
+    // The child is stopped by the operating system once it used up its CPU time
+    REQUIRE(handler.exit_called);
+    CHECK(handler.exit_code != 0);
+    CHECK(handler.usage.wall_time < std::chrono::seconds{8});
+}
@@ -1,4 +1,6 @@
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <string>
 
@@ -34,6 +36,67 @@ int main(int argc, char* argv[])
         return 0;
     }
 
+    if (command == "lines")
+    {
+        std::cout << "first\nsecond line\nthird" << std::flush;
+        return 0;
+    }
+
+    if (command == "cat")
+    {
+        std::cout << std::cin.rdbuf() << std::flush;
+        return 0;
+    }
+
+    if (command == "worker")
+    {
+        // Answers each length-prefixed request with "<payload>#<number of requests handled so far>", exits right
+        // after answering "last"
+        std::size_t handled = 0;
+        std::array<unsigned char, 4> header{};
+        while (std::cin.read(reinterpret_cast<char*>(header.data()), header.size()))
+        {
+            const std::uint32_t size = std::uint32_t{header[0]} << 24 | std::uint32_t{header[1]} << 16 |
+                                       std::uint32_t{header[2]} << 8 | std::uint32_t{header[3]};
+            std::string payload(size, '\0');
+            std::cin.read(payload.data(), size);
+
+            if (payload == "crash")
+            {
+                return 3;
+            }
+
+            const auto response = payload + "#" + std::to_string(++handled);
+            const auto response_size = static_cast<std::uint32_t>(response.size());
+            const std::array<char, 4> response_header{static_cast<char>(response_size >> 24),
+                                                      static_cast<char>(response_size >> 16),
+                                                      static_cast<char>(response_size >> 8),
+                                                      static_cast<char>(response_size)};
+            std::cout.write(response_header.data(), response_header.size());
+            std::cout << response << std::flush;
+
+            if (payload == "last")
+            {
+                return 0;
+            }
+        }
+        return 0;
+    }
+
+    if (command == "spin")
+    {
+        // Burns CPU for the given number of milliseconds
+        const std::chrono::milliseconds duration{argc > 2 ? std::stoi(argv[2]) : 100};
+        const auto start = std::chrono::steady_clock::now();
+
+        volatile std::uint64_t counter = 0;
+        while (std::chrono::steady_clock::now() - start < duration)
+        {
+            counter = counter + 1;
+        }
+        return 0;
+    }
+
     if (command == "exit_code")
     {
         if (argc > 2)
@@ -4,157 +4,324 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <boost/asio/any_io_executor.hpp>
 #include <boost/asio/co_spawn.hpp>
-#include <boost/asio/experimental/use_promise.hpp>
 #include <boost/asio/io_context.hpp>
-#include <boost/asio/steady_timer.hpp>
 
 #include <chrono>
 #include <future>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <variant>
+#include <vector>
 
 using namespace std::chrono_literals;
 
-namespace {
-
-constexpr auto use_promise = boost::asio::experimental::use_promise;
-
-} // namespace
-
-LUX_TEST_CASE("promise", "constructs from base_promise and resolves with value", "[io][promise]")
+LUX_TEST_CASE("promise", "resolves future with value", "[io][promise]")
 {
-    boost::asio::io_context io;
-
-    SECTION("Resolves with integer value")
+    SECTION("Continuation attached before the value is set")
     {
-        auto promise = boost::asio::co_spawn(
-            io.get_executor(),
-            []() -> boost::asio::awaitable<int> { co_return 42; },
-            use_promise);
-
-        auto lux_promise = lux::promise<int>{std::move(promise)};
-        CHECK_FALSE(lux_promise.resolved());
+        lux::promise<int> promise;
+        auto future = promise.get_future();
+        CHECK(future.valid());
+        CHECK_FALSE(future.is_ready());
 
         int captured_value{0};
-        lux_promise.then([&](int value) { captured_value = value; });
-
-        io.run();
+        auto next = future.then([&](int value) { captured_value = value; });
+        CHECK_FALSE(future.valid());
+        CHECK(captured_value == 0);
 
+        promise.set_value(42);
         CHECK(captured_value == 42);
+        CHECK(next.is_ready());
     }
 
-    SECTION("Resolves with string value")
+    SECTION("Continuation attached after the value is set runs immediately")
     {
-        auto promise = boost::asio::co_spawn(
-            io.get_executor(),
-            []() -> boost::asio::awaitable<std::string> { co_return std::string{"hello"}; },
-            use_promise);
-
-        auto lux_promise = lux::promise<std::string>{std::move(promise)};
-        CHECK_FALSE(lux_promise.resolved());
+        lux::promise<std::string> promise;
+        auto future = promise.get_future();
+        promise.set_value("hello");
+        CHECK(future.is_ready());
 
         std::string captured_value;
-        lux_promise.then([&](std::string value) { captured_value = std::move(value); });
+        future.then([&](std::string value) { captured_value = value; });
+        CHECK(captured_value == "hello");
+    }
 
-        io.run();
+    SECTION("Get returns value")
+    {
+        auto future = lux::make_ready_future(std::make_unique<int>(7));
+        CHECK(*future.get() == 7);
+        CHECK_FALSE(future.valid());
+    }
 
-        CHECK(captured_value == "hello");
+    SECTION("Get blocks until the value is set from another thread")
+    {
+        lux::promise<int> promise;
+        auto future = promise.get_future();
+
+        std::thread producer{[&promise] {
+            std::this_thread::sleep_for(10ms);
+            promise.set_value(5);
+        }};
+
+        CHECK(future.get() == 5);
+        producer.join();
     }
 
-    SECTION("Resolves asynchronously after delay")
+    SECTION("Void promise")
     {
-        boost::asio::steady_timer timer{io, 10ms};
+        lux::promise<void> promise;
+        auto future = promise.get_future();
 
-        auto promise = boost::asio::co_spawn(
-            io.get_executor(),
-            [&]() -> boost::asio::awaitable<int> {
-                co_await timer.async_wait(boost::asio::use_awaitable);
-                co_return 123;
-            },
-            use_promise);
+        bool called = false;
+        future.then([&] { called = true; });
 
-        auto lux_promise = lux::promise<int>{std::move(promise)};
+        promise.set_value();
+        CHECK(called);
+    }
+}
 
-        int captured_value{0};
-        lux_promise.then([&](int value) { captured_value = value; });
+LUX_TEST_CASE("promise", "propagates exceptions", "[io][promise]")
+{
+    SECTION("Exception skips continuations and is rethrown by get")
+    {
+        lux::promise<int> promise;
+        auto future = promise.get_future();
+
+        bool called = false;
+        auto next = future.then([&](int value) {
+            called = true;
+            return value * 2;
+        });
+
+        promise.set_exception(std::make_exception_ptr(std::runtime_error{"failure"}));
+        CHECK_FALSE(called);
+        CHECK_THROWS_AS(next.get(), std::runtime_error);
+    }
 
-        io.run();
+    SECTION("Exception thrown by continuation is stored in the next future")
+    {
+        auto future = lux::make_ready_future(1).then([](int) -> int { throw std::logic_error{"bad"}; });
+        CHECK_THROWS_AS(future.get(), std::logic_error);
+    }
+
+    SECTION("Destroyed promise breaks the future")
+    {
+        lux::future<int> future;
+        {
+            lux::promise<int> promise;
+            future = promise.get_future();
+        }
+
+        REQUIRE(future.is_ready());
+        try
+        {
+            future.get();
+            FAIL("Expected broken promise");
+        }
+        catch (const std::future_error& e)
+        {
+            CHECK(e.code() == std::future_errc::broken_promise);
+        }
+    }
 
-        CHECK(captured_value == 123);
+    SECTION("Exceptional future")
+    {
+        auto future = lux::make_exceptional_future<void>(std::make_exception_ptr(std::runtime_error{"failure"}));
+        CHECK_THROWS_AS(future.get(), std::runtime_error);
     }
 }
 
-LUX_TEST_CASE("promise", "constructs with ready value and resolves immediately", "[io][promise]")
+LUX_TEST_CASE("promise", "chains continuations", "[io][promise]")
 {
-    SECTION("Constructs with integer")
+    SECTION("Chain transforms values")
     {
-        auto promise = lux::promise<int>{42};
+        auto future = lux::make_ready_future(2)
+                          .then([](int value) { return value * 10; })
+                          .then([](int value) { return std::to_string(value); });
 
-        CHECK(promise.resolved());
-        CHECK(promise.get() == 42);
+        CHECK(future.get() == "20");
     }
 
-    SECTION("Constructs with string")
+    SECTION("Future returned from continuation is flattened")
     {
-        auto promise = lux::promise<std::string>{std::string{"ready"}};
+        lux::promise<int> inner;
+        auto inner_future = inner.get_future();
 
-        CHECK(promise.resolved());
-        CHECK(promise.get() == "ready");
+        auto future = lux::make_ready_future(1).then(
+            [&inner_future](int value) { return inner_future.then([value](int v) { return v + value; }); });
+        CHECK_FALSE(future.is_ready());
+
+        inner.set_value(41);
+        CHECK(future.get() == 42);
     }
 
-    SECTION("Then handler called immediately for ready value")
+    SECTION("Continuation is dispatched to executor")
     {
-        auto promise = lux::promise<int>{99};
+        boost::asio::io_context io;
+        lux::promise<int> promise;
 
         int captured_value{0};
-        promise.then([&](int value) { captured_value = value; });
+        auto next = promise.get_future().then(io.get_executor(), [&](int value) { captured_value = value; });
+
+        promise.set_value(3);
+        CHECK(captured_value == 0);
+        CHECK_FALSE(next.is_ready());
 
-        CHECK(captured_value == 99);
+        io.run();
+        CHECK(captured_value == 3);
+        CHECK(next.is_ready());
     }
-}
 
-LUX_TEST_CASE("promise", "rethrows exception from async operation", "[io][promise]")
-{
-    boost::asio::io_context io;
+    SECTION("Continuation is dispatched to a type-erased executor")
+    {
+        boost::asio::io_context io;
+        const boost::asio::any_io_executor executor{io.get_executor()};
+        lux::promise<int> promise;
 
-    SECTION("Rethrows runtime_error")
+        int captured_value{0};
+        const auto callable = [&captured_value](int value) { captured_value = value; };
+
+        // Mirrors the continuation then() stores, which fits the inline storage of the continuation
+        const auto continuation = [executor,
+                                   state = std::shared_ptr<lux::detail::future_state<int>>{},
+                                   next = lux::promise<int>{},
+                                   f = callable]() mutable {};
+        STATIC_CHECK(lux::detail::future_continuation::fits_inline<std::remove_cvref_t<decltype(continuation)>>);
+
+        auto next = promise.get_future().then(executor, callable);
+
+        promise.set_value(4);
+        io.run();
+        CHECK(captured_value == 4);
+        CHECK(next.is_ready());
+    }
+
+    SECTION("Promise completes co_spawn")
     {
-        auto promise = boost::asio::co_spawn(
-            io.get_executor(),
-            []() -> boost::asio::awaitable<int> {
-                throw std::runtime_error("async error");
-                co_return 0;
-            },
-            use_promise);
+        boost::asio::io_context io;
+        lux::promise<int> promise;
+        auto future = promise.get_future();
 
-        auto lux_promise = lux::promise<int>{std::move(promise)};
-        lux_promise.then([](int) { FAIL("Handler should not be called"); });
+        boost::asio::co_spawn(io, []() -> boost::asio::awaitable<int> { co_return 42; }, lux::move(promise));
 
-        CHECK_THROWS_WITH(io.run(), "async error");
+        io.run();
+        CHECK(future.get() == 42);
     }
 
-    SECTION("Rethrows logic_error")
+    SECTION("Exception from co_spawn is stored in the future")
     {
-        auto promise = boost::asio::co_spawn(
-            io.get_executor(),
-            []() -> boost::asio::awaitable<std::string> {
-                throw std::logic_error("invalid operation");
-                co_return "";
+        boost::asio::io_context io;
+        lux::promise<void> promise;
+        auto future = promise.get_future();
+
+        boost::asio::co_spawn(
+            io,
+            []() -> boost::asio::awaitable<void> {
+                throw std::runtime_error{"failure"};
+                co_return;
             },
-            use_promise);
+            lux::move(promise));
 
-        auto lux_promise = lux::promise<std::string>{std::move(promise)};
-        lux_promise.then([](std::string) { FAIL("Handler should not be called"); });
-
-        CHECK_THROWS_WITH(io.run(), "invalid operation");
+        io.run();
+        CHECK_THROWS_AS(future.get(), std::runtime_error);
     }
 }
 
-LUX_TEST_CASE("promise", "extracts value using get()", "[io][promise]")
+LUX_TEST_CASE("promise", "combines futures", "[io][promise]")
 {
-    SECTION("Gets value from resolved promise immediately")
+    SECTION("When all collects values in order")
+    {
+        std::vector<lux::promise<int>> promises(3);
+        std::vector<lux::future<int>> futures;
+        for (auto& promise : promises)
+        {
+            futures.push_back(promise.get_future());
+        }
+
+        auto all = lux::when_all(lux::move(futures));
+
+        promises[2].set_value(3);
+        promises[0].set_value(1);
+        CHECK_FALSE(all.is_ready());
+
+        promises[1].set_value(2);
+        CHECK(all.get() == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("When all fails on first exception")
+    {
+        lux::promise<void> first;
+        lux::promise<void> second;
+
+        std::vector<lux::future<void>> futures;
+        futures.push_back(first.get_future());
+        futures.push_back(second.get_future());
+
+        auto all = lux::when_all(lux::move(futures));
+
+        second.set_exception(std::make_exception_ptr(std::runtime_error{"failure"}));
+        CHECK(all.is_ready());
+        CHECK_THROWS_AS(all.get(), std::runtime_error);
+
+        first.set_value();
+    }
+
+    SECTION("When all of empty input is ready")
+    {
+        CHECK(lux::when_all(std::vector<lux::future<int>>{}).get().empty());
+    }
+
+    SECTION("When all of different types")
     {
-        auto promise = lux::promise<int>{888};
-        CHECK(promise.get() == 888);
+        lux::promise<std::string> text;
+        auto all = lux::when_all(lux::make_ready_future(1), text.get_future(), lux::make_ready_future());
+        CHECK_FALSE(all.is_ready());
+
+        text.set_value("two");
+        const auto [number, string, nothing] = all.get();
+        CHECK(number == 1);
+        CHECK(string == "two");
+        CHECK(nothing == std::monostate{});
+    }
+
+    SECTION("When any completes with the first value")
+    {
+        std::vector<lux::promise<int>> promises(3);
+        std::vector<lux::future<int>> futures;
+        for (auto& promise : promises)
+        {
+            futures.push_back(promise.get_future());
+        }
+
+        auto any = lux::when_any(lux::move(futures));
+        CHECK_FALSE(any.is_ready());
+
+        promises[1].set_value(20);
+        promises[0].set_value(10);
+
+        const auto result = any.get();
+        CHECK(result.index == 1);
+        CHECK(result.value == 20);
+    }
+
+    SECTION("When any completes with the first exception")
+    {
+        lux::promise<void> first;
+        lux::promise<void> second;
+
+        std::vector<lux::future<void>> futures;
+        futures.push_back(first.get_future());
+        futures.push_back(second.get_future());
+
+        auto any = lux::when_any(lux::move(futures));
+        first.set_exception(std::make_exception_ptr(std::runtime_error{"failure"}));
+        second.set_value();
+
+        CHECK_THROWS_AS(any.get(), std::runtime_error);
     }
 }
@@ -0,0 +1,112 @@
+#include "test_case.hpp"
+
+#include <lux/io/time/retry_budget.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+struct test_clock
+{
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<test_clock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept
+    {
+        return current;
+    }
+
+    static inline time_point current{};
+};
+
+using test_retry_budget = lux::time::basic_token_bucket_retry_budget<test_clock>;
+
+constexpr lux::time::token_bucket_retry_budget_config test_config{.capacity = 3, .refill_interval = 100ms};
+
+} // namespace
+
+LUX_TEST_CASE("token_bucket_retry_budget", "limits retries to bucket capacity and refill rate", "[io][time]")
+{
+    test_clock::current = test_clock::time_point{};
+    test_retry_budget budget{test_config};
+
+    SECTION("Budget should allow a burst of up to capacity retries")
+    {
+        CHECK(budget.available() == 3);
+        CHECK(budget.try_acquire());
+        CHECK(budget.try_acquire());
+        CHECK(budget.try_acquire());
+        CHECK_FALSE(budget.try_acquire());
+        CHECK(budget.available() == 0);
+    }
+
+    SECTION("Budget should refill one token per refill interval")
+    {
+        while (budget.try_acquire())
+        {
+        }
+
+        test_clock::current += 99ms;
+        CHECK_FALSE(budget.try_acquire());
+
+        test_clock::current += 1ms;
+        CHECK(budget.try_acquire());
+        CHECK_FALSE(budget.try_acquire());
+
+        test_clock::current += 250ms;
+        CHECK(budget.available() == 2);
+
+        // Remaining 50ms of the partial interval are kept
+        test_clock::current += 50ms;
+        CHECK(budget.available() == 3);
+    }
+
+    SECTION("Budget should not refill above capacity")
+    {
+        test_clock::current += 10s;
+        CHECK(budget.available() == 3);
+
+        // Time spent with a full bucket doesn't count towards the next refill
+        CHECK(budget.try_acquire());
+        CHECK(budget.available() == 2);
+    }
+}
+
+LUX_TEST_CASE("token_bucket_retry_budget", "is shared safely between threads", "[io][time]")
+{
+    lux::time::token_bucket_retry_budget budget{{.capacity = 1000, .refill_interval = 1h}};
+
+    std::atomic<std::size_t> acquired{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&budget, &acquired] {
+            for (int j = 0; j < 500; ++j)
+            {
+                if (budget.try_acquire())
+                {
+                    ++acquired;
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(acquired == 1000);
+    CHECK(budget.available() == 0);
+}
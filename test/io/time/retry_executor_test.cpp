@@ -8,6 +8,7 @@
 #include <catch2/catch_all.hpp>
 
 #include <chrono>
+#include <set>
 
 using namespace lux::time;
 using namespace lux::time::base;
@@ -217,6 +218,147 @@ LUX_TEST_CASE("retry_executor", "applies exponential backoff between retry attem
     }
 }
 
+LUX_TEST_CASE("retry_executor", "applies jittered backoff between retry attempts", "[io][time]")
+{
+    SECTION("Should keep full jitter delay between one millisecond and exponential delay")
+    {
+        timer_factory_mock factory;
+        auto policy = create_exponential_backoff_policy();
+        policy.strategy = retry_policy::backoff_strategy::full_jitter;
+        policy.base_delay = std::chrono::milliseconds{100};
+        policy.max_delay = std::chrono::milliseconds{1000};
+        policy.max_attempts = std::nullopt;
+        retry_executor executor{factory, policy};
+
+        auto* timer_mock = factory.created_timers_[0];
+
+        std::chrono::milliseconds upper_bound{100};
+        for (int i = 0; i < 20; ++i)
+        {
+            executor.retry();
+            CHECK(timer_mock->scheduled_delay() >= std::chrono::milliseconds{1});
+            CHECK(timer_mock->scheduled_delay() <= upper_bound);
+
+            timer_mock->execute_handler();
+            upper_bound = std::min(upper_bound * 2, policy.max_delay);
+        }
+    }
+
+    SECTION("Should keep decorrelated jitter delay between base delay and three times the previous delay")
+    {
+        timer_factory_mock factory;
+        auto policy = create_exponential_backoff_policy();
+        policy.strategy = retry_policy::backoff_strategy::decorrelated_jitter;
+        policy.base_delay = std::chrono::milliseconds{100};
+        policy.max_delay = std::chrono::milliseconds{1000};
+        policy.max_attempts = std::nullopt;
+        retry_executor executor{factory, policy};
+
+        auto* timer_mock = factory.created_timers_[0];
+
+        auto previous_delay = policy.base_delay;
+        for (int i = 0; i < 20; ++i)
+        {
+            executor.retry();
+            CHECK(timer_mock->scheduled_delay() >= policy.base_delay);
+            CHECK(timer_mock->scheduled_delay() <= std::min(previous_delay * 3, policy.max_delay));
+
+            previous_delay = timer_mock->scheduled_delay();
+            timer_mock->execute_handler();
+        }
+    }
+
+    SECTION("Should not start decorrelated jitter of all clients with the same delay")
+    {
+        auto policy = create_exponential_backoff_policy();
+        policy.strategy = retry_policy::backoff_strategy::decorrelated_jitter;
+        policy.base_delay = std::chrono::milliseconds{100};
+        policy.max_delay = std::chrono::milliseconds{1000};
+
+        std::set<std::chrono::milliseconds> first_delays;
+        for (int i = 0; i < 20; ++i)
+        {
+            timer_factory_mock factory;
+            retry_executor executor{factory, policy};
+            executor.retry();
+            first_delays.insert(factory.created_timers_[0]->scheduled_delay());
+        }
+
+        CHECK(first_delays.size() > 1);
+    }
+}
+
+LUX_TEST_CASE("retry_executor", "draws retry attempts from shared budget", "[io][time]")
+{
+    class test_retry_budget : public retry_budget
+    {
+    public:
+        bool try_acquire() override
+        {
+            ++acquire_calls;
+            return allow;
+        }
+
+        bool allow{true};
+        std::size_t acquire_calls{0};
+    };
+
+    timer_factory_mock factory;
+    auto budget = std::make_shared<test_retry_budget>();
+    auto policy = create_fixed_delay_policy();
+    policy.budget = budget;
+    retry_executor executor{factory, policy};
+
+    auto* timer_mock = factory.created_timers_[0];
+
+    std::size_t retry_call_count = 0;
+    std::size_t exhausted_call_count = 0;
+    executor.set_retry_action([&retry_call_count]() { ++retry_call_count; });
+    executor.set_exhausted_callback([&exhausted_call_count]() { ++exhausted_call_count; });
+
+    SECTION("Should execute action when budget allows the attempt")
+    {
+        executor.retry();
+        timer_mock->execute_handler();
+
+        CHECK(budget->acquire_calls == 1);
+        CHECK(retry_call_count == 1);
+    }
+
+    SECTION("Should skip action and reschedule when budget denies the attempt")
+    {
+        budget->allow = false;
+
+        executor.retry();
+        timer_mock->execute_handler();
+
+        CHECK(budget->acquire_calls == 1);
+        CHECK(retry_call_count == 0);
+        CHECK(timer_mock->schedule_call_count() == 2);
+        CHECK(exhausted_call_count == 0);
+
+        budget->allow = true;
+        timer_mock->execute_handler();
+
+        CHECK(retry_call_count == 1);
+    }
+
+    SECTION("Should count denied attempts towards max_attempts")
+    {
+        budget->allow = false;
+
+        executor.retry();
+        for (int i = 0; i < 3; ++i)
+        {
+            timer_mock->execute_handler();
+        }
+
+        CHECK(retry_call_count == 0);
+        CHECK(exhausted_call_count == 1);
+        CHECK(executor.is_retry_exhausted());
+    }
+}
+
 LUX_TEST_CASE("retry_executor", "respects maximum retry attempts limit", "[io][time]")
 {
     SECTION("Should call retry action up to max_attempts")
@@ -0,0 +1,174 @@
+#include "test_case.hpp"
+
+#include <lux/io/time/timer_wheel.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <boost/asio/io_context.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr lux::time::timer_wheel_config test_config{.tick = 1ms, .slot_count = 8};
+
+} // namespace
+
+LUX_TEST_CASE("timer_wheel", "schedules and cancels timed callbacks", "[io][time]")
+{
+    boost::asio::io_context io_context;
+    lux::time::timer_wheel wheel{io_context.get_executor(), test_config};
+
+    SECTION("Timer wheel should schedule once correctly")
+    {
+        auto timer = wheel.create_interval_timer();
+        REQUIRE(timer != nullptr);
+
+        bool called = false;
+        timer->set_handler([&called, &io_context] {
+            called = true;
+            io_context.stop();
+        });
+
+        const auto start = std::chrono::steady_clock::now();
+        timer->schedule(10ms);
+        CHECK(wheel.scheduled_count() == 1);
+
+        io_context.run_for(200ms);
+        CHECK(called);
+        CHECK(std::chrono::steady_clock::now() - start >= 10ms);
+        CHECK(wheel.scheduled_count() == 0);
+    }
+
+    SECTION("Timer wheel should handle delays longer than one wheel revolution")
+    {
+        auto timer = wheel.create_interval_timer();
+
+        bool called = false;
+        timer->set_handler([&called] { called = true; });
+
+        const auto start = std::chrono::steady_clock::now();
+        timer->schedule(30ms); // 30 ticks on an 8 slot wheel
+
+        io_context.run_for(200ms);
+        CHECK(called);
+        CHECK(std::chrono::steady_clock::now() - start >= 30ms);
+    }
+
+    SECTION("Timer wheel should schedule periodic correctly")
+    {
+        auto timer = wheel.create_interval_timer();
+
+        std::size_t called_count = 0;
+        timer->set_handler([&called_count, &io_context] {
+            ++called_count;
+            if (called_count == 3)
+            {
+                io_context.stop();
+            }
+        });
+
+        timer->schedule_periodic(5ms);
+        io_context.run_for(200ms);
+
+        CHECK(called_count == 3);
+        CHECK(wheel.scheduled_count() == 1);
+    }
+
+    SECTION("Timer wheel should cancel from handler")
+    {
+        auto timer = wheel.create_interval_timer();
+
+        std::size_t called_count = 0;
+        timer->set_handler([&called_count, &timer] {
+            ++called_count;
+            timer->cancel();
+        });
+
+        timer->schedule_periodic(5ms);
+
+        io_context.run_for(100ms);
+        CHECK(called_count == 1);
+        CHECK(wheel.scheduled_count() == 0);
+    }
+
+    SECTION("Timer wheel should handle cancellation before first call")
+    {
+        auto timer = wheel.create_interval_timer();
+
+        std::size_t called_count = 0;
+        timer->set_handler([&called_count] { ++called_count; });
+        timer->schedule(5ms);
+        timer->cancel();
+        timer->cancel(); // Should be a no-op
+
+        io_context.run_for(30ms);
+        CHECK(called_count == 0);
+    }
+
+    SECTION("Timer wheel should replace previous schedule")
+    {
+        auto timer = wheel.create_interval_timer();
+
+        std::size_t called_count = 0;
+        timer->set_handler([&called_count] { ++called_count; });
+        timer->schedule(5ms);
+        timer->schedule(10000ms);
+        CHECK(wheel.scheduled_count() == 1);
+
+        io_context.run_for(50ms);
+        CHECK(called_count == 0);
+
+        timer->schedule(5ms);
+        io_context.restart();
+        io_context.run_for(50ms);
+        CHECK(called_count == 1);
+    }
+
+    SECTION("Timer wheel should allow destroying timers from handlers")
+    {
+        auto first = wheel.create_interval_timer();
+        auto second = wheel.create_interval_timer();
+
+        std::size_t called_count = 0;
+        first->set_handler([&] {
+            ++called_count;
+            second.reset(); // expires in the same tick
+            first.reset();  // destroys the running timer itself
+        });
+        second->set_handler([&called_count] { ++called_count; });
+
+        first->schedule(5ms);
+        second->schedule(5ms);
+
+        io_context.run_for(50ms);
+        CHECK(called_count == 1);
+        CHECK(wheel.scheduled_count() == 0);
+    }
+
+    SECTION("Timer wheel should fire many timers")
+    {
+        constexpr std::size_t timer_count{1000};
+
+        std::vector<lux::time::base::interval_timer_ptr> timers;
+        std::vector<std::size_t> fired;
+        timers.reserve(timer_count);
+
+        for (std::size_t i = 0; i < timer_count; ++i)
+        {
+            auto& timer = timers.emplace_back(wheel.create_interval_timer());
+            timer->set_handler([&fired, i] { fired.push_back(i); });
+            timer->schedule(std::chrono::milliseconds{1 + (i % 20) * 2});
+        }
+
+        CHECK(wheel.scheduled_count() == timer_count);
+
+        io_context.run_for(500ms);
+        CHECK(fired.size() == timer_count);
+        CHECK(wheel.scheduled_count() == 0);
+    }
+}
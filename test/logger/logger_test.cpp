@@ -1,8 +1,10 @@
 ﻿#include "test_case.hpp"
 
+#include <lux/logger/binary_log.hpp>
 #include <lux/logger/logger.hpp>
 #include <lux/logger/logger_manager.hpp>
 
+#include <lux/support/exception.hpp>
 #include <lux/support/finally.hpp>
 
 #include <catch2/catch_all.hpp>
@@ -20,6 +22,8 @@
 #include <memory>
 #include <regex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 LUX_TEST_CASE("logger", "logs messages at various levels with formatting", "[logger]")
 {
@@ -329,6 +333,113 @@ LUX_TEST_CASE("logger_manager", "creates loggers with various sink configuration
         CHECK(&logger1 == &logger1_again);
         CHECK(&logger1 != &logger2);
     }
+
+    SECTION("Logger manager provides the same logger to concurrent callers")
+    {
+        lux::log_config config;
+        config.console = lux::console_log_config{};
+
+        lux::logger_manager manager{config};
+
+        constexpr std::size_t thread_count{8};
+        std::vector<const lux::logger*> results(thread_count * 2, nullptr);
+        std::vector<std::thread> threads;
+
+        for (std::size_t i = 0; i < thread_count; ++i)
+        {
+            threads.emplace_back([&manager, &results, i] {
+                results[i * 2] = &manager.get_logger("concurrent_logger");
+                results[i * 2 + 1] = &manager.get_logger(i % 2 == 0 ? "even_logger" : "odd_logger");
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(manager.loggers().size() == 3);
+        for (std::size_t i = 0; i < thread_count; ++i)
+        {
+            CHECK(results[i * 2] == &manager.get_logger("concurrent_logger"));
+            CHECK(results[i * 2 + 1] == &manager.get_logger(i % 2 == 0 ? "even_logger" : "odd_logger"));
+        }
+    }
+}
+
+LUX_TEST_CASE("binary_log", "writes binary events that decode back to text", "[logger][binary_log]")
+{
+    enum class test_state
+    {
+        idle,
+        running
+    };
+
+    const std::string filename{"binary_log_test.blog"};
+    std::filesystem::remove(filename);
+    LUX_FINALLY({ std::filesystem::remove(filename); });
+
+    SECTION("Binary sink events are decoded with their logger, level and arguments")
+    {
+        {
+            lux::log_config config;
+            config.binary = lux::binary_log_config{.level = lux::log_level::debug, .filename = filename};
+
+            lux::logger_manager manager{config};
+            REQUIRE(manager.binary_sink());
+            CHECK(manager.sinks().empty());
+
+            auto& net_logger = manager.get_logger("net");
+            auto& app_logger = manager.get_logger("app");
+
+            LUX_LOG_TRACE(net_logger, "Filtered out {}", 1);
+            LUX_LOG_DEBUG(net_logger, "Connected to {}:{} ({})", std::string{"localhost"}, 8080u, true);
+            LUX_LOG_INFO(app_logger, "Ratio {:.2f}, delta {}, state {}", 0.125, -42, test_state::running);
+            LUX_LOG_WARN(app_logger, "Plain message");
+            LUX_LOG_ERROR(net_logger, "Connected to {}:{} ({})", "remote", 443u, false);
+            net_logger.flush();
+        }
+
+        std::ifstream stream{filename, std::ios::binary};
+        REQUIRE(stream.is_open());
+
+        lux::binary_log_reader reader{stream};
+
+        auto record = reader.next();
+        REQUIRE(record.has_value());
+        CHECK(record->logger_name == "net");
+        CHECK(record->level == lux::log_level::debug);
+        CHECK(record->message == "Connected to localhost:8080 (true)");
+
+        record = reader.next();
+        REQUIRE(record.has_value());
+        CHECK(record->logger_name == "app");
+        CHECK(record->level == lux::log_level::info);
+        CHECK(record->message == "Ratio 0.12, delta -42, state running");
+
+        record = reader.next();
+        REQUIRE(record.has_value());
+        CHECK(record->level == lux::log_level::warn);
+        CHECK(record->message == "Plain message");
+
+        record = reader.next();
+        REQUIRE(record.has_value());
+        CHECK(record->logger_name == "net");
+        CHECK(record->level == lux::log_level::error);
+        CHECK(record->message == "Connected to remote:443 (false)");
+
+        const std::regex line_pattern(
+            R"(^\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}\.\d{3} \[error\] <net> Connected to remote:443 \(false\)$)");
+        CHECK(std::regex_search(lux::to_string(*record), line_pattern));
+
+        CHECK_FALSE(reader.next().has_value());
+    }
+
+    SECTION("Reader rejects streams without binary log header")
+    {
+        std::istringstream stream{"not a binary log"};
+        CHECK_THROWS_AS(lux::binary_log_reader{stream}, lux::formatted_exception);
+    }
 }
 
 LUX_TEST_CASE("log_config", "provides default values for all configuration types", "[log_config]")
@@ -6,8 +6,11 @@
 #include <catch2/catch_all.hpp>
 
 #include <array>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <vector>
 
 LUX_TEST_CASE("buffer_reader", "constructs and tracks position in buffer", "[utils][buffer_reader]")
@@ -338,3 +341,215 @@ LUX_TEST_CASE("buffer_reader", "round-trip compatibility", "[utils][buffer_reade
         CHECK(reader.remaining() == 0);
     }
 }
+
+LUX_TEST_CASE("buffer_reader", "byte order and varint decoding", "[utils][buffer_reader]")
+{
+    const auto make_buffer = [](std::initializer_list<int> values) {
+        std::vector<std::byte> result;
+        for (auto v : values)
+        {
+            result.push_back(static_cast<std::byte>(v));
+        }
+        return result;
+    };
+
+    SECTION("Reading big-endian and little-endian integers")
+    {
+        const auto buffer = make_buffer({0x01, 0x02, 0x03, 0x04, 0x06, 0x05, 0xFF, 0xFE});
+        lux::buffer_reader reader{buffer};
+
+        CHECK(reader.read_big_endian<std::uint32_t>() == 0x01020304);
+        CHECK(reader.read_little_endian<std::uint16_t>() == 0x0506);
+        CHECK(reader.read_big_endian<std::int16_t>() == -2);
+        CHECK(reader.remaining() == 0);
+    }
+
+    SECTION("Reading varints")
+    {
+        const auto buffer = make_buffer({0x00, 0x7F, 0x80, 0x01, 0xAC, 0x02, 0x7F});
+        lux::buffer_reader reader{buffer};
+
+        CHECK(reader.read_varint<std::uint32_t>() == 0);
+        CHECK(reader.read_varint<std::uint32_t>() == 127);
+        CHECK(reader.read_varint<std::uint64_t>() == 128);
+        CHECK(reader.read_varint<std::uint16_t>() == 300);
+        CHECK(reader.read_signed_varint<std::int8_t>() == -64);
+        CHECK(reader.remaining() == 0);
+    }
+
+    SECTION("Round-trip of varints at type limits")
+    {
+        std::array<std::byte, 64> buffer{};
+        lux::buffer_writer writer{buffer};
+        writer.write_varint(std::numeric_limits<std::uint64_t>::max())
+            .write_varint(std::numeric_limits<std::uint8_t>::max())
+            .write_signed_varint(std::numeric_limits<std::int32_t>::min())
+            .write_signed_varint(std::numeric_limits<std::int64_t>::max());
+
+        lux::buffer_reader reader{writer.written_data()};
+
+        CHECK(reader.read_varint<std::uint64_t>() == std::numeric_limits<std::uint64_t>::max());
+        CHECK(reader.read_varint<std::uint8_t>() == std::numeric_limits<std::uint8_t>::max());
+        CHECK(reader.read_signed_varint<std::int32_t>() == std::numeric_limits<std::int32_t>::min());
+        CHECK(reader.read_signed_varint<std::int64_t>() == std::numeric_limits<std::int64_t>::max());
+        CHECK(reader.remaining() == 0);
+    }
+
+    SECTION("Truncated varint throws and leaves position unchanged")
+    {
+        const auto buffer = make_buffer({0x80, 0x80});
+        lux::buffer_reader reader{buffer};
+
+        CHECK_THROWS_AS(reader.read_varint<std::uint32_t>(), lux::formatted_exception);
+        CHECK(reader.position() == 0);
+    }
+
+    SECTION("Varint not fitting the requested type throws")
+    {
+        const auto too_large = make_buffer({0x80, 0x02});
+        lux::buffer_reader large_reader{too_large};
+        CHECK_THROWS_AS(large_reader.read_varint<std::uint8_t>(), lux::formatted_exception);
+        CHECK(large_reader.position() == 0);
+
+        const auto too_long = make_buffer({0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00});
+        lux::buffer_reader long_reader{too_long};
+        CHECK_THROWS_AS(long_reader.read_varint<std::uint32_t>(), lux::formatted_exception);
+    }
+}
+
+LUX_TEST_CASE("buffer_reader", "length-prefixed views", "[utils][buffer_reader]")
+{
+    std::array<std::byte, 64> buffer{};
+    lux::buffer_writer writer{buffer};
+
+    SECTION("Reading length-prefixed strings and spans returns views into the source buffer")
+    {
+        const std::array<std::byte, 2> bytes{std::byte{0xAA}, std::byte{0xBB}};
+        writer.write_length_prefixed("abc").write_length_prefixed(std::string_view{}).write_length_prefixed(bytes);
+
+        lux::buffer_reader reader{writer.written_data()};
+
+        const auto str = reader.read_length_prefixed_string();
+        CHECK(str == "abc");
+        CHECK(reinterpret_cast<const std::byte*>(str.data()) == buffer.data() + 1);
+
+        CHECK(reader.read_length_prefixed_string().empty());
+
+        const auto data = reader.read_length_prefixed_bytes();
+        REQUIRE(data.size() == 2);
+        CHECK(data.data() == buffer.data() + 6);
+        CHECK(data[1] == std::byte{0xBB});
+        CHECK(reader.remaining() == 0);
+    }
+
+    SECTION("Reading raw byte views")
+    {
+        writer << std::uint16_t{7} << "xyz";
+
+        lux::buffer_reader reader{writer.written_data()};
+        reader.skip(sizeof(std::uint16_t));
+
+        const auto data = reader.read_bytes(3);
+        CHECK(data.data() == buffer.data() + 2);
+        CHECK(reader.remaining() == 0);
+        CHECK_THROWS_AS(reader.read_bytes(1), lux::formatted_exception);
+    }
+
+    SECTION("Length prefix exceeding the buffer throws and leaves position unchanged")
+    {
+        writer.write_varint(10u) << "abc";
+
+        lux::buffer_reader reader{writer.written_data()};
+
+        CHECK_THROWS_AS(reader.read_length_prefixed_string(), lux::formatted_exception);
+        CHECK(reader.position() == 0);
+    }
+}
+
+LUX_TEST_CASE("buffer_reader", "non-throwing reads", "[utils][buffer_reader]")
+{
+    std::array<std::byte, 16> buffer{};
+    lux::buffer_writer writer{buffer};
+
+    SECTION("try_read reports underflow without reading")
+    {
+        writer.write_big_endian(std::uint16_t{0x0102}) << std::uint8_t{7};
+
+        lux::buffer_reader reader{writer.written_data()};
+
+        CHECK(reader.try_read_big_endian<std::uint16_t>() == 0x0102);
+
+        const auto value = reader.try_read<std::uint32_t>();
+        REQUIRE_FALSE(value.has_value());
+        CHECK(value.error() == std::make_error_code(std::errc::result_out_of_range));
+        CHECK_FALSE(reader.try_read_bytes(2).has_value());
+        CHECK(reader.position() == 2);
+
+        CHECK(reader.try_read<std::uint8_t>() == 7);
+        CHECK_FALSE(reader.try_read_little_endian<std::uint8_t>().has_value());
+    }
+
+    SECTION("try_read_varint distinguishes truncated and oversized varints")
+    {
+        writer.write_varint(300u).write_signed_varint(-2).write_varint(0x100u);
+
+        lux::buffer_reader reader{writer.written_data()};
+
+        CHECK(reader.try_read_varint<std::uint16_t>() == 300);
+        CHECK(reader.try_read_signed_varint<std::int32_t>() == -2);
+
+        const auto oversized = reader.try_read_varint<std::uint8_t>();
+        REQUIRE_FALSE(oversized.has_value());
+        CHECK(oversized.error() == std::make_error_code(std::errc::value_too_large));
+
+        lux::buffer_reader truncated_reader{writer.written_data().first(1)};
+        const auto truncated = truncated_reader.try_read_varint<std::uint32_t>();
+        REQUIRE_FALSE(truncated.has_value());
+        CHECK(truncated.error() == std::make_error_code(std::errc::result_out_of_range));
+        CHECK(truncated_reader.position() == 0);
+    }
+
+    SECTION("try_read_length_prefixed returns views or leaves the position unchanged")
+    {
+        writer.write_length_prefixed("abc").write_varint(5u) << "xy";
+
+        lux::buffer_reader reader{writer.written_data()};
+
+        CHECK(reader.try_read_length_prefixed_string() == "abc");
+
+        const auto position = reader.position();
+        const auto truncated = reader.try_read_length_prefixed_bytes();
+        REQUIRE_FALSE(truncated.has_value());
+        CHECK(truncated.error() == std::make_error_code(std::errc::result_out_of_range));
+        CHECK(reader.position() == position);
+    }
+
+    SECTION("Reservation reads without bounds checks")
+    {
+        writer.write_big_endian(std::uint32_t{0x01020304}).write_little_endian(std::uint16_t{0x0506}) << "ab";
+
+        lux::buffer_reader reader{writer.written_data()};
+        auto reservation = reader.reserve(8);
+
+        CHECK(reservation.read_big_endian<std::uint32_t>() == 0x01020304);
+
+        CHECK(reservation.read_little_endian<std::uint16_t>() == 0x0506);
+
+        const auto text = reservation.read_bytes(2);
+        CHECK(text.data() == buffer.data() + 6);
+        CHECK(reservation.remaining() == 0);
+        CHECK(reader.remaining() == 0);
+    }
+
+    SECTION("Reserving more than the remaining data fails")
+    {
+        lux::buffer_reader reader{std::span<const std::byte>{buffer}.first(4)};
+
+        CHECK_THROWS_AS(reader.reserve(5), lux::formatted_exception);
+
+        const auto reservation = reader.try_reserve(5);
+        REQUIRE_FALSE(reservation.has_value());
+        CHECK(reservation.error() == std::make_error_code(std::errc::result_out_of_range));
+        CHECK(reader.try_reserve(4).has_value());
+    }
+}
@@ -4,9 +4,13 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <vector>
 
 LUX_TEST_CASE("buffer_writer", "constructs and tracks written data", "[utils][buffer_writer]")
@@ -272,3 +276,152 @@ LUX_TEST_CASE("buffer_writer user-defined types", "[utils][buffer_writer]")
         CHECK(data_ptr[4] == Catch::Approx(3.0f));
     }
 }
+
+LUX_TEST_CASE("buffer_writer", "byte order and varint encoding", "[utils][buffer_writer]")
+{
+    std::array<std::byte, 32> buffer{};
+    lux::buffer_writer writer{buffer};
+
+    const auto written_as_ints = [&] {
+        std::vector<int> result;
+        for (auto b : writer.written_data())
+        {
+            result.push_back(std::to_integer<int>(b));
+        }
+        return result;
+    };
+
+    SECTION("Writing big-endian and little-endian integers")
+    {
+        writer.write_big_endian(std::uint32_t{0x01020304}).write_little_endian(std::uint16_t{0x0506});
+        writer.write_big_endian(std::int16_t{-2});
+
+        CHECK(written_as_ints() == std::vector<int>{0x01, 0x02, 0x03, 0x04, 0x06, 0x05, 0xFF, 0xFE});
+    }
+
+    SECTION("Writing unsigned varints")
+    {
+        writer.write_varint(0u).write_varint(127u).write_varint(128u).write_varint(std::uint16_t{300});
+
+        CHECK(written_as_ints() == std::vector<int>{0x00, 0x7F, 0x80, 0x01, 0xAC, 0x02});
+    }
+
+    SECTION("Writing maximum varint")
+    {
+        writer.write_varint(std::numeric_limits<std::uint64_t>::max());
+
+        CHECK(writer.position() == lux::max_varint_size<std::uint64_t>);
+        CHECK(written_as_ints().back() == 0x01);
+    }
+
+    SECTION("Writing signed varints uses zigzag encoding")
+    {
+        writer.write_signed_varint(0).write_signed_varint(-1).write_signed_varint(1).write_signed_varint(-64);
+
+        CHECK(written_as_ints() == std::vector<int>{0x00, 0x01, 0x02, 0x7F});
+    }
+
+    SECTION("Writing length-prefixed strings and spans")
+    {
+        const std::array<std::byte, 2> bytes{std::byte{0xAA}, std::byte{0xBB}};
+        writer.write_length_prefixed("abc").write_length_prefixed(std::string_view{}).write_length_prefixed(bytes);
+
+        CHECK(written_as_ints() == std::vector<int>{0x03, 'a', 'b', 'c', 0x00, 0x02, 0xAA, 0xBB});
+    }
+
+    SECTION("Length-prefixed overflow writes nothing")
+    {
+        writer.skip(28);
+
+        CHECK_THROWS_AS(writer.write_length_prefixed("abcd"), lux::formatted_exception);
+        CHECK(writer.position() == 28);
+    }
+
+    SECTION("Varint overflow writes nothing")
+    {
+        writer.skip(30);
+
+        CHECK_THROWS_AS(writer.write_varint(std::uint32_t{1} << 21), lux::formatted_exception);
+        CHECK(writer.position() == 30);
+    }
+}
+
+LUX_TEST_CASE("varint", "zigzag encoding", "[utils][buffer_writer]")
+{
+    STATIC_CHECK(lux::zigzag_encode(0) == 0u);
+    STATIC_CHECK(lux::zigzag_encode(-1) == 1u);
+    STATIC_CHECK(lux::zigzag_encode(1) == 2u);
+    STATIC_CHECK(lux::zigzag_encode(std::numeric_limits<std::int32_t>::min()) ==
+                 std::numeric_limits<std::uint32_t>::max());
+    STATIC_CHECK(lux::zigzag_encode(std::int8_t{-128}) == std::uint8_t{255});
+
+    STATIC_CHECK(lux::zigzag_decode(lux::zigzag_encode(std::numeric_limits<std::int64_t>::min())) ==
+                 std::numeric_limits<std::int64_t>::min());
+    STATIC_CHECK(lux::zigzag_decode(std::uint8_t{254}) == std::int8_t{127});
+
+    STATIC_CHECK(lux::varint_size(0u) == 1);
+    STATIC_CHECK(lux::varint_size(128u) == 2);
+    STATIC_CHECK(lux::max_varint_size<std::uint32_t> == 5);
+}
+
+LUX_TEST_CASE("buffer_writer", "non-throwing writes", "[utils][buffer_writer]")
+{
+    std::array<std::byte, 8> buffer{};
+    lux::buffer_writer writer{buffer};
+
+    SECTION("try_write reports overflow without writing")
+    {
+        CHECK_FALSE(writer.try_write(std::uint32_t{1}));
+        CHECK_FALSE(writer.try_write("ab"));
+        CHECK(writer.position() == 6);
+
+        CHECK(writer.try_write(std::uint32_t{2}) == std::make_error_code(std::errc::no_buffer_space));
+        CHECK(writer.try_write_big_endian(std::uint32_t{2}) == std::make_error_code(std::errc::no_buffer_space));
+        CHECK(writer.try_write_length_prefixed("ab") == std::make_error_code(std::errc::no_buffer_space));
+        CHECK(writer.position() == 6);
+
+        CHECK_FALSE(writer.try_write_little_endian(std::uint16_t{0x0102}));
+        CHECK(writer.remaining() == 0);
+        CHECK(writer.written_data()[6] == std::byte{0x02});
+    }
+
+    SECTION("try_write_varint writes varints fitting the remaining space")
+    {
+        writer.skip(6);
+
+        CHECK_FALSE(writer.try_write_varint(std::uint64_t{300}));
+        CHECK(writer.try_write_signed_varint(-1) == std::make_error_code(std::errc::no_buffer_space));
+        CHECK(writer.remaining() == 0);
+    }
+
+    SECTION("Reservation writes without bounds checks")
+    {
+        auto reservation = writer.reserve(8);
+        reservation.write_big_endian(std::uint16_t{0x0102}).write_varint(300u) << std::uint8_t{3};
+        reservation.write("ab");
+
+        CHECK(reservation.remaining() == 1);
+        CHECK(writer.position() == 7);
+
+        const std::array<std::byte, 7> expected{std::byte{0x01},
+                                                std::byte{0x02},
+                                                std::byte{0xAC},
+                                                std::byte{0x02},
+                                                std::byte{3},
+                                                std::byte{'a'},
+                                                std::byte{'b'}};
+        CHECK(std::ranges::equal(writer.written_data(), expected));
+    }
+
+    SECTION("Reserving more than the remaining space fails")
+    {
+        writer.skip(4);
+
+        CHECK_THROWS_AS(writer.reserve(5), lux::formatted_exception);
+
+        const auto reservation = writer.try_reserve(5);
+        REQUIRE_FALSE(reservation.has_value());
+        CHECK(reservation.error() == std::make_error_code(std::errc::no_buffer_space));
+        CHECK(writer.try_reserve(4).has_value());
+    }
+}
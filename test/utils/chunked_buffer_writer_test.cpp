@@ -0,0 +1,81 @@
+﻿#include "test_case.hpp"
+
+#include <lux/utils/buffer_reader.hpp>
+#include <lux/utils/chunked_buffer_writer.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+LUX_TEST_CASE("chunked_buffer_writer", "appends data to a chain of chunks", "[utils][chunked_buffer_writer]")
+{
+    auto arena = lux::make_growable_memory_arena(2, 4);
+    lux::chunked_buffer_writer writer{arena, 4};
+
+    SECTION("Construction and basic properties")
+    {
+        CHECK(writer.empty());
+        CHECK(writer.size() == 0);
+        CHECK(writer.chunks().empty());
+    }
+
+    SECTION("Data is spread over chunks of the configured size")
+    {
+        writer << std::uint16_t{1} << "abcdefg";
+
+        CHECK(writer.size() == 9);
+        REQUIRE(writer.chunks().size() == 3);
+        CHECK(writer.chunks()[0]->size() == 4);
+        CHECK(writer.chunks()[1]->size() == 4);
+        CHECK(writer.chunks()[2]->size() == 1);
+    }
+
+    SECTION("Encoded data matches buffer_writer")
+    {
+        writer.write_big_endian(std::uint32_t{0x01020304})
+            .write_little_endian(std::int16_t{-2})
+            .write_varint(300u)
+            .write_signed_varint(-64)
+            .write_length_prefixed("hello");
+
+        const auto data = writer.to_vector();
+        lux::buffer_reader reader{data};
+
+        CHECK(reader.read_big_endian<std::uint32_t>() == 0x01020304);
+        CHECK(reader.read_little_endian<std::int16_t>() == -2);
+        CHECK(reader.read_varint<std::uint32_t>() == 300);
+        CHECK(reader.read_signed_varint<std::int32_t>() == -64);
+        CHECK(reader.read_length_prefixed_string() == "hello");
+        CHECK(reader.remaining() == 0);
+    }
+
+    SECTION("Large writes don't require pre-sizing")
+    {
+        const std::string text(1000, 'x');
+        writer.write(text);
+
+        CHECK(writer.size() == 1000);
+        CHECK(writer.chunks().size() == 250);
+        CHECK(writer.to_vector() == std::vector<std::byte>(1000, std::byte{'x'}));
+    }
+
+    SECTION("Released chain leaves the writer empty and returns chunks to the arena")
+    {
+        writer << "12345";
+
+        auto chain = writer.release();
+        REQUIRE(chain.size() == 2);
+        CHECK(writer.empty());
+        CHECK(writer.chunks().empty());
+
+        const std::array<const std::vector<std::byte>*, 2> released{chain[0].get(), chain[1].get()};
+        chain.clear();
+
+        writer << "a";
+        CHECK(std::ranges::find(released, writer.chunks().front().get()) != released.end());
+    }
+}
@@ -4,6 +4,19 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <set>
+#include <span>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 LUX_TEST_CASE("random_bytes", "generates random bytes", "[utils][random_bytes]")
 {
     SECTION("Generates correct number of bytes")
@@ -27,4 +40,81 @@ LUX_TEST_CASE("random_bytes", "generates random bytes", "[utils][random_bytes]")
         auto bytes = lux::random_bytes(count);
         REQUIRE(bytes.empty());
     }
-}
\ No newline at end of file
+}
+
+LUX_TEST_CASE("random_bytes", "fills buffers with random bytes", "[utils][random_bytes]")
+{
+    SECTION("Fills the whole buffer")
+    {
+        std::array<std::byte, 64> buffer{};
+        lux::fill_random_bytes(buffer);
+        CHECK(std::ranges::count(buffer, std::byte{0}) < 8);
+    }
+
+    SECTION("Empty buffer is left untouched")
+    {
+        REQUIRE_NOTHROW(lux::fill_random_bytes(std::span<std::byte>{}));
+    }
+
+    SECTION("Large buffers bypass the pool")
+    {
+        std::vector<std::byte> buffer(64 * 1024);
+        lux::fill_random_bytes(buffer);
+        CHECK(std::ranges::count(buffer, std::byte{0}) < 512);
+    }
+
+    SECTION("Small draws across pool refills never repeat")
+    {
+        std::set<std::uint64_t> values;
+        for (int i = 0; i < 10'000; ++i)
+        {
+            values.insert(lux::random_value<std::uint64_t>());
+        }
+        CHECK(values.size() == 10'000);
+    }
+
+    SECTION("Threads draw different bytes")
+    {
+        std::array<std::uint64_t, 4> values{};
+        std::vector<std::thread> threads;
+        for (auto& value : values)
+        {
+            threads.emplace_back([&value] { value = lux::random_value<std::uint64_t>(); });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        CHECK(std::set<std::uint64_t>(values.begin(), values.end()).size() == values.size());
+    }
+
+#ifndef _WIN32
+    SECTION("Child process doesn't reuse bytes buffered before fork")
+    {
+        static_cast<void>(lux::random_value<std::uint64_t>()); // Fill the pool of this thread
+
+        int fds[2];
+        REQUIRE(::pipe(fds) == 0);
+
+        const auto pid = ::fork();
+        REQUIRE(pid >= 0);
+        if (pid == 0)
+        {
+            const auto value = lux::random_value<std::uint64_t>();
+            const auto written = ::write(fds[1], &value, sizeof(value));
+            ::_exit(written == sizeof(value) ? 0 : 1);
+        }
+
+        const auto parent_value = lux::random_value<std::uint64_t>();
+        std::uint64_t child_value = 0;
+        REQUIRE(::read(fds[0], &child_value, sizeof(child_value)) == sizeof(child_value));
+        ::close(fds[0]);
+        ::close(fds[1]);
+
+        int status = 0;
+        ::waitpid(pid, &status, 0);
+        CHECK(child_value != parent_value);
+    }
+#endif
+}
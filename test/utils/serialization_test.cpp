@@ -0,0 +1,230 @@
+﻿#include "test_case.hpp"
+
+#include <lux/utils/serialization.hpp>
+
+#include <catch2/catch_all.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace {
+
+enum class message_type : std::uint8_t
+{
+    ping = 1,
+    pong = 2,
+};
+
+struct header
+{
+    std::uint32_t sequence;
+    std::uint16_t flags;
+    message_type type;
+    std::uint8_t version;
+};
+
+struct padded
+{
+    std::uint8_t tag;
+    std::uint32_t value;
+};
+
+struct quote
+{
+    header hdr;
+    std::array<std::int64_t, 2> prices;
+    std::string symbol;
+    std::vector<padded> legs;
+    std::optional<double> limit;
+    std::pair<std::uint8_t, std::string_view> note;
+};
+
+struct not_serializable
+{
+    int* pointer;
+};
+
+} // namespace
+
+LUX_TEST_CASE("serialization", "computes fixed layouts at compile time", "[utils][serialization]")
+{
+    STATIC_CHECK(lux::fixed_size_serializable<header>);
+    STATIC_CHECK(lux::fixed_serialized_size_v<header> == 8);
+    STATIC_CHECK(lux::fixed_serialized_size_v<padded> == 5);
+    STATIC_CHECK(lux::fixed_serialized_size_v<std::array<padded, 3>> == 15);
+    STATIC_CHECK(lux::fixed_serialized_size_v<std::tuple<std::uint8_t, header>> == 9);
+    STATIC_CHECK(lux::fixed_serialized_size_v<bool> == 1);
+
+    STATIC_CHECK(lux::serializable<quote>);
+    STATIC_CHECK(!lux::fixed_size_serializable<quote>);
+    STATIC_CHECK(!lux::serializable<not_serializable>);
+    STATIC_CHECK(!lux::serializable<std::vector<not_serializable>>);
+}
+
+LUX_TEST_CASE("serialization", "encodes fixed-size messages", "[utils][serialization]")
+{
+    std::array<std::byte, 64> buffer{};
+    lux::buffer_writer writer{buffer};
+
+    SECTION("Messages without padding are copied as they are")
+    {
+        const header hdr{.sequence = 42, .flags = 0x0102, .type = message_type::pong, .version = 3};
+        lux::serialize(writer, hdr);
+
+        REQUIRE(writer.position() == sizeof(header));
+        CHECK(std::memcmp(buffer.data(), &hdr, sizeof(header)) == 0);
+
+        lux::buffer_reader reader{writer.written_data()};
+        const auto decoded = lux::deserialize<header>(reader);
+        CHECK(decoded.sequence == 42);
+        CHECK(decoded.flags == 0x0102);
+        CHECK(decoded.type == message_type::pong);
+        CHECK(decoded.version == 3);
+        CHECK(reader.remaining() == 0);
+    }
+
+    SECTION("Padding is not encoded")
+    {
+        lux::serialize(writer, padded{.tag = 7, .value = 0x01020304});
+
+        REQUIRE(writer.position() == 5);
+        CHECK(buffer[0] == std::byte{7});
+
+        lux::buffer_reader reader{writer.written_data()};
+        const auto decoded = lux::deserialize<padded>(reader);
+        CHECK(decoded.tag == 7);
+        CHECK(decoded.value == 0x01020304);
+    }
+
+    SECTION("Encoding matches field by field writes")
+    {
+        const header hdr{.sequence = 1, .flags = 2, .type = message_type::ping, .version = 4};
+        lux::serialize(writer, padded{.tag = 9, .value = 10}).write(std::uint8_t{0xFF});
+        lux::serialize(writer, hdr);
+
+        std::array<std::byte, 64> expected_buffer{};
+        lux::buffer_writer expected{expected_buffer};
+        expected << std::uint8_t{9} << std::uint32_t{10} << std::uint8_t{0xFF};
+        expected << std::uint32_t{1} << std::uint16_t{2} << message_type::ping << std::uint8_t{4};
+
+        CHECK(std::ranges::equal(writer.written_data(), expected.written_data()));
+    }
+
+    SECTION("Overflow writes nothing")
+    {
+        writer.skip(60);
+
+        CHECK_THROWS_AS(lux::serialize(writer, header{}), lux::formatted_exception);
+        CHECK(writer.position() == 60);
+    }
+
+    SECTION("Truncated data throws")
+    {
+        lux::serialize(writer, header{});
+
+        lux::buffer_reader reader{writer.written_data().first(7)};
+        CHECK_THROWS_AS(lux::deserialize<header>(reader), lux::formatted_exception);
+        CHECK(reader.position() == 0);
+    }
+}
+
+LUX_TEST_CASE("serialization", "encodes variable-size messages", "[utils][serialization]")
+{
+    std::array<std::byte, 256> buffer{};
+    lux::buffer_writer writer{buffer};
+
+    const quote original{.hdr = {.sequence = 7, .flags = 1, .type = message_type::ping, .version = 1},
+                         .prices = {100, -200},
+                         .symbol = "LUX",
+                         .legs = {{.tag = 1, .value = 11}, {.tag = 2, .value = 22}},
+                         .limit = 1.5,
+                         .note = {3, "note"}};
+
+    SECTION("Round-trip of all supported field kinds")
+    {
+        lux::serialize(writer, original);
+
+        CHECK(writer.position() == lux::serialized_size(original));
+        CHECK(writer.position() == 8 + 16 + (1 + 3) + (1 + 2 * 5) + (1 + 8) + (1 + 1 + 4));
+
+        lux::buffer_reader reader{writer.written_data()};
+        const auto decoded = lux::deserialize<quote>(reader);
+
+        CHECK(decoded.hdr.sequence == 7);
+        CHECK(decoded.prices == original.prices);
+        CHECK(decoded.symbol == "LUX");
+        REQUIRE(decoded.legs.size() == 2);
+        CHECK(decoded.legs[1].tag == 2);
+        CHECK(decoded.legs[1].value == 22);
+        CHECK(decoded.limit == 1.5);
+        CHECK(decoded.note.first == 3);
+        CHECK(decoded.note.second == "note");
+        CHECK(reader.remaining() == 0);
+    }
+
+    SECTION("String views refer to the source buffer")
+    {
+        lux::serialize(writer, original);
+
+        lux::buffer_reader reader{writer.written_data()};
+        const auto decoded = lux::deserialize<quote>(reader);
+
+        const auto* begin = reinterpret_cast<const char*>(buffer.data());
+        CHECK(decoded.note.second.data() >= begin);
+        CHECK(decoded.note.second.data() < begin + buffer.size());
+    }
+
+    SECTION("Empty optionals and vectors")
+    {
+        using message = std::tuple<std::optional<std::uint32_t>, std::vector<std::uint16_t>, std::vector<std::string>>;
+        const message value{std::nullopt, {}, {"a", "bc"}};
+        lux::serialize(writer, value);
+
+        CHECK(writer.position() == 1 + 1 + (1 + 2 + 3));
+
+        lux::buffer_reader reader{writer.written_data()};
+        CHECK(lux::deserialize<message>(reader) == value);
+    }
+
+    SECTION("Overflow writes nothing")
+    {
+        writer.skip(buffer.size() - lux::serialized_size(original) + 1);
+        const auto position = writer.position();
+
+        CHECK_THROWS_AS(lux::serialize(writer, original), lux::formatted_exception);
+        CHECK(writer.position() == position);
+    }
+
+    SECTION("Vector count exceeding the data throws before allocating")
+    {
+        writer.write_varint(std::size_t{1} << 40);
+
+        lux::buffer_reader reader{writer.written_data()};
+        CHECK_THROWS_AS(lux::deserialize<std::vector<std::uint64_t>>(reader), lux::formatted_exception);
+
+        lux::buffer_reader variable_reader{writer.written_data()};
+        CHECK_THROWS_AS(lux::deserialize<std::vector<std::string>>(variable_reader), lux::formatted_exception);
+    }
+
+    SECTION("Bools are encoded as one byte and validated")
+    {
+        const std::tuple<bool, std::vector<bool>> value{true, {true, false, true}};
+        lux::serialize(writer, value);
+
+        CHECK(writer.position() == 1 + 1 + 3);
+
+        lux::buffer_reader reader{writer.written_data()};
+        CHECK(lux::deserialize<std::tuple<bool, std::vector<bool>>>(reader) == value);
+
+        const std::array invalid{std::byte{7}};
+        lux::buffer_reader invalid_reader{invalid};
+        CHECK_THROWS_AS(lux::deserialize<bool>(invalid_reader), lux::formatted_exception);
+    }
+}
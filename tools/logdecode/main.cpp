@@ -0,0 +1,47 @@
+// lux-logdecode: converts binary logs written by lux::binary_log_sink back into text.
+//
+// Usage: lux-logdecode <file>...
+// Decoded events are written to stdout, one line per event.
+
+#include <lux/logger/binary_log.hpp>
+
+#include <exception>
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " <file>...\n";
+        return 1;
+    }
+
+    int result{0};
+    for (int i = 1; i < argc; ++i)
+    {
+        std::ifstream stream{argv[i], std::ios::binary};
+        if (!stream)
+        {
+            std::cerr << argv[i] << ": cannot open file\n";
+            result = 1;
+            continue;
+        }
+
+        try
+        {
+            lux::binary_log_reader reader{stream};
+            while (const auto record = reader.next())
+            {
+                std::cout << lux::to_string(*record) << '\n';
+            }
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << argv[i] << ": " << e.what() << '\n';
+            result = 1;
+        }
+    }
+
+    return result;
+}